@@ -19,6 +19,8 @@
 
 #include <BenchmarkUtils.h>
 
+#include <vector>
+
 using geos::algorithm::locate::SimplePointInAreaLocator;
 using geos::algorithm::locate::IndexedPointInAreaLocator;
 
@@ -44,6 +46,43 @@ static void BM_PointInAreaLocator(benchmark::State& state) {
     }
 }
 
+// Locate many points against a prepared locator, one at a time (range(2) == 0)
+// or with locateMany (range(2) == 1)
+static void BM_IndexedPointInAreaLocatorMany(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+
+    auto nRingPts = static_cast<std::size_t>(state.range(0));
+    auto nTestPts = static_cast<std::size_t>(state.range(1));
+    bool batch = state.range(2) != 0;
+
+    auto geom = geos::benchmark::createSineStar({0, 0}, 100, nRingPts);
+    auto test_pts = geos::benchmark::createRandomCoords(*geom->getEnvelopeInternal(), nTestPts, eng);
+
+    std::vector<double> x(nTestPts);
+    std::vector<double> y(nTestPts);
+    for (std::size_t i = 0; i < nTestPts; i++) {
+        x[i] = test_pts->getX(i);
+        y[i] = test_pts->getY(i);
+    }
+    std::vector<geos::geom::Location> locations(nTestPts);
+
+    IndexedPointInAreaLocator loc(*geom);
+    loc.locate(&test_pts->getAt<geos::geom::CoordinateXY>(0));
+
+    for (auto _ : state) {
+        if (batch) {
+            loc.locateMany(x.data(), y.data(), nTestPts, locations.data());
+        } else {
+            for (std::size_t i = 0; i < nTestPts; i++) {
+                geos::geom::CoordinateXY pt(x[i], y[i]);
+                locations[i] = loc.locate(&pt);
+            }
+        }
+        benchmark::DoNotOptimize(locations.data());
+    }
+}
+
+BENCHMARK(BM_IndexedPointInAreaLocatorMany)->ArgsProduct({{1000, 10000, 100000}, {100000}, {0, 1}});
 BENCHMARK_TEMPLATE(BM_PointInAreaLocator, IndexedPointInAreaLocator)->ArgsProduct({nPtsRange, nTestsRange});
 BENCHMARK_TEMPLATE(BM_PointInAreaLocator, SimplePointInAreaLocator)->ArgsProduct({nPtsRange, nTestsRange});
 
@@ -14,10 +14,25 @@
 
 #include <benchmark/benchmark.h>
 
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Centroid.h>
+#include <geos/algorithm/Length.h>
+#include <geos/constants.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
 
+#include <cmath>
+
+using geos::algorithm::Area;
+using geos::algorithm::Centroid;
+using geos::algorithm::Length;
 using geos::geom::Coordinate;
 using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::GeometryFactory;
 
 static void BM_Size(benchmark::State& state) {
     CoordinateSequence z(1533);
@@ -48,9 +63,62 @@ static void BM_HasRepeatedPoints(benchmark::State & state) {
     }
 }
 
+// A closed, wavy ring with state.range(0) points
+static CoordinateSequence makeRing(benchmark::State& state) {
+    std::size_t n = static_cast<std::size_t>(state.range(0));
+    CoordinateSequence seq(0u, false, false);
+    seq.reserve(n);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        double a = 2 * geos::MATH_PI * static_cast<double>(i) / static_cast<double>(n - 1);
+        double r = 100 + static_cast<double>(i % 7);
+        seq.add(CoordinateXY(r * std::cos(a), r * std::sin(a)));
+    }
+    seq.closeRing();
+    return seq;
+}
+
+static void BM_GetEnvelope(benchmark::State& state) {
+    auto seq = makeRing(state);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(seq.getEnvelope());
+    }
+}
+
+static void BM_LengthOfLine(benchmark::State& state) {
+    auto seq = makeRing(state);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Length::ofLine(&seq));
+    }
+}
+
+static void BM_AreaOfRing(benchmark::State& state) {
+    auto seq = makeRing(state);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Area::ofRing(&seq));
+    }
+}
+
+static void BM_Centroid(benchmark::State& state) {
+    auto gfact = GeometryFactory::create();
+    auto poly = gfact->createPolygon(gfact->createLinearRing(makeRing(state)));
+
+    for (auto _ : state) {
+        CoordinateXY c;
+        Centroid::getCentroid(*poly, c);
+        benchmark::DoNotOptimize(c);
+    }
+}
+
 BENCHMARK(BM_Size);
 BENCHMARK(BM_Initialize);
 BENCHMARK(BM_HasRepeatedPoints);
+BENCHMARK(BM_GetEnvelope)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_LengthOfLine)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_AreaOfRing)->Arg(10)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_Centroid)->Arg(10)->Arg(1000)->Arg(100000);
 
 BENCHMARK_MAIN();
 
@@ -29,6 +29,7 @@ using geos::index::quadtree::Quadtree;
 using geos::index::strtree::STRtree;
 using geos::index::strtree::SimpleSTRtree;
 using geos::index::strtree::TemplateSTRtree;
+using geos::index::strtree::TreePacking;
 using geos::index::strtree::Interval;
 using geos::index::strtree::ItemDistance;
 using geos::index::strtree::ItemBoundable;
@@ -65,6 +66,30 @@ static std::vector<Envelope> generate_envelopes(std::default_random_engine & e,
     return envelopes;
 }
 
+// Envelopes as in generate_envelopes, with centroids gathered in
+// normally-distributed clusters, leaving most of the extent empty.
+static std::vector<Envelope> generate_clustered_envelopes(std::default_random_engine & e,
+                                                          const Envelope& extent,
+                                                          std::size_t n,
+                                                          std::size_t nclusters) {
+    auto envelopes = generate_envelopes(e, extent, n);
+    auto centers = generate_envelopes(e, extent, nclusters);
+
+    std::normal_distribution<> offset_x(0, 0.02 * extent.getWidth());
+    std::normal_distribution<> offset_y(0, 0.02 * extent.getHeight());
+
+    for (std::size_t i = 0; i < n; i++) {
+        const Envelope& c = centers[i % nclusters];
+        double dx = c.getMinX() + c.getWidth() / 2 + offset_x(e) - (envelopes[i].getMinX() + envelopes[i].getWidth() / 2);
+        double dy = c.getMinY() + c.getHeight() / 2 + offset_y(e) - (envelopes[i].getMinY() + envelopes[i].getHeight() / 2);
+
+        envelopes[i] = Envelope(envelopes[i].getMinX() + dx, envelopes[i].getMaxX() + dx,
+                                envelopes[i].getMinY() + dy, envelopes[i].getMaxY() + dy);
+    }
+
+    return envelopes;
+}
+
 std::vector<CoordinateXY> generate_uniform_points(std::default_random_engine& eng,
                                                 const Envelope& box,
                                                 std::size_t n) {
@@ -120,6 +145,21 @@ struct EnvelopeDistance : public ItemDistance {
     }
 };
 
+// Number of nodes examined by a TemplateSTRtree query
+template<typename Node>
+static std::size_t countNodeVisits(const Node& node, const Envelope& e) {
+    std::size_t visits = 1;
+    if (node.isLeaf()) {
+        return visits;
+    }
+    for (auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+        if (child->boundsIntersect(e)) {
+            visits += countNodeVisits(*child, e);
+        }
+    }
+    return visits;
+}
+
 /////////////////
 // 1D adapters //
 /////////////////
@@ -335,6 +375,54 @@ static void BM_STRtree2DNearest(benchmark::State& state) {
     }
 }
 
+// Compares tree packings; range(0) selects uniform (0) or clustered (1) data
+template<TreePacking packing>
+static void BM_TemplateSTRtree2DConstructPacking(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto envelopes = state.range(0) ? generate_clustered_envelopes(eng, extent, 100000, 20)
+                                    : generate_envelopes(eng, extent, 100000);
+
+    for (auto _ : state) {
+        TemplateSTRtree<const Envelope*> tree;
+        tree.setPacking(packing);
+        for (auto& e : envelopes) {
+            tree.insert(e, &e);
+        }
+        tree.build();
+    }
+}
+
+template<TreePacking packing>
+static void BM_TemplateSTRtree2DQueryPacking(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto envelopes = state.range(0) ? generate_clustered_envelopes(eng, extent, 100000, 20)
+                                    : generate_envelopes(eng, extent, 100000);
+
+    TemplateSTRtree<const Envelope*> tree;
+    tree.setPacking(packing);
+    for (auto& e : envelopes) {
+        tree.insert(e, &e);
+    }
+    tree.build();
+
+    std::size_t visits = 0;
+    for (const auto& e : envelopes) {
+        visits += countNodeVisits(*tree.getRoot(), e);
+    }
+
+    for (auto _ : state) {
+        Counter<const Envelope*> c;
+        for (const auto& e : envelopes) {
+            tree.query(e, c);
+        }
+        benchmark::DoNotOptimize(c.hits);
+    }
+
+    state.counters["nodeVisitsPerQuery"] = static_cast<double>(visits) / static_cast<double>(envelopes.size());
+}
+
 BENCHMARK_TEMPLATE(BM_STRtree1DConstruct, SortedPackedIntervalRTree);
 BENCHMARK_TEMPLATE(BM_STRtree1DConstruct, TemplateIntervalTree);
 BENCHMARK_TEMPLATE(BM_STRtree1DQuery, SortedPackedIntervalRTree);
@@ -354,6 +442,11 @@ BENCHMARK_TEMPLATE(BM_STRtree2DQuery, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, TemplateSTRtree<const Envelope*>);
 
+BENCHMARK_TEMPLATE(BM_TemplateSTRtree2DConstructPacking, TreePacking::STR)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_TemplateSTRtree2DConstructPacking, TreePacking::HILBERT)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_TemplateSTRtree2DQueryPacking, TreePacking::STR)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_TemplateSTRtree2DQueryPacking, TreePacking::HILBERT)->Arg(0)->Arg(1);
+
 BENCHMARK(BM_STRtree2DQueryPairs);
 BENCHMARK(BM_STRtree2DQueryPairsNaive);
 
@@ -0,0 +1,94 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/profiler.h>
+
+#include <BenchmarkUtils.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+
+/*
+ * Creates WKT for a grid of polygons with full-precision
+ * coordinates, as in a dump of real data.
+ */
+static std::vector<std::string>
+createWKT(std::size_t nGeoms, std::size_t nPts)
+{
+    Envelope env(0, 1000, 0, 1000);
+    auto geoms = geos::benchmark::createGeometriesOnGrid(env, nGeoms, [nPts](const CoordinateXY& base) {
+        return geos::benchmark::createSineStar(base, 10.0, nPts);
+    });
+
+    geos::io::WKTWriter writer;
+    std::vector<std::string> wkt;
+    for (const auto& g : geoms) {
+        wkt.push_back(writer.write(g.get()));
+    }
+    return wkt;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 3) {
+        std::cout << "perf_wktreader measures the throughput of WKTReader" << std::endl;
+        std::cout << "on a file with one WKT geometry per line, or on" << std::endl;
+        std::cout << "generated polygons if no file is given." << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: perf_wktreader [wktfile] [nreps]" << std::endl;
+        return 0;
+    }
+
+    std::vector<std::string> lines;
+    if (argc > 1) {
+        std::ifstream f(argv[1]);
+        std::string line;
+        while (std::getline(f, line)) {
+            lines.push_back(line);
+        }
+    } else {
+        lines = createWKT(10000, 500);
+    }
+    long nReps = argc > 2 ? std::max(1L, std::atol(argv[2])) : 3;
+
+    std::size_t nBytes = 0;
+    for (const auto& line : lines) {
+        nBytes += line.size();
+    }
+    std::cout << "Parsing " << lines.size() << " geometries (" << nBytes << " bytes)" << std::endl;
+
+    geos::io::WKTReader reader;
+    geos::util::Profile sw("WKTReader");
+    std::size_t nPoints = 0;
+    for (long i = 0; i < nReps; i++) {
+        sw.start();
+        for (const auto& line : lines) {
+            nPoints += reader.read(line)->getNumPoints();
+        }
+        sw.stop();
+    }
+
+    double mbPerSec = static_cast<double>(nBytes) / sw.getMin();
+    std::cout << "Read " << nPoints / static_cast<std::size_t>(nReps) << " points in "
+              << sw.getMin() / 1e6 << " s (" << mbPerSec << " MB/s)" << std::endl;
+}
@@ -21,6 +21,8 @@
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKBWriter.h>
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
 #include <geos/operation/buffer/BufferParameters.h>
@@ -47,6 +49,8 @@
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
 #define GEOSWKBWriter geos::io::WKBWriter
+#define GEOSTWKBReader geos::io::TWKBReader
+#define GEOSTWKBWriter geos::io::TWKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
 
@@ -84,6 +88,8 @@ using geos::io::WKTReader;
 using geos::io::WKTWriter;
 using geos::io::WKBReader;
 using geos::io::WKBWriter;
+using geos::io::TWKBReader;
+using geos::io::TWKBWriter;
 using geos::io::GeoJSONReader;
 using geos::io::GeoJSONWriter;
 
@@ -613,6 +619,12 @@ extern "C" {
         return GEOSUnaryUnion_r(handle, g);
     }
 
+    Geometry*
+    GEOSUnaryUnionParallel(const Geometry* g, unsigned int numThreads)
+    {
+        return GEOSUnaryUnionParallel_r(handle, g, numThreads);
+    }
+
     Geometry*
     GEOSUnaryUnionPrec(const Geometry* g, double gridSize)
     {
@@ -1423,6 +1435,20 @@ extern "C" {
         return GEOSWKBWriter_writeHEX_r(handle, writer, geom, size);
     }
 
+    std::size_t
+    GEOSWKBWriter_writeToBuffer(WKBWriter* writer, const Geometry* geom, unsigned char* buf, std::size_t bufSize)
+    {
+        return GEOSWKBWriter_writeToBuffer_r(handle, writer, geom, buf, bufSize);
+    }
+
+    /* The caller owns the result */
+    unsigned char*
+    GEOSWKBWriter_writeMany(WKBWriter* writer, const Geometry* const geoms[], std::size_t ngeoms,
+                            std::size_t* offsets, std::size_t* size)
+    {
+        return GEOSWKBWriter_writeMany_r(handle, writer, geoms, ngeoms, offsets, size);
+    }
+
     int
     GEOSWKBWriter_getOutputDimension(const GEOSWKBWriter* writer)
     {
@@ -1471,6 +1497,68 @@ extern "C" {
         GEOSWKBWriter_setIncludeSRID_r(handle, writer, newIncludeSRID);
     }
 
+    /* TWKB Reader */
+    TWKBReader*
+    GEOSTWKBReader_create()
+    {
+        return GEOSTWKBReader_create_r(handle);
+    }
+
+    void
+    GEOSTWKBReader_destroy(TWKBReader* reader)
+    {
+        GEOSTWKBReader_destroy_r(handle, reader);
+    }
+
+    Geometry*
+    GEOSTWKBReader_read(TWKBReader* reader, const unsigned char* twkb, std::size_t size)
+    {
+        return GEOSTWKBReader_read_r(handle, reader, twkb, size);
+    }
+
+    /* TWKB Writer */
+    TWKBWriter*
+    GEOSTWKBWriter_create()
+    {
+        return GEOSTWKBWriter_create_r(handle);
+    }
+
+    void
+    GEOSTWKBWriter_destroy(TWKBWriter* writer)
+    {
+        GEOSTWKBWriter_destroy_r(handle, writer);
+    }
+
+    unsigned char*
+    GEOSTWKBWriter_write(TWKBWriter* writer, const Geometry* geom, std::size_t* size)
+    {
+        return GEOSTWKBWriter_write_r(handle, writer, geom, size);
+    }
+
+    void
+    GEOSTWKBWriter_setPrecision(TWKBWriter* writer, int precisionXY, int precisionZ, int precisionM)
+    {
+        GEOSTWKBWriter_setPrecision_r(handle, writer, precisionXY, precisionZ, precisionM);
+    }
+
+    void
+    GEOSTWKBWriter_setOutputDimension(TWKBWriter* writer, int newDimension)
+    {
+        GEOSTWKBWriter_setOutputDimension_r(handle, writer, newDimension);
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeBBox(TWKBWriter* writer, char includeBBox)
+    {
+        GEOSTWKBWriter_setIncludeBBox_r(handle, writer, includeBBox);
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeSize(TWKBWriter* writer, char includeSize)
+    {
+        GEOSTWKBWriter_setIncludeSize_r(handle, writer, includeSize);
+    }
+
     int
     GEOS_printDouble(double d, unsigned int precision, char *result) {
         return WKTWriter::writeTrimmedNumber(d, precision, result);
@@ -1514,6 +1602,32 @@ extern "C" {
         return GEOSGeoJSONWriter_writeGeometry_r(handle, writer, g, indent);
     }
 
+    int
+    GEOSGeoArrow_read(int geomType, int hasZ, int hasM,
+                      const double* coords, size_t ncoords,
+                      const int32_t* geomOffsets,
+                      const int32_t* partOffsets,
+                      const int32_t* ringOffsets,
+                      unsigned int ngeoms,
+                      Geometry** geoms)
+    {
+        return GEOSGeoArrow_read_r(handle, geomType, hasZ, hasM, coords, ncoords,
+                                   geomOffsets, partOffsets, ringOffsets, ngeoms, geoms);
+    }
+
+    int
+    GEOSGeoArrow_write(const Geometry* const geoms[],
+                       unsigned int ngeoms,
+                       int* geomType, int* hasZ, int* hasM,
+                       double** coords, std::size_t* ncoords,
+                       int32_t** geomOffsets,
+                       int32_t** partOffsets,
+                       int32_t** ringOffsets)
+    {
+        return GEOSGeoArrow_write_r(handle, geoms, ngeoms, geomType, hasZ, hasM,
+                                    coords, ncoords, geomOffsets, partOffsets, ringOffsets);
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -1585,6 +1699,48 @@ extern "C" {
         return GEOSPreparedIntersectsXY_r(handle, pg1, x, y);
     }
 
+    int
+    GEOSPreparedIntersectsMany(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* const geoms[],
+                               unsigned int ngeoms, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedIntersectsMany_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedContainsMany(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* const geoms[],
+                             unsigned int ngeoms, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedContainsMany_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedContainsProperlyMany(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* const geoms[],
+                                     unsigned int ngeoms, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedContainsProperlyMany_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedCoversMany(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* const geoms[],
+                           unsigned int ngeoms, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedCoversMany_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedIntersectsXYMany(const geos::geom::prep::PreparedGeometry* pg1, const double* x, const double* y,
+                                 unsigned int npoints, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedIntersectsXYMany_r(handle, pg1, x, y, npoints, results, numThreads);
+    }
+
+    int
+    GEOSPreparedContainsXYMany(const geos::geom::prep::PreparedGeometry* pg1, const double* x, const double* y,
+                               unsigned int npoints, char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedContainsXYMany_r(handle, pg1, x, y, npoints, results, numThreads);
+    }
+
     char
     GEOSPreparedOverlaps(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
     {
@@ -1645,6 +1801,12 @@ extern "C" {
         return GEOSSTRtree_build_r(handle, tree);
     }
 
+    int
+    GEOSSTRtree_buildParallel(GEOSSTRtree* tree, unsigned int numThreads)
+    {
+        return GEOSSTRtree_buildParallel_r(handle, tree, numThreads);
+    }
+
     void
     GEOSSTRtree_insert(GEOSSTRtree* tree,
                        const geos::geom::Geometry* g,
@@ -1662,6 +1824,17 @@ extern "C" {
         GEOSSTRtree_query_r(handle, tree, g, cb, userdata);
     }
 
+    int
+    GEOSSTRtree_queryBatch(GEOSSTRtree* tree,
+                           const geos::geom::Geometry* const geoms[],
+                           unsigned int ngeoms,
+                           GEOSQueryBatchCallback cb,
+                           void* userdata,
+                           unsigned int numThreads)
+    {
+        return GEOSSTRtree_queryBatch_r(handle, tree, geoms, ngeoms, cb, userdata, numThreads);
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest(GEOSSTRtree* tree,
                         const geos::geom::Geometry* g)
@@ -1700,6 +1873,18 @@ extern "C" {
         GEOSSTRtree_destroy_r(handle, tree);
     }
 
+    unsigned char*
+    GEOSSTRtree_save(GEOSSTRtree* tree, std::size_t* size)
+    {
+        return GEOSSTRtree_save_r(handle, tree, size);
+    }
+
+    GEOSSTRtree*
+    GEOSSTRtree_load(const unsigned char* buf, std::size_t size)
+    {
+        return GEOSSTRtree_load_r(handle, buf, size);
+    }
+
     double
     GEOSProject(const geos::geom::Geometry* g,
                 const geos::geom::Geometry* p)
@@ -34,6 +34,7 @@
 #include <geos/geom/CircularString.h>
 #include <geos/geom/CompoundCurve.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateColumns.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Curve.h>
 #include <geos/geom/CurvePolygon.h>
@@ -59,13 +60,18 @@
 #include <geos/geom/util/Densifier.h>
 #include <geos/geom/util/GeometryFixer.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/index/strtree/FlatSTRtree.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBWriter.h>
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
 #include <geos/linearref/LengthIndexedLine.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
@@ -89,6 +95,7 @@
 #include <geos/operation/sharedpaths/SharedPathsOp.h>
 #include <geos/operation/union/CascadedPolygonUnion.h>
 #include <geos/operation/union/DisjointSubsetUnion.h>
+#include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
@@ -111,6 +118,7 @@
 #include <geos/version.h>
 
 // This should go away
+#include <algorithm>
 #include <cmath> // finite
 #include <cstdarg>
 #include <cstddef>
@@ -141,6 +149,8 @@
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
 #define GEOSWKBWriter geos::io::WKBWriter
+#define GEOSTWKBReader geos::io::TWKBReader
+#define GEOSTWKBWriter geos::io::TWKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
 
@@ -192,6 +202,8 @@ using geos::io::WKTReader;
 using geos::io::WKTWriter;
 using geos::io::WKBReader;
 using geos::io::WKBWriter;
+using geos::io::TWKBReader;
+using geos::io::TWKBWriter;
 using geos::io::GeoJSONReader;
 using geos::io::GeoJSONWriter;
 
@@ -205,6 +217,7 @@ using geos::operation::buffer::BufferParameters;
 using geos::operation::buffer::OffsetCurve;
 using geos::operation::distance::IndexedFacetDistance;
 using geos::operation::geounion::CascadedPolygonUnion;
+using geos::operation::geounion::UnaryUnionOp;
 using geos::operation::overlayng::OverlayNG;
 using geos::operation::overlayng::UnaryUnionNG;
 using geos::operation::overlayng::OverlayNGRobust;
@@ -410,6 +423,34 @@ gstrdup(std::string const& str)
     return gstrdup_s(str.c_str(), str.size());
 }
 
+// Run a batch predicate that fills an array of bool and copy
+// its results into the caller-supplied array of char.
+template<typename F>
+void
+copyBatchResults(std::size_t n, char* results, F&& f)
+{
+    std::unique_ptr<bool[]> res(new bool[n]);
+    f(res.get());
+    std::copy(res.get(), res.get() + n, results);
+}
+
+// Copy a vector into a buffer to be freed with GEOSFree,
+// or return nullptr for an empty vector.
+template<typename T>
+T*
+mallocCopy(const std::vector<T>& v)
+{
+    if (v.empty()) {
+        return nullptr;
+    }
+    T* out = static_cast<T*>(malloc(v.size() * sizeof(T)));
+    if (out == nullptr) {
+        throw std::runtime_error("Failed to allocate memory for buffer");
+    }
+    std::memcpy(out, v.data(), v.size() * sizeof(T));
+    return out;
+}
+
 } // namespace anonymous
 
 // Execute a lambda, using the given context handle to process errors.
@@ -987,14 +1028,11 @@ extern "C" {
 
             int byteOrder = handle->WKBByteOrder;
             WKBWriter w(handle->WKBOutputDims, byteOrder);
-            std::ostringstream os(std::ios_base::binary);
-            w.write(*g, os);
-            std::string wkbstring(os.str());
-            const std::size_t len = wkbstring.length();
+            const std::size_t len = w.getWkbSize(*g);
 
             unsigned char* result = static_cast<unsigned char*>(malloc(len));
             if(result) {
-                std::memcpy(result, wkbstring.c_str(), len);
+                w.write(*g, result);
                 *size = len;
             }
             return result;
@@ -1557,6 +1595,18 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSUnaryUnionParallel_r(GEOSContextHandle_t extHandle, const Geometry* g, unsigned int numThreads)
+    {
+        return execute(extHandle, [&]() {
+            UnaryUnionOp op(*g);
+            op.setNumThreads(numThreads);
+            std::unique_ptr<Geometry> g3(op.Union());
+            g3->setSRID(g->getSRID());
+            return g3.release();
+        });
+    }
+
     Geometry*
     GEOSUnaryUnionPrec_r(GEOSContextHandle_t extHandle, const Geometry* g1, double gridSize)
     {
@@ -2623,19 +2673,7 @@ extern "C" {
                                 double* x, double* y, double* z, double* m)
     {
         return execute(extHandle, 0, [&]() {
-            CoordinateXYZM c;
-            for (std::size_t i = 0; i < cs->size(); i++) {
-                cs->getAt(i, c);
-                x[i] = c.x;
-                y[i] = c.y;
-                if (z) {
-                    z[i] = c.z;
-                }
-                if (m) {
-                    m[i] = c.m;
-                }
-            }
-
+            geos::geom::CoordinateColumns::copyToArrays(*cs, x, y, z, m);
             return 1;
         });
     }
@@ -3462,15 +3500,13 @@ extern "C" {
     GEOSWKBWriter_write_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom, std::size_t* size)
     {
         return execute(extHandle, [&]() {
-            std::ostringstream os(std::ios_base::binary);
-            writer->write(*geom, os);
-
-            const std::string& wkbstring = os.str();
-            const std::size_t len = wkbstring.length();
+            const std::size_t len = writer->getWkbSize(*geom);
 
             unsigned char* result = (unsigned char*) malloc(len);
-            std::memcpy(result, wkbstring.c_str(), len);
-            *size = len;
+            if(result) {
+                writer->write(*geom, result);
+                *size = len;
+            }
             return result;
         });
     }
@@ -3492,6 +3528,44 @@ extern "C" {
         });
     }
 
+    std::size_t
+    GEOSWKBWriter_writeToBuffer_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom,
+                                  unsigned char* buf, std::size_t bufSize)
+    {
+        return execute(extHandle, std::size_t(0), [&]() {
+            const std::size_t len = writer->getWkbSize(*geom);
+            if(len <= bufSize) {
+                writer->write(*geom, buf);
+            }
+            return len;
+        });
+    }
+
+    /* The caller owns the result */
+    unsigned char*
+    GEOSWKBWriter_writeMany_r(GEOSContextHandle_t extHandle, WKBWriter* writer,
+                              const Geometry* const geoms[], std::size_t ngeoms,
+                              std::size_t* offsets, std::size_t* size)
+    {
+        return execute(extHandle, [&]() {
+            offsets[0] = 0;
+            for(std::size_t i = 0; i < ngeoms; i++) {
+                offsets[i + 1] = offsets[i] + writer->getWkbSize(*geoms[i]);
+            }
+            const std::size_t len = offsets[ngeoms];
+
+            // malloc(0) may return NULL, which would be taken for an error
+            unsigned char* result = (unsigned char*) malloc(std::max<std::size_t>(len, 1));
+            if(result) {
+                for(std::size_t i = 0; i < ngeoms; i++) {
+                    writer->write(*geoms[i], result + offsets[i]);
+                }
+                *size = len;
+            }
+            return result;
+        });
+    }
+
     int
     GEOSWKBWriter_getOutputDimension_r(GEOSContextHandle_t extHandle, const GEOSWKBWriter* writer)
     {
@@ -3556,6 +3630,106 @@ extern "C" {
         });
     }
 
+    /* TWKB Reader */
+    TWKBReader*
+    GEOSTWKBReader_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            return new TWKBReader(*(GeometryFactory*)handle->geomFactory);
+        });
+    }
+
+    void
+    GEOSTWKBReader_destroy_r(GEOSContextHandle_t extHandle, TWKBReader* reader)
+    {
+        execute(extHandle, [&]() {
+            delete reader;
+        });
+    }
+
+    Geometry*
+    GEOSTWKBReader_read_r(GEOSContextHandle_t extHandle, TWKBReader* reader, const unsigned char* twkb, std::size_t size)
+    {
+        return execute(extHandle, [&]() {
+            return reader->read(twkb, size).release();
+        });
+    }
+
+    /* TWKB Writer */
+    TWKBWriter*
+    GEOSTWKBWriter_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            return new TWKBWriter();
+        });
+    }
+
+    void
+    GEOSTWKBWriter_destroy_r(GEOSContextHandle_t extHandle, TWKBWriter* writer)
+    {
+        execute(extHandle, [&]() {
+            delete writer;
+        });
+    }
+
+    /* The caller owns the result */
+    unsigned char*
+    GEOSTWKBWriter_write_r(GEOSContextHandle_t extHandle, TWKBWriter* writer, const Geometry* geom, std::size_t* size)
+    {
+        return execute(extHandle, [&]() {
+            std::vector<unsigned char> twkb;
+            writer->write(*geom, twkb);
+
+            unsigned char* result = (unsigned char*) malloc(twkb.size());
+            if(result) {
+                std::memcpy(result, twkb.data(), twkb.size());
+                *size = twkb.size();
+            }
+            return result;
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setPrecision_r(GEOSContextHandle_t extHandle, TWKBWriter* writer, int precisionXY, int precisionZ, int precisionM)
+    {
+        execute(extHandle, [&]() {
+            // Check all three values before changing any of them
+            TWKBWriter check;
+            check.setPrecision(precisionXY);
+            check.setPrecisionZ(precisionZ);
+            check.setPrecisionM(precisionM);
+
+            writer->setPrecision(precisionXY);
+            writer->setPrecisionZ(precisionZ);
+            writer->setPrecisionM(precisionM);
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setOutputDimension_r(GEOSContextHandle_t extHandle, TWKBWriter* writer, int newDimension)
+    {
+        execute(extHandle, [&]() {
+            writer->setOutputDimension(static_cast<uint8_t>(newDimension));
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeBBox_r(GEOSContextHandle_t extHandle, TWKBWriter* writer, char includeBBox)
+    {
+        execute(extHandle, [&]() {
+            writer->setIncludeBoundingBox(includeBBox != 0);
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeSize_r(GEOSContextHandle_t extHandle, TWKBWriter* writer, char includeSize)
+    {
+        execute(extHandle, [&]() {
+            writer->setIncludeSize(includeSize != 0);
+        });
+    }
+
     /* GeoJSON Reader */
     GeoJSONReader*
     GEOSGeoJSONReader_create_r(GEOSContextHandle_t extHandle)
@@ -3619,6 +3793,68 @@ extern "C" {
         });
     }
 
+//-----------------------------------------------------------------
+// GeoArrow
+//-----------------------------------------------------------------
+
+    int
+    GEOSGeoArrow_read_r(GEOSContextHandle_t extHandle,
+                        int geomType, int hasZ, int hasM,
+                        const double* coords, size_t ncoords,
+                        const int32_t* geomOffsets,
+                        const int32_t* partOffsets,
+                        const int32_t* ringOffsets,
+                        unsigned int ngeoms,
+                        Geometry** geoms)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+
+            geos::io::GeoArrowBuffers buffers {
+                static_cast<geos::geom::GeometryTypeId>(geomType), hasZ != 0, hasM != 0, ngeoms,
+                coords, ncoords, geomOffsets, partOffsets, ringOffsets
+            };
+
+            geos::io::GeoArrowReader reader(*handle->geomFactory);
+            auto result = reader.read(buffers);
+            for (std::size_t i = 0; i < result.size(); i++) {
+                geoms[i] = result[i].release();
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSGeoArrow_write_r(GEOSContextHandle_t extHandle,
+                         const Geometry* const geoms[],
+                         unsigned int ngeoms,
+                         int* geomType, int* hasZ, int* hasM,
+                         double** coords, std::size_t* ncoords,
+                         int32_t** geomOffsets,
+                         int32_t** partOffsets,
+                         int32_t** ringOffsets)
+    {
+        return execute(extHandle, 0, [&]() {
+            geos::io::GeoArrowWriter writer;
+            auto arr = writer.write(geoms, ngeoms);
+
+            std::unique_ptr<double, decltype(&free)> coordBuf(mallocCopy(arr.coords), free);
+            std::unique_ptr<int32_t, decltype(&free)> geomBuf(mallocCopy(arr.geomOffsets), free);
+            std::unique_ptr<int32_t, decltype(&free)> partBuf(mallocCopy(arr.partOffsets), free);
+            std::unique_ptr<int32_t, decltype(&free)> ringBuf(mallocCopy(arr.ringOffsets), free);
+
+            *geomType = static_cast<int>(arr.type);
+            *hasZ = arr.hasZ;
+            *hasM = arr.hasM;
+            *ncoords = arr.getNumCoordinates();
+            *coords = coordBuf.release();
+            *geomOffsets = geomBuf.release();
+            *partOffsets = partBuf.release();
+            *ringOffsets = ringBuf.release();
+            return 1;
+        });
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -3721,6 +3957,90 @@ extern "C" {
         return GEOSPreparedIntersects_r(extHandle, pg, extHandle->point2d.get());
     }
 
+    int
+    GEOSPreparedIntersectsMany_r(GEOSContextHandle_t extHandle,
+                                 const geos::geom::prep::PreparedGeometry* pg,
+                                 const Geometry* const geoms[], unsigned int ngeoms,
+                                 char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(ngeoms, results, [&](bool* res) {
+                pg->intersectsMany(geoms, ngeoms, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedContainsMany_r(GEOSContextHandle_t extHandle,
+                               const geos::geom::prep::PreparedGeometry* pg,
+                               const Geometry* const geoms[], unsigned int ngeoms,
+                               char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(ngeoms, results, [&](bool* res) {
+                pg->containsMany(geoms, ngeoms, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedContainsProperlyMany_r(GEOSContextHandle_t extHandle,
+                                       const geos::geom::prep::PreparedGeometry* pg,
+                                       const Geometry* const geoms[], unsigned int ngeoms,
+                                       char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(ngeoms, results, [&](bool* res) {
+                pg->containsProperlyMany(geoms, ngeoms, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedCoversMany_r(GEOSContextHandle_t extHandle,
+                             const geos::geom::prep::PreparedGeometry* pg,
+                             const Geometry* const geoms[], unsigned int ngeoms,
+                             char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(ngeoms, results, [&](bool* res) {
+                pg->coversMany(geoms, ngeoms, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedIntersectsXYMany_r(GEOSContextHandle_t extHandle,
+                                   const geos::geom::prep::PreparedGeometry* pg,
+                                   const double* x, const double* y, unsigned int npoints,
+                                   char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(npoints, results, [&](bool* res) {
+                pg->intersectsXYMany(x, y, npoints, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedContainsXYMany_r(GEOSContextHandle_t extHandle,
+                                 const geos::geom::prep::PreparedGeometry* pg,
+                                 const double* x, const double* y, unsigned int npoints,
+                                 char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            copyBatchResults(npoints, results, [&](bool* res) {
+                pg->containsXYMany(x, y, npoints, res, numThreads);
+            });
+            return 1;
+        });
+    }
+
     char
     GEOSPreparedOverlaps_r(GEOSContextHandle_t extHandle,
                            const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
@@ -3821,6 +4141,17 @@ extern "C" {
         });
     }
 
+    int
+    GEOSSTRtree_buildParallel_r(GEOSContextHandle_t extHandle,
+                                GEOSSTRtree* tree,
+                                unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            tree->build(numThreads);
+            return 1;
+        });
+    }
+
     void
     GEOSSTRtree_insert_r(GEOSContextHandle_t extHandle,
                          GEOSSTRtree* tree,
@@ -3845,6 +4176,29 @@ extern "C" {
         });
     }
 
+    int
+    GEOSSTRtree_queryBatch_r(GEOSContextHandle_t extHandle,
+                             GEOSSTRtree* tree,
+                             const Geometry* const geoms[],
+                             unsigned int ngeoms,
+                             GEOSQueryBatchCallback callback,
+                             void* userdata,
+                             unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<Envelope> envs;
+            envs.reserve(ngeoms);
+            for (unsigned int i = 0; i < ngeoms; i++) {
+                envs.push_back(*geoms[i]->getEnvelopeInternal());
+            }
+
+            tree->queryBatch(envs, [callback, userdata](std::size_t i, void* item) {
+                callback(item, static_cast<unsigned int>(i), userdata);
+            }, numThreads);
+            return 1;
+        });
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest_r(GEOSContextHandle_t extHandle,
                           GEOSSTRtree* tree,
@@ -3930,6 +4284,55 @@ extern "C" {
         });
     }
 
+    /* The caller owns the result */
+    unsigned char*
+    GEOSSTRtree_save_r(GEOSContextHandle_t extHandle,
+                       GEOSSTRtree* tree,
+                       std::size_t* size)
+    {
+        using geos::index::strtree::FlatSTRtree;
+
+        return execute(extHandle, [&]() {
+            auto buf = FlatSTRtree<std::int64_t>::serialize(*tree, [](void* item) {
+                return static_cast<std::int64_t>(reinterpret_cast<std::intptr_t>(item));
+            });
+
+            unsigned char* result = (unsigned char*) malloc(buf.size());
+            if(result) {
+                std::memcpy(result, buf.data(), buf.size());
+                *size = buf.size();
+            }
+            return result;
+        });
+    }
+
+    GEOSSTRtree*
+    GEOSSTRtree_load_r(GEOSContextHandle_t extHandle,
+                       const unsigned char* buf,
+                       std::size_t size)
+    {
+        using geos::index::strtree::FlatSTRtree;
+
+        return execute(extHandle, [&]() {
+            // FlatSTRtree requires 8-byte alignment
+            std::vector<std::uint64_t> aligned;
+            const void* data = buf;
+            if (reinterpret_cast<std::uintptr_t>(buf) % 8 != 0) {
+                aligned.resize((size + 7) / 8);
+                std::memcpy(aligned.data(), buf, size);
+                data = aligned.data();
+            }
+
+            FlatSTRtree<std::int64_t> flat(data, size);
+
+            auto tree = geos::detail::make_unique<GEOSSTRtree>(flat.getNodeCapacity());
+            flat.copyTo(*tree, [](std::int64_t item) {
+                return reinterpret_cast<void*>(static_cast<std::intptr_t>(item));
+            });
+            return tree.release();
+        });
+    }
+
     double
     GEOSProject_r(GEOSContextHandle_t extHandle,
                   const Geometry* g,
@@ -25,6 +25,7 @@
 namespace geos {
 
 namespace geom {
+class CoordinateColumns;
 class Curve;
 }
 
@@ -74,6 +75,16 @@ public:
     */
     static double ofRingSigned(const geom::CoordinateSequence* ring);
 
+    /**
+    * Computes the signed area for a ring whose coordinates are stored in
+    * columns. Gives the same result as ofRingSigned(const CoordinateSequence*).
+    *
+    * @param ring
+    *          the coordinates forming the ring
+    * @return the signed area of the ring
+    */
+    static double ofRingSigned(const geom::CoordinateColumns& ring);
+
 };
 
 
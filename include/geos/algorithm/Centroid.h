@@ -97,7 +97,6 @@ public:
 private:
 
     std::unique_ptr<geom::CoordinateXY> areaBasePt;
-    geom::CoordinateXY triangleCent3;
     geom::CoordinateXY cg3;
     geom::CoordinateXY lineCentSum;
     geom::CoordinateXY ptCentSum;
@@ -120,22 +119,14 @@ private:
 
     void addHole(const geom::CoordinateSequence& pts);
 
-    void addTriangle(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1, const geom::CoordinateXY& p2,
-                     bool isPositiveArea);
-
     /**
-     * Computes three times the centroid of the triangle p1-p2-p3.
-     * The factor of 3 is
-     * left in to permit division to be avoided until later.
-     */
-    static void centroid3(const geom::CoordinateXY& p1, const geom::CoordinateXY& p2, const geom::CoordinateXY& p3,
-                          geom::CoordinateXY& c);
-
-    /**
-     * Returns twice the signed area of the triangle p1-p2-p3.
-     * The area is positive if the triangle is oriented CCW, and negative if CW.
+     * Adds the triangles formed by the area base point and each
+     * segment of a ring to the area centroid accumulators.
+     *
+     * @param pts the ring
+     * @param isPositiveArea whether the triangles add to the area
      */
-    static double area2(const geom::CoordinateXY& p1, const geom::CoordinateXY& p2, const geom::CoordinateXY& p3);
+    void addTriangles(const geom::CoordinateSequence& pts, bool isPositiveArea);
 
     /**
      * Adds the line segments defined by an array of coordinates
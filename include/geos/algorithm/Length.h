@@ -22,6 +22,12 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
 
+namespace geos {
+namespace geom {
+class CoordinateColumns;
+}
+}
+
 namespace geos {
 namespace algorithm { // geos::algorithm
 
@@ -41,6 +47,15 @@ public:
      */
     static double ofLine(const geom::CoordinateSequence* ring);
 
+    /**
+     * Computes the length of a linestring whose points are stored in columns.
+     * Gives the same result as ofLine(const CoordinateSequence*).
+     *
+     * @param pts the points specifying the linestring
+     * @return the length of the linestring
+     */
+    static double ofLine(const geom::CoordinateColumns& pts);
+
 };
 
 
@@ -113,6 +113,23 @@ public:
     void countSegment(const geom::CoordinateXY& p1,
                       const geom::CoordinateXY& p2);
 
+    /** \brief
+     * Counts a segment for a point whose crossing count and
+     * point-on-segment flag are kept by the caller, so that
+     * many points can be processed without a counter for each.
+     *
+     * @param point the point to test
+     * @param p1 an endpoint of the segment
+     * @param p2 another endpoint of the segment
+     * @param crossingCount the crossing count of the point
+     * @param isPointOnSegment set to `true` if the point lies on the segment
+     */
+    static void countSegment(const geom::CoordinateXY& point,
+                             const geom::CoordinateXY& p1,
+                             const geom::CoordinateXY& p2,
+                             std::size_t& crossingCount,
+                             bool& isPointOnSegment);
+
     void countArc(const geom::CoordinateXY& p1,
                   const geom::CoordinateXY& p2,
                   const geom::CoordinateXY& p3);
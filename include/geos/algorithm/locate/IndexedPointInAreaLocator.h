@@ -22,6 +22,7 @@
 #include <geos/index/strtree/TemplateSTRtree.h>
 
 #include <memory>
+#include <mutex>
 #include <vector> // composition
 
 namespace geos {
@@ -49,6 +50,8 @@ namespace locate { // geos::algorithm::locate
  * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
  *
  * The index is lazy-loaded, which allows creating instances even if they are not used.
+ * Loading happens at most once, so locate() may be called concurrently
+ * from several threads.
  *
  */
 class GEOS_DLL IndexedPointInAreaLocator : public PointOnGeometryLocator {
@@ -86,6 +89,8 @@ private:
     private:
 
         index::strtree::TemplateSTRtree<SegmentView, index::strtree::IntervalTraits> index;
+        std::size_t numSegments;
+        double meanSegmentHeight;
 
         void init(const geom::Geometry& g);
         void addLine(const geom::CoordinateSequence* pts);
@@ -97,10 +102,20 @@ private:
         void query(double min, double max, Visitor&& f) {
             index.query(index::strtree::Interval(min, max), f);
         }
+
+        std::size_t getNumSegments() const {
+            return numSegments;
+        }
+
+        /// Returns the mean Y extent of the indexed segments
+        double getMeanSegmentHeight() const {
+            return meanSegmentHeight;
+        }
     };
 
     const geom::Geometry& areaGeom;
     std::unique_ptr<IntervalIndexedGeometry> index;
+    std::once_flag indexBuilt;
 
     void buildIndex(const geom::Geometry& g);
 
@@ -131,6 +146,27 @@ public:
      */
     geom::Location locate(const geom::CoordinateXY* /*const*/ p) override;
 
+    using PointOnGeometryLocator::locateMany;
+
+    /** \brief
+     * Determines the [Location](@ref geom::Location) of many points,
+     * giving the same results as calling locate() for each of them.
+     *
+     * The points are processed in order of Y, in batches of points
+     * whose Y values are close together. The index is queried once for
+     * each batch, and each segment found is tested against the points of
+     * the batch that lie within its Y extent. For large numbers of points
+     * this is much faster than locating them one at a time, except for
+     * geometries with few segments, whose points are located one at a time.
+     *
+     * @param x the X ordinates of the points
+     * @param y the Y ordinates of the points
+     * @param n the number of points
+     * @param locations receives the location of each point
+     */
+    void locateMany(const double* x, const double* y, std::size_t n,
+                    geom::Location* locations) override;
+
 };
 
 } // geos::algorithm::locate
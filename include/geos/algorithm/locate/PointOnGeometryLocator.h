@@ -17,9 +17,12 @@
 
 #include <geos/geom/Location.h>
 
+#include <cstddef>
+
 namespace geos {
 namespace geom {
 class CoordinateXY;
+class CoordinateSequence;
 }
 }
 
@@ -48,6 +51,28 @@ public:
      * @return the location of the point in the geometry
      */
     virtual geom::Location locate(const geom::CoordinateXY* /*const*/ p) = 0;
+
+    /**
+     * Determines the [Location](@ref geom::Location) of many points.
+     * The default implementation calls locate() for each point;
+     * locators that can share work between points override it.
+     *
+     * @param x the X ordinates of the points
+     * @param y the Y ordinates of the points
+     * @param n the number of points
+     * @param locations receives the location of each point
+     */
+    virtual void locateMany(const double* x, const double* y, std::size_t n,
+                            geom::Location* locations);
+
+    /**
+     * Determines the [Location](@ref geom::Location) of each point of a
+     * sequence.
+     *
+     * @param pts the points to test
+     * @param locations receives the location of each point
+     */
+    void locateMany(const geom::CoordinateSequence& pts, geom::Location* locations);
 };
 
 } // geos::algorithm::locate
@@ -0,0 +1,107 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace geos {
+namespace geom {
+
+class CoordinateSequence;
+
+/**
+ * \brief
+ * A structure-of-arrays copy of the coordinates of a CoordinateSequence.
+ *
+ * CoordinateSequence stores the ordinates of each coordinate next to each
+ * other. CoordinateColumns stores each ordinate in its own contiguous
+ * array instead, which suits bulk kernels that process many coordinates
+ * at once, and exporters to columnar formats.
+ *
+ * The columns are a snapshot: they do not follow later changes to the
+ * sequence they were created from.
+ */
+class GEOS_DLL CoordinateColumns {
+
+public:
+
+    /**
+     * Copies the coordinates of a sequence into columns.
+     * Z and M columns are only created if the sequence has them.
+     */
+    explicit CoordinateColumns(const CoordinateSequence& seq);
+
+    std::size_t size() const {
+        return m_x.size();
+    }
+
+    bool isEmpty() const {
+        return m_x.empty();
+    }
+
+    bool hasZ() const {
+        return m_hasZ;
+    }
+
+    bool hasM() const {
+        return m_hasM;
+    }
+
+    const double* x() const {
+        return m_x.data();
+    }
+
+    const double* y() const {
+        return m_y.data();
+    }
+
+    /// Returns the Z column, or `nullptr` if the sequence has no Z.
+    const double* z() const {
+        return m_hasZ ? m_z.data() : nullptr;
+    }
+
+    /// Returns the M column, or `nullptr` if the sequence has no M.
+    const double* m() const {
+        return m_hasM ? m_m.data() : nullptr;
+    }
+
+    /// Computes the envelope of the coordinates.
+    Envelope getEnvelope() const;
+
+    /**
+     * Copies the ordinates of a sequence into separate arrays, each
+     * holding at least `seq.size()` values. Any of `z` and `m` may be
+     * `nullptr`. Ordinates the sequence does not have are set to NaN.
+     */
+    static void copyToArrays(const CoordinateSequence& seq, double* x, double* y, double* z, double* m);
+
+private:
+
+    std::vector<double> m_x;
+    std::vector<double> m_y;
+    std::vector<double> m_z;
+    std::vector<double> m_m;
+    bool m_hasZ;
+    bool m_hasM;
+
+};
+
+} // namespace geos::geom
+} // namespace geos
+
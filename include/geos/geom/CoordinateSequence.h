@@ -765,6 +765,11 @@ public:
         return m_vect.data();
     }
 
+    /// Returns the number of values stored for each coordinate in data().
+    std::uint8_t stride() const {
+        return m_stride;
+    }
+
 private:
     std::vector<double> m_vect; // Vector to store values
 
@@ -790,10 +795,6 @@ private:
                       DoubleNotANumber);
     }
 
-    std::uint8_t stride() const {
-        return m_stride;
-    }
-
 };
 
 GEOS_DLL std::ostream& operator<< (std::ostream& os, const CoordinateSequence& cs);
@@ -23,6 +23,9 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/operation/relateng/RelateNG.h>
 
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -59,14 +62,33 @@ class BasicPreparedGeometry: public PreparedGeometry {
 private:
     const geom::Geometry* baseGeom;
     std::vector<const CoordinateXY*> representativePts;
-    mutable std::unique_ptr<RelateNG> relate_ng;
-
-    RelateNG& getRelateNG() const
+    // RelateNG caches state while evaluating, so a prepared RelateNG is
+    // used by one call at a time. Idle instances are kept here and handed
+    // to the next call, so that calls from several threads each use their
+    // own instance instead of waiting for one another.
+    mutable std::vector<std::unique_ptr<RelateNG>> relate_ng_pool;
+    mutable std::mutex relate_ng_lock;
+
+    template<typename F>
+    auto withRelateNG(F&& f) const -> decltype(f(std::declval<RelateNG&>()))
     {
+        std::unique_ptr<RelateNG> relate_ng;
+        {
+            std::lock_guard<std::mutex> lock(relate_ng_lock);
+            if (!relate_ng_pool.empty()) {
+                relate_ng = std::move(relate_ng_pool.back());
+                relate_ng_pool.pop_back();
+            }
+        }
         if (relate_ng == nullptr)
             relate_ng = RelateNG::prepare(baseGeom);
 
-        return *relate_ng;
+        // an instance left by an exception is dropped, not reused
+        auto result = f(*relate_ng);
+
+        std::lock_guard<std::mutex> lock(relate_ng_lock);
+        relate_ng_pool.push_back(std::move(relate_ng));
+        return result;
     }
 
 protected:
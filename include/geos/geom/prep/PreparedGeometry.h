@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include <memory>
 #include <string>
@@ -31,6 +32,11 @@ namespace geos {
         class CoordinateSequence;
         class IntersectionMatrix;
     }
+    namespace algorithm {
+        namespace locate {
+            class PointOnGeometryLocator;
+        }
+    }
 }
 
 
@@ -54,6 +60,15 @@ namespace prep { // geos::geom::prep
  * See the implementing classes for documentation about which methods and situations
  * they optimize.
  *
+ * The structures used by a prepared geometry are built lazily, on first use,
+ * and each of them is built only once. The const methods of a PreparedGeometry
+ * may therefore be called concurrently from several threads, as long as the
+ * base geometry is neither modified nor destroyed while they run.
+ * Predicates which a subclass does not optimize are evaluated with a
+ * prepared RelateNG, which keeps state while it runs: concurrent calls
+ * to them each use a RelateNG of their own, with its own indexes, so
+ * memory use grows with the number of threads calling them at once.
+ *
  */
 class GEOS_DLL PreparedGeometry {
 public:
@@ -251,6 +266,97 @@ public:
      */
     virtual bool relate(const geom::Geometry* geom, const std::string& pat) const = 0;
 
+    /** \brief
+     * Tests whether the base {@link Geometry} intersects each of
+     * an array of geometries.
+     *
+     * This gives the same results as calling intersects() on each
+     * geometry in turn, optionally spreading the work over several threads.
+     *
+     * @param geoms the array of geometries to test
+     * @param n the number of geometries
+     * @param results an array of `n` values receiving the results
+     * @param numThreads maximum number of threads (0 = hardware concurrency)
+     */
+    void intersectsMany(const geom::Geometry* const* geoms, std::size_t n,
+                        bool* results, std::size_t numThreads = 1) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} contains each of
+     * an array of geometries.
+     *
+     * @see intersectsMany
+     */
+    void containsMany(const geom::Geometry* const* geoms, std::size_t n,
+                      bool* results, std::size_t numThreads = 1) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} properly contains each of
+     * an array of geometries.
+     *
+     * @see intersectsMany
+     */
+    void containsProperlyMany(const geom::Geometry* const* geoms, std::size_t n,
+                              bool* results, std::size_t numThreads = 1) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} covers each of
+     * an array of geometries.
+     *
+     * @see intersectsMany
+     */
+    void coversMany(const geom::Geometry* const* geoms, std::size_t n,
+                    bool* results, std::size_t numThreads = 1) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} intersects the point
+     * given by its coordinates.
+     *
+     * Polygonal geometries locate the point directly in their
+     * indexed point locator, without creating a Point geometry.
+     */
+    bool intersectsXY(double x, double y) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} intersects each of
+     * an array of points given by their coordinates.
+     *
+     * No Point geometry is created for the individual coordinates.
+     * Polygonal geometries locate the coordinates directly
+     * in their indexed point locator.
+     *
+     * @param x array of `n` X values
+     * @param y array of `n` Y values
+     * @param n the number of points
+     * @param results an array of `n` values receiving the results
+     * @param numThreads maximum number of threads (0 = hardware concurrency)
+     */
+    void intersectsXYMany(const double* x, const double* y, std::size_t n,
+                          bool* results, std::size_t numThreads = 1) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} contains each of
+     * an array of points given by their coordinates.
+     *
+     * @see intersectsXYMany
+     */
+    void containsXYMany(const double* x, const double* y, std::size_t n,
+                        bool* results, std::size_t numThreads = 1) const;
+
+protected:
+
+    /** \brief
+     * Gets an indexed locator for points in the base geometry,
+     * or `nullptr` if this preparation does not provide one.
+     *
+     * The locator builds its index only once, so it can be
+     * shared between threads.
+     */
+    virtual algorithm::locate::PointOnGeometryLocator* getIndexedPointLocator() const
+    {
+        return nullptr;
+    }
+
 };
 
 
@@ -24,7 +24,9 @@
 #include <geos/noding/SegmentString.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace geos {
 namespace noding {
@@ -56,6 +58,10 @@ private:
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> indexedPtOnGeomLoc;
     mutable noding::SegmentString::ConstVect segStrings;
     mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    mutable std::atomic<bool> ptOnGeomLocUsed;
+    mutable std::once_flag segIntFinderBuilt;
+    mutable std::once_flag indexedPtOnGeomLocBuilt;
+    mutable std::once_flag indexedDistanceBuilt;
 
 protected:
 public:
@@ -73,6 +79,9 @@ public:
     double distance(const geom::Geometry* g) const override;
     bool isWithinDistance(const geom::Geometry* g, double d) const override;
 
+protected:
+    algorithm::locate::PointOnGeometryLocator* getIndexedPointLocator() const override;
+
 };
 
 } // namespace geos::geom::prep
@@ -0,0 +1,363 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace geos {
+namespace index {
+namespace strtree {
+
+/**
+ * \brief
+ * A read-only view of a TemplateSTRtree that has been serialized to a
+ * flat, position-independent array of bytes.
+ *
+ * The serialized form holds a header, the node array of the tree in the
+ * order used by TemplateSTRtree (leaves first, root last), with children
+ * referenced by index rather than by address, and the item of each leaf.
+ * It can therefore be written to a file and later memory-mapped, and
+ * queried in place through a FlatSTRtree without any deserialization.
+ * It can also be loaded back into a TemplateSTRtree without re-sorting
+ * its nodes (see `copyTo`).
+ *
+ * Items must be trivially copyable, and are stored as raw bytes. Numbers
+ * are stored in the byte order of the writing machine; reading a tree
+ * written with a different byte order is refused.
+ *
+ * The view does not own or copy the bytes, which must outlive it and
+ * must be aligned on 8 bytes (as memory returned by `mmap` or `malloc` is).
+ */
+template<typename ItemType>
+class FlatSTRtree {
+    static_assert(std::is_trivially_copyable<ItemType>::value, "FlatSTRtree items must be trivially copyable");
+    static_assert(alignof(ItemType) <= 8, "FlatSTRtree items must not require more than 8-byte alignment");
+
+public:
+
+    /**
+     * Creates a view of a serialized tree.
+     *
+     * The header and every node are checked once here, so that queries
+     * on the view can follow the child indices without checking them.
+     *
+     * @param data the serialized tree, aligned on 8 bytes
+     * @param size the number of bytes available at `data`
+     * @throws util::IllegalArgumentException if the bytes do not hold a
+     *         tree with items of this type
+     */
+    FlatSTRtree(const void* data, std::size_t size)
+        : header(static_cast<const Header*>(data))
+    {
+        if (reinterpret_cast<std::uintptr_t>(data) % 8 != 0) {
+            throw util::IllegalArgumentException("FlatSTRtree: data must be aligned on 8 bytes");
+        }
+        if (size < sizeof(Header) || std::memcmp(header->magic, MAGIC, sizeof(header->magic)) != 0) {
+            throw util::IllegalArgumentException("FlatSTRtree: not a serialized STRtree");
+        }
+        if (header->version != VERSION) {
+            throw util::IllegalArgumentException("FlatSTRtree: unsupported version");
+        }
+        if (header->byteOrder != BYTE_ORDER_MARK) {
+            throw util::IllegalArgumentException("FlatSTRtree: serialized with a different byte order");
+        }
+        if (header->itemSize != sizeof(ItemType)) {
+            throw util::IllegalArgumentException("FlatSTRtree: item size does not match");
+        }
+        if (header->numItems > header->numNodes ||
+                header->numNodes > (size - sizeof(Header)) / sizeof(FlatNode) ||
+                serializedSize(header->numNodes, header->numItems) > size) {
+            throw util::IllegalArgumentException("FlatSTRtree: truncated data");
+        }
+
+        nodes = reinterpret_cast<const FlatNode*>(header + 1);
+        items = reinterpret_cast<const ItemType*>(nodes + header->numNodes);
+
+        // Children are stored before their parent, and every node but
+        // the root is the child of exactly one branch, so that a query
+        // visits each node at most once
+        std::vector<bool> isChild(static_cast<std::size_t>(header->numNodes));
+        std::uint64_t numChildren = 0;
+        for (std::size_t i = 0; i < header->numNodes; i++) {
+            const FlatNode& fn = nodes[i];
+            if (fn.flags & LEAF) {
+                if (fn.first >= header->numItems) {
+                    throw util::IllegalArgumentException("FlatSTRtree: invalid leaf node");
+                }
+            } else {
+                if (fn.count == 0 || fn.first > i || fn.count > i - fn.first) {
+                    throw util::IllegalArgumentException("FlatSTRtree: invalid branch node");
+                }
+                for (std::uint64_t j = fn.first; j < fn.first + fn.count; j++) {
+                    if (isChild[static_cast<std::size_t>(j)]) {
+                        throw util::IllegalArgumentException("FlatSTRtree: node with several parents");
+                    }
+                    isChild[static_cast<std::size_t>(j)] = true;
+                }
+                numChildren += fn.count;
+            }
+        }
+        if (header->numNodes > 0 && numChildren != header->numNodes - 1) {
+            throw util::IllegalArgumentException("FlatSTRtree: node with no parent");
+        }
+    }
+
+    /// Returns the number of leaf nodes in the tree, including removed ones.
+    std::size_t getNumLeafNodes() const {
+        return static_cast<std::size_t>(header->numItems);
+    }
+
+    /// Returns the maximum number of children of a node in the original tree.
+    std::size_t getNodeCapacity() const {
+        return static_cast<std::size_t>(header->nodeCapacity);
+    }
+
+    /**
+     * Query the tree, as TemplateSTRtree::query(). The visitor is called
+     * with each item whose bounds intersect `queryEnv`; if it returns a
+     * value, false values stop the query.
+     */
+    template<typename Visitor>
+    void query(const geom::Envelope& queryEnv, Visitor&& visitor) const {
+        if (header->numNodes == 0 || queryEnv.isNull()) {
+            return;
+        }
+
+        std::vector<const FlatNode*> stack;
+        stack.push_back(&nodes[header->numNodes - 1]);
+
+        while (!stack.empty()) {
+            const FlatNode* node = stack.back();
+            stack.pop_back();
+
+            if (!intersects(*node, queryEnv)) {
+                continue;
+            }
+
+            if (node->flags & LEAF) {
+                if (!(node->flags & DELETED)) {
+                    if (!visitItem(visitor, items[node->first])) {
+                        return;
+                    }
+                }
+            } else {
+                // pushed in reverse, so that children are visited in order
+                for (std::uint64_t i = node->first + node->count; i > node->first; i--) {
+                    stack.push_back(&nodes[i - 1]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Serializes a tree, building it first if necessary.
+     *
+     * @param tree the tree to serialize
+     * @param toItem a function converting the items of `tree` to `ItemType`
+     * @return the serialized tree
+     */
+    template<typename Tree, typename F>
+    static std::vector<unsigned char> serialize(Tree& tree, F&& toItem) {
+        tree.build();
+
+        const auto& treeNodes = tree.nodes;
+        const std::size_t numNodes = tree.root ? treeNodes.size() : 0;
+        const std::size_t numItems = tree.root ? tree.numItems : 0;
+
+        std::vector<unsigned char> buf(serializedSize(numNodes, numItems));
+
+        Header h;
+        std::memcpy(h.magic, MAGIC, sizeof(h.magic));
+        h.version = VERSION;
+        h.byteOrder = BYTE_ORDER_MARK;
+        h.itemSize = sizeof(ItemType);
+        h.nodeCapacity = static_cast<std::uint32_t>(tree.nodeCapacity);
+        h.numNodes = numNodes;
+        h.numItems = numItems;
+        std::memcpy(buf.data(), &h, sizeof(h));
+
+        unsigned char* nodeOut = buf.data() + sizeof(Header);
+        unsigned char* itemOut = nodeOut + numNodes * sizeof(FlatNode);
+
+        for (std::size_t i = 0; i < numNodes; i++) {
+            const auto& node = treeNodes[i];
+            const geom::Envelope& env = node.getBounds();
+
+            FlatNode fn;
+            fn.minX = env.getMinX();
+            fn.minY = env.getMinY();
+            fn.maxX = env.getMaxX();
+            fn.maxY = env.getMaxY();
+
+            if (node.isLeaf()) {
+                fn.first = i;
+                fn.count = 0;
+                if (node.isDeleted()) {
+                    // the item is left zeroed
+                    fn.flags = LEAF | DELETED;
+                } else {
+                    fn.flags = LEAF;
+                    ItemType item = toItem(node.getItem());
+                    std::memcpy(itemOut + i * sizeof(ItemType), &item, sizeof(ItemType));
+                }
+            } else {
+                fn.first = static_cast<std::uint64_t>(node.beginChildren() - treeNodes.data());
+                fn.count = static_cast<std::uint32_t>(node.endChildren() - node.beginChildren());
+                fn.flags = 0;
+            }
+
+            std::memcpy(nodeOut + i * sizeof(FlatNode), &fn, sizeof(fn));
+        }
+
+        return buf;
+    }
+
+    /// Serializes a tree whose items are of type `ItemType`.
+    template<typename Tree>
+    static std::vector<unsigned char> serialize(Tree& tree) {
+        return serialize(tree, [](const ItemType& item) {
+            return item;
+        });
+    }
+
+    /**
+     * Loads the serialized tree into an empty TemplateSTRtree, which is
+     * left in the built state. The nodes are copied as they are, so this
+     * is much faster than inserting the items and building the tree again.
+     *
+     * @param tree an empty tree
+     * @param fromItem a function converting `ItemType` to the items of `tree`
+     * @throws util::IllegalArgumentException if `tree` is not empty
+     */
+    template<typename Tree, typename F>
+    void copyTo(Tree& tree, F&& fromItem) const {
+        if (!tree.nodes.empty()) {
+            throw util::IllegalArgumentException("FlatSTRtree: can only be copied to an empty tree");
+        }
+
+        tree.nodeCapacity = static_cast<std::size_t>(header->nodeCapacity);
+        if (header->numNodes == 0) {
+            return;
+        }
+
+        tree.nodes.reserve(static_cast<std::size_t>(header->numNodes));
+        for (std::size_t i = 0; i < header->numNodes; i++) {
+            const FlatNode& fn = nodes[i];
+
+            // the child and item indices were checked by the constructor
+            if (fn.flags & LEAF) {
+                tree.nodes.emplace_back(fromItem(items[fn.first]),
+                                        geom::Envelope(fn.minX, fn.maxX, fn.minY, fn.maxY));
+                if (fn.flags & DELETED) {
+                    tree.nodes.back().removeItem();
+                }
+            } else {
+                const auto* begin = tree.nodes.data() + fn.first;
+                tree.nodes.emplace_back(begin, begin + fn.count);
+            }
+        }
+
+        tree.numItems = static_cast<std::size_t>(header->numItems);
+        tree.root = &tree.nodes.back();
+    }
+
+    /// Loads the serialized tree into an empty tree whose items are of type `ItemType`.
+    template<typename Tree>
+    void copyTo(Tree& tree) const {
+        copyTo(tree, [](const ItemType& item) {
+            return item;
+        });
+    }
+
+private:
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t itemSize;
+        std::uint32_t nodeCapacity;
+        std::uint64_t numNodes;
+        std::uint64_t numItems;
+    };
+
+    struct FlatNode {
+        double minX;
+        double minY;
+        double maxX;
+        double maxY;
+        std::uint64_t first; // leaf: item index; branch: index of first child
+        std::uint32_t count; // branch: number of children
+        std::uint32_t flags;
+    };
+
+    static_assert(sizeof(Header) % 8 == 0, "Header must preserve alignment");
+    static_assert(sizeof(FlatNode) % 8 == 0, "FlatNode must preserve alignment");
+
+    static constexpr char MAGIC[8] = { 'G', 'E', 'O', 'S', 'S', 'T', 'R', '\0' };
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    // FlatNode flags
+    enum : std::uint32_t {
+        LEAF = 1,
+        DELETED = 2
+    };
+
+    const Header* header;
+    const FlatNode* nodes;
+    const ItemType* items;
+
+    static std::size_t serializedSize(std::size_t numNodes, std::size_t numItems) {
+        std::size_t itemBytes = numItems * sizeof(ItemType);
+        // keep the total size a multiple of 8, so that buffers can be concatenated
+        itemBytes = (itemBytes + 7) / 8 * 8;
+        return sizeof(Header) + numNodes * sizeof(FlatNode) + itemBytes;
+    }
+
+    static bool intersects(const FlatNode& node, const geom::Envelope& env) {
+        return !(env.getMinX() > node.maxX || env.getMaxX() < node.minX ||
+                 env.getMinY() > node.maxY || env.getMaxY() < node.minY);
+    }
+
+    template<typename Visitor,
+             typename std::enable_if<std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr>
+    static bool visitItem(Visitor&& visitor, const ItemType& item) {
+        visitor(item);
+        return true;
+    }
+
+    template<typename Visitor,
+             typename std::enable_if<!std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr>
+    static bool visitItem(Visitor&& visitor, const ItemType& item) {
+        return visitor(item);
+    }
+};
+
+template<typename ItemType>
+constexpr char FlatSTRtree<ItemType>::MAGIC[8];
+
+}
+}
+}
+
@@ -14,25 +14,51 @@
 
 #pragma once
 
+#include <geos/constants.h>
 #include <geos/geom/Geometry.h>
 #include <geos/index/SpatialIndex.h> // for inheritance
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/shape/fractal/HilbertCode.h>
 #include <geos/util.h>
+#include <geos/util/Parallel.h>
 
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 #include <geos/index/strtree/TemplateSTRtreeDistance.h>
 #include <geos/index/strtree/Interval.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 #include <queue>
 #include <mutex>
+#include <utility>
 
 namespace geos {
 namespace index {
 namespace strtree {
 
+template<typename ItemType>
+class FlatSTRtree;
+
+/**
+ * \brief
+ * Methods of grouping the nodes of a TemplateSTRtree into parent nodes
+ * when the tree is built.
+ */
+enum class TreePacking {
+    /// Sort-Tile-Recursive: nodes are sorted into vertical slices, which
+    /// are then packed bottom-to-top.
+    STR,
+    /// Leaf nodes are sorted along a Hilbert curve through their centres,
+    /// and nodes are packed in that order at every level. This usually
+    /// gives tighter nodes for clustered data. For one-dimensional bounds
+    /// the nodes are simply sorted.
+    HILBERT
+};
+
 /**
  * \brief
  * A query-only R-tree created using the Sort-Tile-Recursive (STR) algorithm.
@@ -52,6 +78,9 @@ namespace strtree {
  * Described in: P. Rigaux, Michel Scholl and Agnes Voisard. Spatial
  * Databases With Application To GIS. Morgan Kaufmann, San Francisco, 2002.
  *
+ * Alternatively, the tree can be packed in Hilbert order (see `setPacking`),
+ * using the same node layout.
+ *
  */
 template<typename ItemType, typename BoundsTraits>
 class TemplateSTRtreeImpl {
@@ -130,7 +159,8 @@ public:
     explicit TemplateSTRtreeImpl(size_t p_nodeCapacity = 10) :
         root(nullptr),
         nodeCapacity(p_nodeCapacity),
-        numItems(0)
+        numItems(0),
+        packing(TreePacking::STR)
         {}
 
     /**
@@ -141,7 +171,8 @@ public:
     TemplateSTRtreeImpl(size_t p_nodeCapacity, size_t itemCapacity) :
         root(nullptr),
         nodeCapacity(p_nodeCapacity),
-        numItems(0) {
+        numItems(0),
+        packing(TreePacking::STR) {
         auto finalSize = treeSize(itemCapacity);
         nodes.reserve(finalSize);
     }
@@ -152,7 +183,8 @@ public:
     TemplateSTRtreeImpl(const TemplateSTRtreeImpl& other) :
         root(other.root),
         nodeCapacity(other.nodeCapacity),
-        numItems(other.numItems) {
+        numItems(other.numItems),
+        packing(other.packing) {
         nodes = other.nodes;
     }
 
@@ -161,10 +193,23 @@ public:
         root = other.root;
         nodeCapacity = other.nodeCapacity;
         numItems = other.numItems;
+        packing = other.packing;
         nodes = other.nodes;
         return *this;
     }
 
+    /**
+     * Sets the method used to group nodes into parent nodes when the
+     * tree is built. Has no effect once the tree has been built.
+     */
+    void setPacking(TreePacking p_packing) {
+        packing = p_packing;
+    }
+
+    TreePacking getPacking() const {
+        return packing;
+    }
+
     /// @}
     /// \defgroup insert Insertion
     /// @{
@@ -285,6 +330,28 @@ public:
         }
     }
 
+    // Query the tree with each of the envelopes in `queryEnvs`, spreading the
+    // queries over up to `numThreads` threads (0 = hardware concurrency). The
+    // tree is built first if necessary. The visitor must be callable with
+    // arguments `(std::size_t queryIndex, const ItemType&)`, and may be called
+    // concurrently from several threads. If it returns a value, false values
+    // stop the query of the current envelope only.
+    template<typename Visitor>
+    void queryBatch(const std::vector<BoundsType>& queryEnvs, Visitor&& visitor, std::size_t numThreads = 1) {
+        build(numThreads);
+
+        // Queries are handed to threads in blocks of this size
+        constexpr std::size_t blockSize = 64;
+
+        util::parallelFor(queryEnvs.size(), numThreads, blockSize, [this, &queryEnvs, &visitor](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                query(queryEnvs[i], [&visitor, i](const ItemType& item) {
+                    return visitor(i, item);
+                });
+            }
+        });
+    }
+
     // Query the tree for all pairs whose bounds intersect. The visitor must
     // be callable with arguments (const ItemType&, const ItemType&).
     // The visitor will be called for each pair once, with first-inserted
@@ -306,6 +373,28 @@ public:
         }
     }
 
+    // Query the tree for the pairs whose bounds intersect and whose first
+    // item is one of the items `begin` to `end` (exclusive), numbered in the
+    // order of the built tree. Pairs are visited in the same order as by
+    // queryPairs(visitor), so visiting consecutive ranges visits all pairs
+    // in that order. Once the tree is built, ranges may be queried
+    // concurrently from several threads.
+    template<typename Visitor>
+    void queryPairs(std::size_t begin, std::size_t end, Visitor&& visitor) {
+        if (!built()) {
+            build();
+        }
+
+        if (numItems < 2) {
+            return;
+        }
+
+        end = std::min(end, numItems);
+        for (std::size_t i = begin; i < end; i++) {
+            queryPairs(nodes[i], *root, visitor);
+        }
+    }
+
     // Query the tree and collect items in the provided vector.
     void query(const BoundsType& queryEnv, std::vector<ItemType>& results) {
         query(queryEnv, [&results](const ItemType& x) {
@@ -366,6 +455,11 @@ public:
         return root != nullptr;
     }
 
+    /** Return the number of items inserted into the tree. */
+    std::size_t size() const {
+        return built() ? numItems : nodes.size();
+    }
+
     /** Determine whether the tree has been built, and no more items may be added. */
     const Node* getRoot() {
         build();
@@ -376,6 +470,16 @@ public:
 
     /** Build the tree if it has not already been built. */
     void build() {
+        build(1);
+    }
+
+    /**
+     * Build the tree if it has not already been built, sorting the nodes
+     * with up to `numThreads` threads (0 = hardware concurrency).
+     * The tree has the same structure as one built by a single thread,
+     * except for the relative order of nodes with equal coordinates.
+     */
+    void build(std::size_t numThreads) {
         std::lock_guard<std::mutex> lock(lock_);
 
         if (built()) {
@@ -393,12 +497,24 @@ public:
         auto finalSize = treeSize(numItems);
         nodes.reserve(finalSize);
 
+        numThreads = util::resolveThreadCount(numThreads);
+
+        if (packing == TreePacking::HILBERT) {
+            sortNodesHilbert(numThreads);
+        }
+
         // begin and end define a range of nodes needing parents
         auto begin = nodes.begin();
         auto number = static_cast<size_t>(std::distance(begin, nodes.end()));
 
         while (number > 1) {
-            createParentNodes(begin, number);
+            if (packing == TreePacking::HILBERT) {
+                // nodes are already in Hilbert order, and parents are
+                // created in the order of their children
+                addParentNodes(begin, begin + static_cast<long>(number));
+            } else {
+                createParentNodes(begin, number, numThreads);
+            }
             std::advance(begin, static_cast<long>(number)); // parents just added become children in the next round
             number = static_cast<size_t>(std::distance(begin, nodes.end()));
         }
@@ -409,11 +525,15 @@ public:
     }
 
 protected:
+    template<typename>
+    friend class FlatSTRtree;
+
     std::mutex lock_;
     NodeList nodes;      //**< a list of all leaf and branch nodes in the tree. */
     Node* root;          //**< a pointer to the root node, if the tree has been built. */
     size_t nodeCapacity; //*< maximum number of children of each node */
     size_t numItems;     //*< total number of items in the tree, if it has been built. */
+    TreePacking packing; //*< method used to group nodes into parents */
 
     // Prevent instantiation of base class.
     // ~TemplateSTRtreeImpl() = default;
@@ -436,6 +556,14 @@ protected:
     size_t treeSize(size_t numLeafNodes) {
         size_t nodesInTree = numLeafNodes;
 
+        if (packing == TreePacking::HILBERT) {
+            for (size_t n = numLeafNodes; n > 1; ) {
+                n = (n + nodeCapacity - 1) / nodeCapacity;
+                nodesInTree += n;
+            }
+            return nodesInTree;
+        }
+
         size_t nodesWithoutParents = numLeafNodes;
         while (nodesWithoutParents > 1) {
             auto numSlices = sliceCount(nodesWithoutParents);
@@ -457,7 +585,14 @@ protected:
         return nodesInTree;
     }
 
-    void createParentNodes(const NodeListIterator& begin, size_t number) {
+    void createParentNodes(const NodeListIterator& begin, size_t number, size_t numThreads = 1) {
+        // Below this number of nodes, sorting is not worth spreading over threads
+        constexpr size_t minNodesForThreads = 4096;
+        if (numThreads > 1 && number >= minNodesForThreads) {
+            createParentNodesParallel(begin, number, numThreads);
+            return;
+        }
+
         // Arrange child nodes in two dimensions.
         // First, divide them into vertical slices of a given size (left-to-right)
         // Then create nodes within those slices (bottom-to-top)
@@ -490,11 +625,73 @@ protected:
         }
     }
 
+    void createParentNodesParallel(const NodeListIterator& begin, size_t number, size_t numThreads) {
+        auto numSlices = sliceCount(number);
+        std::size_t nodesPerSlice = sliceCapacity(number, numSlices);
+
+        // Offsets of the first node of each slice, followed by the end offset
+        std::vector<std::size_t> sliceStart(numSlices + 1);
+        for (std::size_t j = 0; j <= numSlices; j++) {
+            sliceStart[j] = std::min(j * nodesPerSlice, number);
+        }
+        auto sliceBegin = [&begin, &sliceStart](std::size_t j) {
+            return begin + static_cast<long>(sliceStart[j]);
+        };
+
+        // As in createParentNodes, the nodes only need to be sorted enough
+        // for each one to end up in the right vertical slice. Instead of
+        // sorting them, partition them around the slice boundaries,
+        // splitting each range of slices in two at every round and
+        // processing the ranges of a round in parallel.
+        std::vector<std::pair<std::size_t, std::size_t>> ranges;
+        if (numSlices > 1) {
+            ranges.emplace_back(0, numSlices);
+        }
+        while (!ranges.empty()) {
+            std::vector<std::pair<std::size_t, std::size_t>> halves(2 * ranges.size());
+
+            util::parallelFor(ranges.size(), numThreads, 1, [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; i++) {
+                    auto lo = ranges[i].first;
+                    auto hi = ranges[i].second;
+                    auto mid = lo + (hi - lo) / 2;
+                    std::nth_element(sliceBegin(lo), sliceBegin(mid), sliceBegin(hi), lessX);
+                    halves[2 * i] = std::make_pair(lo, mid);
+                    halves[2 * i + 1] = std::make_pair(mid, hi);
+                }
+            });
+
+            ranges.clear();
+            for (const auto& range : halves) {
+                if (range.second - range.first > 1) {
+                    ranges.push_back(range);
+                }
+            }
+        }
+
+        if (BoundsTraits::TwoDimensional::value) {
+            util::parallelFor(numSlices, numThreads, 1, [&](std::size_t first, std::size_t last) {
+                for (std::size_t j = first; j < last; j++) {
+                    sortNodesY(sliceBegin(j), sliceBegin(j + 1));
+                }
+            });
+        }
+
+        // Parent nodes must be appended in slice order
+        for (std::size_t j = 0; j < numSlices; j++) {
+            addParentNodes(sliceBegin(j), sliceBegin(j + 1));
+        }
+    }
+
     void addParentNodesFromVerticalSlice(const NodeListIterator& begin, const NodeListIterator& end) {
         if (BoundsTraits::TwoDimensional::value) {
             sortNodesY(begin, end);
         }
 
+        addParentNodes(begin, end);
+    }
+
+    void addParentNodes(const NodeListIterator& begin, const NodeListIterator& end) {
         // Arrange the nodes vertically and full up parent nodes sequentially until they're full.
         // A possible improvement would be to rework this such so that if we have 81 nodes we
         // put 9 into each parent instead of 10 or 1.
@@ -518,16 +715,82 @@ protected:
         }
     }
 
-    void sortNodesX(const NodeListIterator& begin, const NodeListIterator& end) {
-        std::sort(begin, end, [](const Node &a, const Node &b) {
-            return BoundsTraits::getX(a.getBounds()) < BoundsTraits::getX(b.getBounds());
+    // Sort all nodes (which must all be leaves) by the Hilbert code of
+    // their centres.
+    void sortNodesHilbert(size_t numThreads) {
+        if (!BoundsTraits::TwoDimensional::value) {
+            sortNodesX(nodes.begin(), nodes.end());
+            return;
+        }
+
+        // The grid covers the finite centres only. Items with an infinite
+        // or NaN envelope are accepted by STR packing too; their centres
+        // are clamped to the grid below.
+        double minX = DoubleInfinity;
+        double maxX = -DoubleInfinity;
+        double minY = DoubleInfinity;
+        double maxY = -DoubleInfinity;
+        for (const auto& node : nodes) {
+            double x = BoundsTraits::getX(node.getBounds());
+            double y = BoundsTraits::getY(node.getBounds());
+            if (std::isfinite(x)) {
+                minX = std::min(minX, x);
+                maxX = std::max(maxX, x);
+            }
+            if (std::isfinite(y)) {
+                minY = std::min(minY, y);
+                maxY = std::max(maxY, y);
+            }
+        }
+
+        constexpr uint32_t level = shape::fractal::HilbertCode::MAX_LEVEL;
+        const double maxOrdinate = static_cast<double>((1u << level) - 1);
+        const double scaleX = maxX > minX ? maxOrdinate / (maxX - minX) : 0;
+        const double scaleY = maxY > minY ? maxOrdinate / (maxY - minY) : 0;
+
+        auto toGrid = [maxOrdinate](double v, double min, double scale) {
+            double d = (v - min) * scale;
+            if (!(d > 0)) {
+                // also NaN, from a NaN centre or from inf * 0
+                return 0u;
+            }
+            return static_cast<uint32_t>(std::min(d, maxOrdinate));
+        };
+
+        // (code, node index) pairs
+        std::vector<std::pair<uint32_t, size_t>> keys(nodes.size());
+        util::parallelFor(nodes.size(), numThreads, 4096, [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                const auto& bounds = nodes[i].getBounds();
+                auto x = toGrid(BoundsTraits::getX(bounds), minX, scaleX);
+                auto y = toGrid(BoundsTraits::getY(bounds), minY, scaleY);
+                keys[i] = std::make_pair(shape::fractal::HilbertCode::encode(level, x, y), i);
+            }
         });
+        std::sort(keys.begin(), keys.end());
+
+        NodeList sorted;
+        sorted.reserve(nodes.capacity());
+        for (const auto& key : keys) {
+            sorted.push_back(std::move(nodes[key.second]));
+        }
+        nodes.swap(sorted);
+    }
+
+    static bool lessX(const Node &a, const Node &b) {
+        return BoundsTraits::getX(a.getBounds()) < BoundsTraits::getX(b.getBounds());
+    }
+
+    static bool lessY(const Node &a, const Node &b) {
+        return BoundsTraits::getY(a.getBounds()) < BoundsTraits::getY(b.getBounds());
+    }
+
+    void sortNodesX(const NodeListIterator& begin, const NodeListIterator& end) {
+        std::sort(begin, end, lessX);
     }
 
     void sortNodesY(const NodeListIterator& begin, const NodeListIterator& end) {
-        std::sort(begin, end, [](const Node &a, const Node &b) {
-            return BoundsTraits::getY(a.getBounds()) < BoundsTraits::getY(b.getBounds());
-        });
+        std::sort(begin, end, lessY);
     }
 
     // Helper function to visit an item using a visitor that has no return value.
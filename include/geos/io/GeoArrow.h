@@ -0,0 +1,100 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Geometry.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geos {
+namespace io {
+
+/**
+ * \brief The buffers of an array of geometries in the GeoArrow native layout.
+ *
+ * All geometries in the array have the same type, which is one of
+ * Point, LineString, Polygon, MultiPoint, MultiLineString or
+ * MultiPolygon. Coordinates are interleaved, with 2, 3 or 4 values
+ * each (XY, XYZ, XYM or XYZM). The offset arrays index into the next
+ * level of nesting, and have one more value than the number of items
+ * at their own level:
+ *
+ * | type            | geomOffsets | partOffsets | ringOffsets |
+ * |-----------------|-------------|-------------|-------------|
+ * | Point           | unused      | unused      | unused      |
+ * | LineString      | coordinates | unused      | unused      |
+ * | Polygon         | rings       | unused      | coordinates |
+ * | MultiPoint      | coordinates | unused      | unused      |
+ * | MultiLineString | parts       | coordinates | unused      |
+ * | MultiPolygon    | parts       | rings       | coordinates |
+ *
+ * An empty Point is stored as a coordinate with NaN X and Y.
+ * The buffers are not owned.
+ */
+struct GEOS_DLL GeoArrowBuffers {
+    geom::GeometryTypeId type;
+    bool hasZ;
+    bool hasM;
+    /// Number of geometries in the array
+    std::size_t size;
+    const double* coords;
+    /// Number of coordinates in `coords`
+    std::size_t numCoords;
+    const std::int32_t* geomOffsets;
+    const std::int32_t* partOffsets;
+    const std::int32_t* ringOffsets;
+};
+
+/**
+ * \brief An array of geometries in the GeoArrow native layout,
+ * owning its buffers.
+ *
+ * Offset arrays that are unused by the type are empty.
+ *
+ * @see GeoArrowBuffers
+ */
+struct GEOS_DLL GeoArrowArray {
+    geom::GeometryTypeId type;
+    bool hasZ;
+    bool hasM;
+    std::size_t size;
+    std::vector<double> coords;
+    std::vector<std::int32_t> geomOffsets;
+    std::vector<std::int32_t> partOffsets;
+    std::vector<std::int32_t> ringOffsets;
+
+    /// Returns the number of coordinates in the array.
+    std::size_t getNumCoordinates() const
+    {
+        return coords.size() / (2u + hasZ + hasM);
+    }
+
+    /// Returns a view of the buffers, valid while the array is unchanged.
+    GeoArrowBuffers getBuffers() const
+    {
+        return GeoArrowBuffers {
+            type, hasZ, hasM, size, coords.data(), getNumCoordinates(),
+            geomOffsets.empty() ? nullptr : geomOffsets.data(),
+            partOffsets.empty() ? nullptr : partOffsets.data(),
+            ringOffsets.empty() ? nullptr : ringOffsets.data()
+        };
+    }
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,84 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoArrow.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class GeometryFactory;
+class Point;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoArrowReader
+ *
+ * \brief Builds an array of Geometries from buffers in the GeoArrow
+ * native layout.
+ *
+ * Coordinates are copied from the interleaved buffer into each
+ * CoordinateSequence in bulk, with no intermediate encoding.
+ * Arrays of a multi type produce multi geometries, even for
+ * geometries with a single part.
+ */
+class GEOS_DLL GeoArrowReader {
+
+public:
+
+    GeoArrowReader(const geom::GeometryFactory& f);
+
+    /// Initialize reader with default GeometryFactory.
+    GeoArrowReader();
+
+    /**
+     * \brief Reads all geometries of an array.
+     *
+     * @param buffers the buffers of the array
+     * @return the geometries, in array order
+     * @throws ParseException if the type is not supported, or the
+     *         offsets are negative, decreasing or point beyond the
+     *         coordinates
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> read(const GeoArrowBuffers& buffers) const;
+
+private:
+
+    const geom::GeometryFactory& factory;
+
+    std::unique_ptr<geom::CoordinateSequence> readCoordinates(
+        const GeoArrowBuffers& buffers, std::size_t start, std::size_t end) const;
+
+    std::unique_ptr<geom::Point> readPoint(const GeoArrowBuffers& buffers, std::size_t i) const;
+
+    std::unique_ptr<geom::Polygon> readPolygon(const GeoArrowBuffers& buffers,
+        const std::int32_t* ringOffsets, std::size_t start, std::size_t end) const;
+
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,73 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoArrow.h>
+
+#include <cstddef>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoArrowWriter
+ *
+ * \brief Writes an array of Geometries to buffers in the GeoArrow
+ * native layout.
+ *
+ * The type of the array is the common type of the geometries.
+ * Geometries of a single type mixed with geometries of the
+ * corresponding multi type are written as the multi type.
+ * Empty GeometryCollections are written as empty geometries
+ * of the array type.
+ *
+ * The array has Z (M) values if any geometry has them;
+ * missing values are written as NaN.
+ */
+class GEOS_DLL GeoArrowWriter {
+
+public:
+
+    /**
+     * \brief Writes an array of geometries.
+     *
+     * @param geoms the geometries to write
+     * @param n the number of geometries
+     * @throws util::IllegalArgumentException if the geometries do not
+     *         have a common type supported by GeoArrow, or do not fit
+     *         in 32-bit offsets
+     */
+    GeoArrowArray write(const geom::Geometry* const* geoms, std::size_t n) const;
+
+private:
+
+    static void writeCoordinates(const geom::CoordinateSequence& seq, GeoArrowArray& arr);
+
+    static void writePolygon(const geom::Polygon& poly, GeoArrowArray& arr);
+
+};
+
+} // namespace geos::io
+} // namespace geos
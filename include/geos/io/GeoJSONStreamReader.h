@@ -0,0 +1,125 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoJSON.h>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamReader
+ *
+ * \brief Reads GeoJSON features from a stream one at a time.
+ *
+ * Each member of the "features" array of a FeatureCollection is
+ * returned as soon as it has been read, so memory use is bounded by
+ * the size of the largest feature rather than by the size of the
+ * input. A Feature or Geometry object is returned as a single feature.
+ * The stream may hold several such objects in a row, as in
+ * newline-delimited GeoJSON or GeoJSON text sequences (RFC 8142).
+ *
+ * Coordinates are read from the JSON parser events directly into
+ * CoordinateSequences, without building a JSON document.
+ *
+ * \see GeoJSONReader
+ */
+class GEOS_DLL GeoJSONStreamReader {
+
+public:
+
+    /**
+     * \brief Initialize reader with given GeometryFactory.
+     *
+     * The factory must be kept alive for the life of the
+     * reader and of the geometries it creates.
+     */
+    GeoJSONStreamReader(std::istream& instr, const geom::GeometryFactory& gf);
+
+    /**
+     * \brief Initialize reader with default GeometryFactory.
+     */
+    GeoJSONStreamReader(std::istream& instr);
+
+    ~GeoJSONStreamReader();
+
+    /**
+     * \brief Reads the next feature.
+     *
+     * @return the feature, or nullptr at the end of the stream
+     * @throws ParseException if the input is not valid GeoJSON
+     */
+    std::unique_ptr<GeoJSONFeature> next();
+
+private:
+
+    enum class State {
+        BETWEEN_OBJECTS,
+        IN_OBJECT,
+        IN_FEATURES,
+        IN_FEATURE
+    };
+
+    bool nextChar(char& c);
+
+    bool nextObjectText(std::string& text, bool& isCollectionMember);
+
+    std::istream& instr;
+    const geom::GeometryFactory& geometryFactory;
+
+    std::vector<char> buf;
+    std::size_t bufPos;
+    std::size_t bufEnd;
+
+    State state;
+    std::size_t depth;
+    bool inString;
+    bool escaped;
+    bool expectKey;
+    bool readingKey;
+    bool afterFeaturesKey;
+    bool isCollection;
+    std::string key;
+    std::string objectText;
+
+    // Declare type as noncopyable
+    GeoJSONStreamReader(const GeoJSONStreamReader& other) = delete;
+    GeoJSONStreamReader& operator=(const GeoJSONStreamReader& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
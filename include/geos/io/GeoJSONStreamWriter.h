@@ -0,0 +1,182 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoJSON.h>
+#include <geos/io/GeoJSONWriter.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamWriter
+ *
+ * \brief Writes GeoJSON text directly to a string or a stream.
+ *
+ * Unlike GeoJSONWriter, no JSON document is built: text is appended
+ * to a caller-supplied std::string, or to an internal buffer that is
+ * flushed to a std::ostream as it fills. A FeatureCollection can be
+ * written incrementally, one feature at a time, between calls to
+ * beginFeatureCollection() and endFeatureCollection().
+ *
+ * Numbers are formatted like GeoJSONWriter does, with the shortest
+ * text that reads back as the same double. If a rounding precision
+ * is set, coordinates are rounded to that number of decimals instead,
+ * without trailing zeros. Non-finite numbers are written as null.
+ *
+ * The output differs from that of GeoJSONWriter in one respect: every
+ * Feature has a "properties" member, as RFC 7946 requires, including
+ * a Feature written from a Geometry, for which GeoJSONWriter omits it.
+ */
+class GEOS_DLL GeoJSONStreamWriter {
+
+public:
+
+    /**
+     * \brief Creates a writer that appends to a stream.
+     *
+     * Output is buffered; it is written to the stream when the buffer
+     * fills, on flush() and when the writer is destroyed.
+     */
+    explicit GeoJSONStreamWriter(std::ostream& os);
+
+    /**
+     * \brief Creates a writer that appends to a string.
+     */
+    explicit GeoJSONStreamWriter(std::string& buffer);
+
+    ~GeoJSONStreamWriter();
+
+    /**
+     * \brief Writes a Geometry as a GeoJSON Geometry, Feature or
+     * FeatureCollection.
+     *
+     * Inside a FeatureCollection, only GeoJSONType::FEATURE is allowed.
+     */
+    void write(const geom::Geometry* geometry, GeoJSONType type = GeoJSONType::GEOMETRY);
+
+    /**
+     * \brief Writes a Feature, as a member of the current
+     * FeatureCollection if one has been begun.
+     */
+    void write(const GeoJSONFeature& feature);
+
+    void write(const GeoJSONFeatureCollection& features);
+
+    /**
+     * \brief Begins a FeatureCollection, whose features are written
+     * by subsequent calls to write().
+     */
+    void beginFeatureCollection();
+
+    /**
+     * \brief Ends the FeatureCollection begun by beginFeatureCollection().
+     */
+    void endFeatureCollection();
+
+    /**
+     * \brief Writes buffered output to the stream.
+     */
+    void flush();
+
+    int
+    getOutputDimension() const
+    {
+        return outputDimension;
+    }
+
+    /**
+     * Sets the output dimension.
+     *
+     * @param newOutputDimension Supported values are 2 or 3 (default).
+     *        Note that 3 indicates up to 3 dimensions will be
+     *        written but 2D GeoJSON is still produced for 2D geometries.
+     */
+    void setOutputDimension(uint8_t newOutputDimension);
+
+    /**
+     * Sets the number of decimals of coordinates.
+     *
+     * @param p0 the number of decimals, or -1 (default) to write
+     *        coordinates at full precision, as GeoJSONWriter does
+     */
+    void
+    setRoundingPrecision(int p0)
+    {
+        roundingPrecision = p0;
+    }
+
+private:
+
+    void writeFeature(const geom::Geometry* geometry, const GeoJSONFeature* feature);
+
+    void writeGeometry(const geom::Geometry* geometry);
+
+    void writeCoordinates(const geom::CoordinateSequence& seq);
+
+    void writePolygonCoordinates(const geom::Polygon& poly);
+
+    void writeCoordinate(double x, double y, double z);
+
+    char* writeNumber(double d, char* buf) const;
+
+    void writeValue(const GeoJSONValue& value);
+
+    void writeString(const std::string& s);
+
+    void append(const char* s);
+
+    void flushIfFull();
+
+    std::ostream* os;
+    std::string ownBuffer;
+    std::string& out;
+
+    uint8_t outputDimension;
+    int roundingPrecision;
+
+    bool inFeatureCollection;
+    bool isFirstFeature;
+
+    // Declare type as noncopyable
+    GeoJSONStreamWriter(const GeoJSONStreamWriter& other) = delete;
+    GeoJSONStreamWriter& operator=(const GeoJSONStreamWriter& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
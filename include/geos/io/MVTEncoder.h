@@ -0,0 +1,155 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class MVTEncoder
+ *
+ * \brief Encodes geometries as the command integers of
+ * Mapbox Vector Tile features.
+ *
+ * Each geometry is prepared for a tile in a single pass:
+ *
+ * - parts crossing the tile (expanded by the buffer) are clipped
+ *   to it, and points outside it are dropped;
+ * - coordinates are transformed to integer tile coordinates, with Y
+ *   pointing down, and points repeated after rounding are dropped;
+ * - polygons that are no longer valid after rounding are repaired
+ *   by snap-rounding them to the tile grid;
+ * - rings are oriented as the specification requires, and the
+ *   result is written as zigzag-encoded MoveTo / LineTo / ClosePath
+ *   commands.
+ *
+ * Intermediate geometries are only created for clipped geometries and
+ * for polygons, which are checked for validity in tile coordinates.
+ *
+ * The encoding type follows the dimension of the input: components
+ * of a lower dimension (for example lines produced by clipping a
+ * polygon) are not written.
+ *
+ * This class is not thread-safe; each thread should create its own
+ * instance.
+ *
+ * \see https://github.com/mapbox/vector-tile-spec
+ */
+class GEOS_DLL MVTEncoder {
+
+public:
+
+    /// MVT feature geometry types
+    enum GeomType : uint8_t {
+        UNKNOWN = 0,
+        POINT = 1,
+        LINESTRING = 2,
+        POLYGON = 3
+    };
+
+    /**
+     * @param tileEnvelope bounds of the tile, in the coordinates of the
+     *        geometries to encode
+     * @param extent width and height of the tile in tile coordinates
+     * @param buffer width of the area around the tile that is kept,
+     *        in tile coordinates
+     * @throws IllegalArgumentException if the envelope has no area or
+     *         the extent is zero or too large
+     */
+    MVTEncoder(const geom::Envelope& tileEnvelope, uint32_t extent = 4096, uint32_t buffer = 256);
+
+    /**
+     * \brief Encodes a geometry.
+     *
+     * @param g the geometry
+     * @param commands receives the command integers, replacing
+     *        its contents
+     * @return the type of the feature, or UNKNOWN if nothing of
+     *         the geometry remains in the tile
+     * @throws IllegalArgumentException if the geometry has non-finite
+     *         coordinates
+     * @throws UnsupportedOperationException for curved geometries
+     */
+    GeomType encode(const geom::Geometry& g, std::vector<uint32_t>& commands);
+
+private:
+
+    void encodePoints(const geom::Geometry& g, std::vector<uint32_t>& commands);
+
+    void encodeLines(const geom::Geometry& g, std::vector<uint32_t>& commands);
+
+    void encodePolygons(const geom::Geometry& g, std::vector<uint32_t>& commands);
+
+    void encodeRing(const geom::CoordinateSequence& seq, bool isShell, std::vector<uint32_t>& commands);
+
+    std::unique_ptr<geom::Polygon> toTilePolygon(const geom::Polygon& poly) const;
+
+    std::unique_ptr<geom::CoordinateSequence> toTileRing(const geom::CoordinateSequence& seq) const;
+
+    /// Rounds the coordinates of a sequence into tilePoints, dropping repeated points
+    void toTilePoints(const geom::CoordinateSequence& seq);
+
+    int32_t toTileX(double x) const;
+
+    int32_t toTileY(double y) const;
+
+    void writeParameters(int32_t x, int32_t y, std::vector<uint32_t>& commands);
+
+    geom::Envelope tileEnvelope;
+    geom::Envelope clipEnvelope;
+    uint32_t extent;
+    double scaleX;
+    double scaleY;
+
+    // Position of the cursor in the geometry being encoded
+    int32_t cursorX;
+    int32_t cursorY;
+
+    // Interleaved X and Y tile coordinates
+    std::vector<int32_t> tilePoints;
+
+    // Declare type as noncopyable
+    MVTEncoder(const MVTEncoder& other) = delete;
+    MVTEncoder& operator=(const MVTEncoder& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
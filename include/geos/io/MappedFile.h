@@ -0,0 +1,78 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <string>
+
+namespace geos {
+namespace io {
+
+/**
+ * \class MappedFile
+ *
+ * \brief A read-only memory mapping of a whole file.
+ *
+ * Pages are loaded by the operating system as they are accessed, so
+ * large files can be read without copying them through a stream.
+ * The mapping is released when the object is destroyed.
+ *
+ * \see WKBStreamReader
+ */
+class GEOS_DLL MappedFile {
+
+public:
+
+    /**
+     * \brief Maps a file.
+     *
+     * @param path the path of the file
+     * @throws GEOSException if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    /// Returns the contents of the file, or nullptr if it is empty
+    const unsigned char*
+    data() const
+    {
+        return fileData;
+    }
+
+    /// Returns the size of the file in bytes
+    std::size_t
+    size() const
+    {
+        return fileSize;
+    }
+
+private:
+
+    const unsigned char* fileData;
+    std::size_t fileSize;
+#ifdef _WIN32
+    void* mappingHandle;
+#endif
+
+    // Declare type as noncopyable
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,131 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class ParallelStreamDecoder
+ *
+ * \brief Decodes the text records of a stream on several threads,
+ * returning the geometries in stream order.
+ *
+ * Records are read in batches by the thread calling next(). While one
+ * batch is being decoded by the worker threads, the text of the following
+ * batch is read, and the geometries of the previous one are returned.
+ * When a BatchScope is given, each batch is instead decoded within the
+ * call to next() that needs it, so that nothing is decoded between calls.
+ *
+ * An exception thrown while decoding a record is rethrown by the call to
+ * next() that would have returned its geometry; following records can
+ * still be read.
+ *
+ * Used by WKBStreamReader and WKTStreamReader.
+ */
+class GEOS_DLL ParallelStreamDecoder {
+
+public:
+
+    /// Reads the text of the next record into its argument, replacing the
+    /// previous contents. Returns false at end of input.
+    using RecordReader = std::function<bool(std::string&)>;
+
+    /// Decodes the text of a record. Called concurrently from the worker threads.
+    using RecordDecoder = std::function<std::unique_ptr<geom::Geometry>(const std::string&)>;
+
+    /// Calls its argument, which decodes a batch, on the thread calling next().
+    /// Can hold state needed while decoding, such as a CLocalizer.
+    using BatchScope = std::function<void(const std::function<void()>&)>;
+
+    /**
+     * @param reader reads records from the stream
+     * @param decoder decodes a record
+     * @param numThreads number of decoding threads (0 = hardware concurrency)
+     * @param scope if not empty, batches are decoded within next() through it
+     */
+    ParallelStreamDecoder(RecordReader reader, RecordDecoder decoder, std::size_t numThreads,
+                          BatchScope scope = BatchScope());
+
+    ~ParallelStreamDecoder();
+
+    /**
+     * \brief Returns the geometry of the next record.
+     *
+     * @return the geometry, or nullptr at end of input
+     */
+    std::unique_ptr<geom::Geometry> next();
+
+private:
+
+    struct Batch {
+        std::vector<std::string> records;
+        std::vector<std::unique_ptr<geom::Geometry>> geoms;
+        std::vector<std::exception_ptr> errors;
+    };
+
+    void readBatch(Batch& batch);
+
+    void startDecoding(std::unique_ptr<Batch> batch);
+
+    void decodeBatch(Batch& batch);
+
+    RecordReader reader;
+    RecordDecoder decoder;
+    BatchScope scope;
+    std::size_t numThreads;
+    std::size_t batchSize;
+
+    // Batch whose geometries are being returned
+    std::unique_ptr<Batch> current;
+    std::size_t currentPos;
+    // Batch being decoded by the worker threads
+    std::unique_ptr<Batch> decoding;
+    std::future<void> decodingDone;
+    bool isStarted;
+
+    // Declare type as noncopyable
+    ParallelStreamDecoder(const ParallelStreamDecoder& other) = delete;
+    ParallelStreamDecoder& operator=(const ParallelStreamDecoder& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -21,6 +21,7 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
 #include <string>
 
 #ifdef _MSC_VER
@@ -46,11 +47,27 @@ public:
     int peekNextToken();
     double getNVal() const;
     std::string getSVal() const;
+
+    /**
+     * \brief Returns the number of ',' characters between the current
+     * position and the next ')' or the end of the text.
+     *
+     * This is an upper bound on the number of remaining items in a
+     * list of numbers, used to reserve space before reading it.
+     */
+    std::size_t countCommasBeforeCloser() const;
+
 private:
-    const std::string& str;
+    int readToken(const char*& pos);
+
     std::string stok;
     double ntok;
-    std::string::const_iterator iter;
+    const char* iter;
+    const char* end;
+
+    // Token read by peekNextToken(), returned by the next nextToken()
+    int peekType;
+    const char* peekEnd;
 
     // Declare type as noncopyable
     StringTokenizer(const StringTokenizer& other) = delete;
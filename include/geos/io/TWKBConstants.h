@@ -0,0 +1,50 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+namespace geos {
+namespace io {
+
+/// Constant values used by the TWKB format
+/// (https://github.com/TWKB/Specification).
+/// Geometry types are the same as WKBConstants::wkbType.
+namespace TWKBConstants {
+
+    /// Flags of the metadata header byte
+    enum metadataFlag {
+        twkbBBox = 0x01,
+        twkbSize = 0x02,
+        twkbIdList = 0x04,
+        twkbExtendedDims = 0x08,
+        twkbEmpty = 0x10
+    };
+
+    /// Flags of the extended dimensions byte
+    enum extendedDimsFlag {
+        twkbHasZ = 0x01,
+        twkbHasM = 0x02
+    };
+
+    /// Range of the XY precision
+    enum precisionRange {
+        twkbMinPrecision = -8,
+        twkbMaxPrecision = 7,
+        twkbMaxPrecisionZM = 7
+    };
+
+}
+
+} // namespace geos::io
+} // namespace geos
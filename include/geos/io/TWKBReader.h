@@ -0,0 +1,113 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class GeometryFactory;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class TWKBReader
+ *
+ * \brief Reads a Geometry from Tiny Well-known Binary (TWKB) format.
+ *
+ * Bounding boxes, sizes and id lists are skipped.
+ *
+ * This class is not thread-safe; each thread should create its own
+ * instance.
+ *
+ * \see TWKBWriter
+ * \see https://github.com/TWKB/Specification
+ */
+class GEOS_DLL TWKBReader {
+
+public:
+
+    /**
+     * \brief Initialize reader with given GeometryFactory.
+     *
+     * The factory must be kept alive for the life of the reader
+     * and of the geometries it creates.
+     */
+    explicit TWKBReader(const geom::GeometryFactory& f);
+
+    /// Initialize reader with default GeometryFactory.
+    TWKBReader();
+
+    /**
+     * \brief Reads a Geometry from a buffer.
+     *
+     * @param buf the TWKB
+     * @param size the size of the buffer
+     * @throws ParseException if the buffer is not valid TWKB
+     */
+    std::unique_ptr<geom::Geometry> read(const unsigned char* buf, std::size_t size);
+
+    /**
+     * \brief Reads a Geometry from the remainder of a stream.
+     *
+     * @throws ParseException if the input is not valid TWKB
+     */
+    std::unique_ptr<geom::Geometry> read(std::istream& is);
+
+private:
+
+    std::unique_ptr<geom::Geometry> readGeometry();
+
+    std::unique_ptr<geom::CoordinateSequence> readCoordinates(std::size_t n);
+
+    std::unique_ptr<geom::Polygon> readPolygon();
+
+    unsigned char readByte();
+
+    uint64_t readVarint();
+
+    std::size_t readCount();
+
+    const geom::GeometryFactory& factory;
+
+    const unsigned char* pos;
+    const unsigned char* end;
+
+    // State of the geometry being read
+    bool hasZ;
+    bool hasM;
+    std::size_t numOrdinates;
+    int precision[4];
+    int64_t previous[4];
+
+    // Declare type as noncopyable
+    TWKBReader(const TWKBReader& other) = delete;
+    TWKBReader& operator=(const TWKBReader& rhs) = delete;
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,192 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class GeometryCollection;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class TWKBWriter
+ *
+ * \brief Writes a Geometry in Tiny Well-known Binary (TWKB) format.
+ *
+ * Coordinates are rounded to a number of decimal digits, and written as
+ * variable-length integer differences from the previous coordinate.
+ * Points that repeat the previous one after rounding are dropped from
+ * lines and rings, as long as enough points remain.
+ * A bounding box and the size of the encoding can optionally be written
+ * in the header of each geometry.
+ *
+ * Curved geometries are not supported.
+ *
+ * \see TWKBReader
+ * \see https://github.com/TWKB/Specification
+ */
+class GEOS_DLL TWKBWriter {
+
+public:
+
+    TWKBWriter();
+
+    /**
+     * \brief Sets the number of decimal digits of X and Y values.
+     *
+     * @param p the precision, from -8 to 7 (default 0). A negative
+     *        precision rounds to tens, hundreds, etc.
+     */
+    void setPrecision(int p);
+
+    int
+    getPrecision() const
+    {
+        return precisionXY;
+    }
+
+    /**
+     * \brief Sets the number of decimal digits of Z values.
+     *
+     * @param p the precision, from 0 (default) to 7
+     */
+    void setPrecisionZ(int p);
+
+    int
+    getPrecisionZ() const
+    {
+        return precisionZ;
+    }
+
+    /**
+     * \brief Sets the number of decimal digits of M values.
+     *
+     * @param p the precision, from 0 (default) to 7
+     */
+    void setPrecisionM(int p);
+
+    int
+    getPrecisionM() const
+    {
+        return precisionM;
+    }
+
+    /**
+     * \brief Sets the maximum number of dimensions written.
+     *
+     * @param dims 2, 3 or 4 (default). M values are dropped before Z values.
+     */
+    void setOutputDimension(uint8_t dims);
+
+    uint8_t
+    getOutputDimension() const
+    {
+        return outputDimension;
+    }
+
+    /// Sets whether the bounding box of each geometry is written.
+    void
+    setIncludeBoundingBox(bool include)
+    {
+        includeBoundingBox = include;
+    }
+
+    bool
+    getIncludeBoundingBox() const
+    {
+        return includeBoundingBox;
+    }
+
+    /// Sets whether the size in bytes of each geometry is written.
+    void
+    setIncludeSize(bool include)
+    {
+        includeSize = include;
+    }
+
+    bool
+    getIncludeSize() const
+    {
+        return includeSize;
+    }
+
+    /**
+     * \brief Writes a Geometry to an ostream.
+     *
+     * @throws util::IllegalArgumentException if a coordinate is not
+     *         finite or out of range at the precision
+     * @throws util::UnsupportedOperationException for curved geometries
+     */
+    void write(const geom::Geometry& g, std::ostream& os);
+
+    /**
+     * \brief Appends the TWKB encoding of a Geometry to a byte vector.
+     */
+    void write(const geom::Geometry& g, std::vector<unsigned char>& buf);
+
+private:
+
+    struct Bounds;
+
+    void writeGeometry(const geom::Geometry& g, std::vector<unsigned char>& out, Bounds* parentBounds);
+
+    void writeCoordinates(const geom::CoordinateSequence& seq, std::size_t minPoints, bool writeCount,
+                          std::vector<unsigned char>& out, Bounds* bounds);
+
+    void writePolygon(const geom::Polygon& poly, std::vector<unsigned char>& out, Bounds* bounds);
+
+    int precisionXY;
+    int precisionZ;
+    int precisionM;
+    uint8_t outputDimension;
+    bool includeBoundingBox;
+    bool includeSize;
+
+    // State of the geometry being written
+    bool hasZ;
+    bool hasM;
+    std::size_t numOrdinates;
+    int precision[4];
+    int64_t previous[4];
+
+    // Points of a line or ring, written after their count
+    std::vector<unsigned char> pointBuffer;
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
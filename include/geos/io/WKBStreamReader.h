@@ -16,6 +16,7 @@
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/io/WKBReader.h>
+#include <geos/io/ParallelStreamDecoder.h>
 #include <geos/export.h>
 
 // Forward declarations
@@ -29,18 +30,69 @@ class PrecisionModel;
 namespace geos {
 namespace io {
 
+/**
+ * \class WKBStreamReader
+ *
+ * \brief Reads geometries from a stream of hex-encoded WKB, one per line,
+ * or from a buffer of length-prefixed binary WKB.
+ *
+ * In the length-prefixed format, each record is the size of its WKB as a
+ * 4-byte little-endian unsigned integer, followed by the WKB. Records are
+ * decoded in place, so a MappedFile can be read without copying it.
+ *
+ * By default, geometries are decoded in sequence. With setNumThreads(),
+ * records are decoded in parallel on a pool of threads while the input
+ * is read; geometries are still returned in input order.
+ */
 class GEOS_DLL WKBStreamReader {
 
 public:
     WKBStreamReader(std::istream& instr);
+
+    /**
+     * \brief Reads length-prefixed binary WKB records from a buffer.
+     *
+     * @param buf the records; must remain valid while the reader is used
+     * @param size the size of the buffer
+     */
+    WKBStreamReader(const unsigned char* buf, std::size_t size);
+
     ~WKBStreamReader();
 
+    /**
+     * \brief Reads the next geometry.
+     *
+     * @return the geometry, or nullptr at the end of the input
+     * @throws ParseException if the record is not valid WKB
+     */
     std::unique_ptr<geom::Geometry> next();
 
+    /**
+     * \brief Sets the number of threads used to decode geometries.
+     *
+     * With more than one thread, lines are read ahead of the geometries
+     * returned by next(), so the stream must not be used by the caller
+     * until reading is done. Must be called before the first call to next().
+     *
+     * @param n number of threads (0 = hardware concurrency, default 1)
+     * @throws util::IllegalStateException if geometries are already
+     *         being decoded in parallel
+     */
+    void setNumThreads(std::size_t n);
+
 private:
 
-    std::istream& instr;
+    bool readRecord(std::string& line);
+
+    /// Finds the next length-prefixed record, advancing past it
+    bool nextBinaryRecord(const unsigned char*& record, std::size_t& size);
+
+    std::istream* instr;
+    const unsigned char* bufPos;
+    const unsigned char* bufEnd;
     WKBReader rdr;
+    std::size_t numThreads;
+    std::unique_ptr<ParallelStreamDecoder> decoder;
 };
 
 }
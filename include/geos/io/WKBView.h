@@ -0,0 +1,143 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class GeometryFactory;
+namespace prep {
+class PreparedGeometry;
+}
+}
+namespace io {
+class ByteOrderDataInStream;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class WKBView
+ *
+ * \brief A read-only view of a geometry in Well-Known Binary format.
+ *
+ * The view is built with a single pass over the buffer, which checks
+ * its structure and computes the envelope, without creating a
+ * Geometry or copying any coordinates. It is intended for filters
+ * that reject most inputs on their envelope or on a point location
+ * before any Geometry needs to be built.
+ *
+ * The buffer is borrowed, and must outlive the view.
+ * The coordinates are used as stored: no PrecisionModel is applied
+ * when computing the envelope. The envelope of curved geometries
+ * covers their arcs, as Geometry::getEnvelopeInternal does.
+ */
+class GEOS_DLL WKBView {
+
+public:
+
+    /**
+     * \brief Creates a view of a WKB buffer.
+     *
+     * @param buf the buffer holding the WKB
+     * @param size the size of the buffer
+     * @throws ParseException if the buffer does not hold valid WKB
+     */
+    WKBView(const unsigned char* buf, std::size_t size);
+
+    geom::GeometryTypeId getGeometryTypeId() const
+    {
+        return typeId;
+    }
+
+    int getSRID() const
+    {
+        return srid;
+    }
+
+    bool hasZ() const
+    {
+        return m_hasZ;
+    }
+
+    bool hasM() const
+    {
+        return m_hasM;
+    }
+
+    /// Returns the number of non-empty points in the geometry.
+    std::size_t getNumPoints() const
+    {
+        return numPoints;
+    }
+
+    bool isEmpty() const
+    {
+        return numPoints == 0;
+    }
+
+    /// Returns the envelope of the XY coordinates in the buffer.
+    const geom::Envelope& getEnvelope() const
+    {
+        return env;
+    }
+
+    /**
+     * \brief Reads the Geometry from the buffer.
+     *
+     * @param factory the factory used to create the Geometry
+     */
+    std::unique_ptr<geom::Geometry> toGeometry(const geom::GeometryFactory& factory) const;
+
+    /**
+     * \brief Tests whether a prepared geometry intersects the geometry
+     * in the buffer.
+     *
+     * Inputs that are disjoint from the envelope of the prepared
+     * geometry, and points, are tested without creating a Geometry.
+     * Other inputs are read with the factory of the prepared geometry.
+     */
+    bool intersects(const geom::prep::PreparedGeometry& pg) const;
+
+private:
+
+    const unsigned char* buf;
+    std::size_t size;
+
+    geom::GeometryTypeId typeId;
+    int srid;
+    bool m_hasZ;
+    bool m_hasM;
+    std::size_t numPoints;
+    geom::Envelope env;
+
+    void scanGeometry(ByteOrderDataInStream& dis, bool isRoot);
+
+    void scanCoordinates(ByteOrderDataInStream& dis, uint32_t n, unsigned int dim, bool isArc);
+
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -27,6 +27,7 @@
 #include <iosfwd>
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 // Forward declarations
 namespace geos {
@@ -187,6 +188,36 @@ public:
     void write(const geom::Geometry& g, std::ostream& os);
     // throws IOException, ParseException
 
+    /**
+     * \brief Returns the number of bytes of the WKB encoding of a Geometry.
+     *
+     * @param g the geometry
+     * @return the size of the encoding written by write()
+     */
+    std::size_t getWkbSize(const geom::Geometry& g);
+
+    /**
+     * \brief Write a Geometry to a memory buffer.
+     *
+     * When the byte order is the machine byte order, coordinates are
+     * copied to the buffer in bulk.
+     *
+     * @param g the geometry to write
+     * @param buf a buffer of at least getWkbSize(g) bytes
+     * @return the number of bytes written
+     */
+    std::size_t write(const geom::Geometry& g, unsigned char* buf);
+
+    /**
+     * \brief Append the WKB encoding of a Geometry to a byte vector.
+     *
+     * The vector can be reused between calls to avoid allocations.
+     *
+     * @param g the geometry to write
+     * @param buf the vector to append to
+     */
+    void write(const geom::Geometry& g, std::vector<unsigned char>& buf);
+
     /**
      * \brief Write a Geometry to an ostream in binary hex format.
      *
@@ -212,10 +243,18 @@ private:
 
     bool includeSRID;
 
+    // Output goes to outStream if set, else to outBuffer if set;
+    // if neither is set, only outSize is counted.
     std::ostream* outStream;
+    unsigned char* outBuffer;
+    std::size_t outSize;
 
     unsigned char buf[8];
 
+    void writeGeometry(const geom::Geometry& g);
+
+    void writeBytes(const unsigned char* bytes, std::size_t n);
+
     void writePoint(const geom::Point& p);
     void writePointEmpty(const geom::Point& p);
     // throws IOException
@@ -145,6 +145,11 @@ protected:
     /// Read the contents of a POLYGON or a CURVEPOLYGON
     std::unique_ptr<geom::Geometry> readSurfaceText(io::StringTokenizer* tokenizer, OrdinateSet& ordinateFlags) const;
 private:
+    // Parses WKT without switching LC_NUMERIC to "C", which the caller
+    // must have done. Used by WKTStreamReader on worker threads.
+    friend class WKTStreamReader;
+    std::unique_ptr<geom::Geometry> readWithoutLocale(const std::string& wellKnownText) const;
+
     const geom::GeometryFactory* geometryFactory;
     const geom::PrecisionModel* precisionModel;
     bool fixStructure;
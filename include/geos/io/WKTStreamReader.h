@@ -16,6 +16,7 @@
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/io/WKTReader.h>
+#include <geos/io/ParallelStreamDecoder.h>
 #include <geos/export.h>
 
 // Forward declarations
@@ -30,18 +31,56 @@ class PrecisionModel;
 namespace geos {
 namespace io {
 
+/**
+ * \class WKTStreamReader
+ *
+ * \brief Reads geometries from a stream of WKT.
+ *
+ * A geometry ends at the end of the line on which its parentheses
+ * balance. By default, geometries are decoded in sequence. With
+ * setNumThreads(), geometries are decoded in parallel on a pool of
+ * threads while the stream is read; they are still returned in stream
+ * order.
+ */
 class GEOS_DLL WKTStreamReader {
 
 public:
     WKTStreamReader(std::istream& instr);
     ~WKTStreamReader();
 
+    /**
+     * \brief Reads the next geometry.
+     *
+     * @return the geometry, or nullptr at the end of the stream
+     * @throws ParseException if the text is not valid WKT
+     */
     std::unique_ptr<geos::geom::Geometry> next();
 
+    /**
+     * \brief Sets the number of threads used to decode geometries.
+     *
+     * With more than one thread, text is read ahead of the geometries
+     * returned by next(), so the stream must not be used by the caller
+     * until reading is done. Must be called before the first call to next().
+     *
+     * Geometries are then decoded in batches within next(), with
+     * LC_NUMERIC set to "C" for the whole process while a batch is
+     * decoded. The locale is restored before next() returns.
+     *
+     * @param n number of threads (0 = hardware concurrency, default 1)
+     * @throws util::IllegalStateException if geometries are already
+     *         being decoded in parallel
+     */
+    void setNumThreads(std::size_t n);
+
 private:
 
+    bool readRecord(std::string& wkt);
+
     std::istream& instr;
     WKTReader rdr;
+    std::size_t numThreads;
+    std::unique_ptr<ParallelStreamDecoder> decoder;
 };
 
 }
@@ -45,12 +45,15 @@ namespace noding { // geos::noding
  * against a target set of lines.
  * Short-circuited to return as soon an intersection is found.
  *
+ * Once constructed, the intersects() methods may be called concurrently
+ * from several threads, provided each caller supplies its own
+ * SegmentIntersectionDetector.
+ *
  * @version 1.7
  */
 class FastSegmentSetIntersectionFinder {
 private:
     std::unique_ptr<MCIndexSegmentSetMutualIntersector> segSetMutInt;
-    std::unique_ptr<geos::algorithm::LineIntersector> lineIntersector;
 
 protected:
 public:
@@ -70,8 +73,8 @@ public:
         return segSetMutInt.get();
     }
 
-    bool intersects(SegmentString::ConstVect* segStrings);
-    bool intersects(SegmentString::ConstVect* segStrings, SegmentIntersectionDetector* intDetector);
+    bool intersects(SegmentString::ConstVect* segStrings) const;
+    bool intersects(SegmentString::ConstVect* segStrings, SegmentIntersectionDetector* intDetector) const;
 
 };
 
@@ -30,6 +30,7 @@
 // Forward declarations
 namespace geos {
 namespace noding {
+class NodedSegmentString;
 class SegmentString;
 }
 namespace algorithm {
@@ -77,8 +78,9 @@ private:
      * Note that closed edges require a special check for the point
      * shared by the beginning and end segments.
      */
-    bool isTrivialIntersection(const SegmentString* e0, std::size_t segIndex0,
-                               const SegmentString* e1, std::size_t segIndex1);
+    static bool isTrivialIntersection(const algorithm::LineIntersector& li,
+                                      const SegmentString* e0, std::size_t segIndex0,
+                                      const SegmentString* e1, std::size_t segIndex1);
 
     // Declare type as noncopyable
     IntersectionAdder(const IntersectionAdder& other) = delete;
@@ -86,6 +88,33 @@ private:
 
 public:
 
+    /** \brief
+     * The intersections found in a batch of segment pairs, to be added
+     * to the segment strings later.
+     *
+     * Batches let intersections be computed on several threads.
+     *
+     * @see computeIntersections
+     * @see addBatch
+     */
+    struct GEOS_DLL Batch {
+        struct Node {
+            NodedSegmentString* segString;
+            geom::CoordinateXYZM pt;
+            std::size_t segIndex;
+        };
+
+        std::vector<Node> nodes;
+        int numTests = 0;
+        int numIntersections = 0;
+        int numInteriorIntersections = 0;
+        int numProperIntersections = 0;
+        bool hasIntersection = false;
+        bool hasInterior = false;
+        bool hasProper = false;
+        geom::CoordinateXYZM properIntersectionPoint;
+    };
+
     int numIntersections;
     int numInteriorIntersections;
     int numProperIntersections;
@@ -177,6 +206,27 @@ public:
         SegmentString* e0,  std::size_t segIndex0,
         SegmentString* e1,  std::size_t segIndex1) override;
 
+    /** \brief
+     * Intersects two segments as processIntersections() does, recording
+     * the nodes found and the counts in a batch instead of applying them.
+     *
+     * Neither this object nor the segment strings are modified, so
+     * several threads may call this method, each with its own
+     * LineIntersector (set up like the one of this object) and Batch.
+     */
+    void computeIntersections(
+        SegmentString* e0,  std::size_t segIndex0,
+        SegmentString* e1,  std::size_t segIndex1,
+        algorithm::LineIntersector& batchLi, Batch& batch) const;
+
+    /** \brief
+     * Adds the nodes and counts of a batch.
+     *
+     * Adding batches in the order of their segment pairs gives the same
+     * result as calling processIntersections() for each pair in that order.
+     */
+    void addBatch(const Batch& batch);
+
 
     static bool
     isAdjacentSegments(std::size_t i1, std::size_t i2)
@@ -72,9 +72,13 @@ private:
     int nOverlaps;
     double overlapTolerance;
     bool indexBuilt;
+    std::size_t numThreads;
 
     void intersectChains();
 
+    template<typename Adder>
+    void intersectChainsParallel(Adder& adder);
+
     void add(SegmentString* segStr);
 
 public:
@@ -85,6 +89,7 @@ public:
         , nOverlaps(0)
         , overlapTolerance(p_overlapTolerance)
         , indexBuilt(false)
+        , numThreads(1)
     {}
 
     ~MCIndexNoder() override {};
@@ -108,6 +113,24 @@ public:
         return NodedSegmentString::getNodedSubstrings(*nodedSegStrings);
     }
 
+    /** \brief
+     * Sets the number of threads used to find intersections.
+     *
+     * Overlapping monotone chains are found on up to `n` threads
+     * (0 = hardware concurrency, default 1), if the SegmentIntersector
+     * is an IntersectionAdder or a SnapRoundingIntersectionAdder. The
+     * segments are intersected on these threads too, and the nodes found
+     * are added to the segment strings afterwards, in the same order as
+     * by a single thread, so the result is the same.
+     * Other SegmentIntersectors, which may not be safe to call from
+     * several threads, are always run on the calling thread.
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
     void computeNodes(std::vector<SegmentString*>* inputSegmentStrings) override;
 
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
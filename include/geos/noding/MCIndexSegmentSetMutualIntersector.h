@@ -19,6 +19,8 @@
 #include <geos/index/chain/MonotoneChain.h> // inherited
 #include <geos/index/strtree/TemplateSTRtree.h> // inherited
 
+#include <mutex>
+
 namespace geos {
 namespace geom {
     class Envelope;
@@ -53,7 +55,6 @@ public:
         , processCounter(0)
         , nOverlaps(0)
         , overlapTolerance(p_tolerance)
-        , indexBuilt(false)
         , envelope(nullptr)
     {}
 
@@ -63,7 +64,6 @@ public:
         , processCounter(0)
         , nOverlaps(0)
         , overlapTolerance(0.0)
-        , indexBuilt(false)
         , envelope(p_envelope)
     {}
 
@@ -85,6 +85,19 @@ public:
     // NOTE: re-populates the MonotoneChain vector with newly created chains
     void process(SegmentString::ConstVect* segStrings) override;
 
+    /** \brief
+     * Computes the intersections between the base segments and the given
+     * segment strings, reporting them to the given intersector.
+     *
+     * Unlike process(SegmentString::ConstVect*), this keeps no state
+     * between calls, so once the base segments have been set it may be
+     * called from several threads at once (each with its own intersector).
+     *
+     * @param segStrings the segment strings to intersect with the base segments
+     * @param si the intersector receiving the intersections
+     */
+    void process(SegmentString::ConstVect* segStrings, SegmentIntersector& si);
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
     private:
         SegmentIntersector& si;
@@ -129,15 +142,17 @@ private:
     /* memory management helper, holds MonotoneChain objects used
      * in the SpatialIndex. It's cleared when the SpatialIndex is
      */
-    bool indexBuilt;
+    std::once_flag indexBuilt;
     MonoChains indexChains;
     const geom::Envelope* envelope;
 
     void addToIndex(SegmentString* segStr);
 
-    void intersectChains();
+    void buildIndex();
+
+    int intersectChains(MonoChains& chains, SegmentIntersector& si);
 
-    void addToMonoChains(SegmentString* segStr);
+    void addToMonoChains(SegmentString* segStr, MonoChains& chains) const;
 
 };
 
@@ -99,9 +99,12 @@ public:
     * Visits all the hot pixels which may intersect a segment (p0-p1).
     * The visitor must determine whether each hot pixel actually intersects
     * the segment.
+    *
+    * Once all hot pixels have been added, queries do not modify the
+    * index, and may be run concurrently.
     */
     void query(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1,
-               index::kdtree::KdNodeVisitor& visitor);
+               index::kdtree::KdNodeVisitor& visitor) const;
 
 };
 
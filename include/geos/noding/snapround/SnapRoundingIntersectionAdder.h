@@ -93,6 +93,24 @@ private:
 
 public:
 
+    /** \brief
+     * The intersections found in a batch of segment pairs, to be added
+     * to the segment strings later.
+     *
+     * @see computeIntersections
+     * @see addBatch
+     */
+    struct GEOS_DLL Batch {
+        struct Node {
+            NodedSegmentString* segString;
+            geom::CoordinateXYZM pt;
+            std::size_t segIndex;
+        };
+
+        std::vector<Node> nodes;
+        geom::CoordinateSequence intersections = geom::CoordinateSequence::XYZM(0);
+    };
+
     SnapRoundingIntersectionAdder(double p_nearnessTol)
         : SegmentIntersector()
         , intersections(geom::CoordinateSequence::XYZM(0))
@@ -101,6 +119,8 @@ public:
 
     geom::CoordinateSequence getIntersections() { return std::move(intersections); };
 
+    const algorithm::LineIntersector& getLineIntersector() const { return li; };
+
     /**
     * This method is called by clients
     * of the {@link SegmentIntersector} class to process
@@ -111,6 +131,25 @@ public:
     */
     void processIntersections(SegmentString* e0, std::size_t segIndex0, SegmentString* e1, std::size_t segIndex1) override;
 
+    /**
+    * Intersects two segments as processIntersections() does, recording
+    * the nodes and intersection points in a batch instead of adding them.
+    *
+    * Neither this object nor the segment strings are modified, so
+    * several threads may call this method, each with its own
+    * LineIntersector and Batch.
+    */
+    void computeIntersections(SegmentString* e0, std::size_t segIndex0,
+                              SegmentString* e1, std::size_t segIndex1,
+                              algorithm::LineIntersector& batchLi, Batch& batch) const;
+
+    /**
+    * Adds the nodes and intersection points of a batch.
+    * Adding batches in the order of their segment pairs gives the same
+    * result as calling processIntersections() for each pair in that order.
+    */
+    void addBatch(const Batch& batch);
+
     /**
     * Always process all intersections
     *
@@ -77,10 +77,22 @@ private:
     */
     static constexpr int INTERSECTION_NEARNESS_FACTOR = 100;
 
+    /**
+    * A hot pixel intersecting a segment, found while snapping
+    * segment strings on several threads.
+    */
+    struct PixelHit {
+        HotPixel* hp;
+        std::size_t segIndex;
+        // whether the hot pixel contains a segment vertex
+        bool hasVertex;
+    };
+
     // Members
     const geom::PrecisionModel* pm;
     noding::snapround::HotPixelIndex pixelIndex;
     std::vector<SegmentString*> snappedResult;
+    std::size_t numThreads;
 
     // Methods
     void snapRound(std::vector<SegmentString*>& inputSegStrings, std::vector<SegmentString*>& resultNodedSegments);
@@ -118,7 +130,21 @@ private:
     * @return the snapped segment strings
     */
     void computeSnaps(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped);
-    NodedSegmentString* computeSegmentSnaps(NodedSegmentString* ss);
+
+    /**
+    * Computes the snapped segment strings on several threads.
+    * Hot pixels are found in parallel, marked as nodes serially in
+    * input order, and then added to the snapped segment strings
+    * in parallel, giving the same result as computeSnaps().
+    */
+    void computeSnapsParallel(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped);
+
+    /**
+    * Rounds a segment string and snaps its segments to hot pixels.
+    * If hits is not null, the hot pixels intersecting the segments are
+    * recorded in it instead of being snapped to, and no hot pixel is modified.
+    */
+    NodedSegmentString* computeSegmentSnaps(NodedSegmentString* ss, std::vector<PixelHit>* hits = nullptr);
 
     /**
     * Snaps a segment in a segmentString to HotPixels that it intersects.
@@ -130,21 +156,37 @@ private:
     */
     void snapSegment(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1, NodedSegmentString* ss, std::size_t segIndex);
 
+    /**
+    * Records the HotPixels that a segment intersects.
+    */
+    void findSegmentHits(const geom::CoordinateXY& p0, const geom::CoordinateXY& p1, std::size_t segIndex,
+                         std::vector<PixelHit>& hits) const;
+
     /**
     * Add nodes for any vertices in hot pixels that were
     * added as nodes during segment noding.
     */
-    void addVertexNodeSnaps(NodedSegmentString* ss);
+    void addVertexNodeSnaps(NodedSegmentString* ss) const;
 
-    void snapVertexNode(const geom::CoordinateXY& p0, NodedSegmentString* ss, std::size_t segIndex);
+    void snapVertexNode(const geom::CoordinateXY& p0, NodedSegmentString* ss, std::size_t segIndex) const;
 
 public:
 
     SnapRoundingNoder(const geom::PrecisionModel* p_pm)
         : pm(p_pm)
         , pixelIndex(p_pm)
+        , numThreads(1)
         {}
 
+    /**
+    * Sets the number of threads used to find intersections and to snap
+    * segment strings to hot pixels (0 = hardware concurrency, default 1).
+    *
+    * The hot pixel index is built by the calling thread;
+    * the result is the same as with a single thread.
+    */
+    void setNumThreads(std::size_t n) { numThreads = n; }
+
     /**
     * @return a Collection of NodedSegmentStrings representing the substrings
     */
@@ -99,9 +99,11 @@ private:
     IntersectionAdder intAdder;
     std::unique_ptr<Noder> internalNoder;
     std::unique_ptr<Noder> spareInternalNoder;
-    // EdgeSourceInfo*, Edge* owned by EdgeNodingBuilder, stored in deque
+    // EdgeSourceInfo*, Edge* and input NodedSegmentString*
+    // owned by EdgeNodingBuilder, stored in deque
     std::deque<EdgeSourceInfo> edgeSourceInfoQue;
     std::deque<Edge> edgeQue;
+    std::deque<NodedSegmentString> inputEdgeQue;
     bool inputHasZ;
     bool inputHasM;
 
@@ -207,13 +209,6 @@ public:
         , inputHasM(false)
         {};
 
-    ~EdgeNodingBuilder()
-    {
-        for (SegmentString* ss: *inputEdges) {
-            delete ss;
-        }
-    }
-
     void setClipEnvelope(const Envelope* clipEnv);
 
     // returns newly allocated vector and segmentstrings
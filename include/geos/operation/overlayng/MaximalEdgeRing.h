@@ -16,6 +16,7 @@
 
 #include <geos/operation/overlayng/OverlayEdgeRing.h>
 
+#include <deque>
 #include <vector>
 #include <memory>
 #include <geos/export.h>
@@ -95,7 +96,13 @@ public:
         attachEdges(e);
     };
 
-    std::vector<std::unique_ptr<OverlayEdgeRing>> buildMinimalRings(const GeometryFactory* geometryFactory);
+    /**
+    * Builds the minimal rings of this maximal ring.
+    * The rings are created in the supplied storage, which
+    * must outlive the returned pointers.
+    */
+    std::vector<OverlayEdgeRing*> buildMinimalRings(const GeometryFactory* geometryFactory,
+        std::deque<OverlayEdgeRing>& ringStore);
 
     /**
     * Traverses the star of edges originating at a node
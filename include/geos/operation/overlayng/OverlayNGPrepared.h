@@ -0,0 +1,107 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class PrecisionModel;
+namespace prep {
+class PreparedGeometry;
+}
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * \brief Overlays many geometries with one prepared polygonal mask.
+ *
+ * For INTERSECTION and DIFFERENCE of a polygonal geometry with the mask
+ * (in that order), each polygon of the geometry is first located with
+ * the predicates of the PreparedGeometry:
+ *
+ *  - a polygon disjoint from the mask is dropped from an INTERSECTION,
+ *    and copied unchanged to the result of a DIFFERENCE
+ *  - a polygon covered by the mask is copied unchanged to the result
+ *    of an INTERSECTION, and dropped from a DIFFERENCE
+ *  - the other polygons are overlaid with the mask by OverlayNG.
+ *
+ * This avoids noding the polygons which do not interact with the mask,
+ * which is most of them when clipping many small features with one
+ * large mask.
+ *
+ * The shortcuts are only taken with a FLOATING precision model, since
+ * with a FIXED one all the result vertices must be rounded.
+ * Other operations, and inputs which are not polygonal,
+ * are overlaid with OverlayNG.
+ */
+class GEOS_DLL OverlayNGPrepared {
+
+public:
+
+    /**
+     * Creates an overlay operation with a prepared mask.
+     *
+     * @param mask the prepared mask, which must outlive this object
+     * @param pm the precision model to use, or null to use
+     *           the precision model of each input
+     */
+    OverlayNGPrepared(const geom::prep::PreparedGeometry& mask, const geom::PrecisionModel* pm = nullptr);
+
+    /**
+     * Computes an overlay of a geometry with the mask.
+     *
+     * @param geom the first geometry
+     * @param opCode the overlay operation code (see OverlayNG)
+     * @return the result of the overlay operation
+     */
+    std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* geom, int opCode) const;
+
+    /**
+     * Computes an overlay of a geometry with a prepared mask.
+     *
+     * @param geom the first geometry
+     * @param mask the prepared mask
+     * @param opCode the overlay operation code (see OverlayNG)
+     * @param pm the precision model to use, or null to use
+     *           the precision model of the geometry
+     * @return the result of the overlay operation
+     */
+    static std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* geom,
+            const geom::prep::PreparedGeometry& mask, int opCode, const geom::PrecisionModel* pm = nullptr);
+
+private:
+
+    const geom::prep::PreparedGeometry& mask;
+    const geom::PrecisionModel* pm;
+    bool isMaskPolygonal;
+
+    // Declare type as noncopyable
+    OverlayNGPrepared(const OverlayNGPrepared& other) = delete;
+    OverlayNGPrepared& operator=(const OverlayNGPrepared& rhs) = delete;
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
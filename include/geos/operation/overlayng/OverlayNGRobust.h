@@ -23,6 +23,12 @@
 #include <geos/operation/union/UnionStrategy.h>
 #include <geos/operation/overlayng/OverlayNG.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
 
 // Forward declarations
 namespace geos {
@@ -51,6 +57,12 @@ namespace overlayng { // geos.operation.overlayng
  * If the above heuristics still fail to compute a valid overlay,
  * the original {@link util::TopologyException} is thrown.
  *
+ * The attempts made can be counted and timed in a Stats object,
+ * and the sequence of attempts can start from a later one
+ * (for instance the one which has most often succeeded
+ * for similar inputs), skipping the earlier ones unless
+ * all the later ones fail.
+ *
  * This algorithm relies on each overlay operation execution
  * throwing a {@link util::TopologyException} if it is unable
  * to compute the overlay correctly.
@@ -74,6 +86,9 @@ private:
     */
     static constexpr double SNAP_TOL_FACTOR = 1e12;
 
+    // Number of distinct attempts, in the order they are made
+    static constexpr std::size_t NUM_ATTEMPTS = 2 + 2 * NUM_SNAP_TRIES;
+
     static std::unique_ptr<Geometry> overlaySnapping(
         const Geometry* geom0, const Geometry* geom1, int opCode, double snapTol);
 
@@ -121,6 +136,92 @@ private:
 
 public:
 
+    /**
+    * The strategies used to compute an overlay, in the order they are tried.
+    */
+    enum Strategy {
+        /// OverlayNG with a FLOATING precision model and validated noding
+        FLOATING,
+        /// OverlayNG with a SnappingNoder
+        SNAPPING,
+        /// As SNAPPING, after snapping each input to itself
+        SNAP_SELF,
+        /// OverlayNG with snap-rounding at a safe scale
+        SNAP_ROUNDING
+    };
+
+    /**
+    * An attempt at computing an overlay. SNAPPING and SNAP_SELF are
+    * tried NUM_SNAP_TRIES times, alternately, with the snap tolerance
+    * multiplied by 10 at each try.
+    */
+    struct Attempt {
+        Strategy strategy;
+        /// Number of times the snap tolerance was increased (SNAPPING and SNAP_SELF only)
+        int snapTry;
+
+        Attempt(Strategy p_strategy = FLOATING, int p_snapTry = 0)
+            : strategy(p_strategy)
+            , snapTry(p_snapTry)
+        {}
+
+        bool operator==(const Attempt& other) const
+        {
+            return strategy == other.strategy && snapTry == other.snapTry;
+        }
+    };
+
+    /**
+    * Counts and times the attempts made to compute overlays.
+    * Only overlays of inputs with a FLOATING precision model are counted.
+    * A Stats object can be shared by overlays running on several threads.
+    */
+    class GEOS_DLL Stats {
+
+    public:
+
+        Stats() { reset(); }
+
+        /// Gets the number of times an attempt was made
+        std::size_t getNumAttempts(const Attempt& attempt) const
+        {
+            return numAttempts[attemptIndex(attempt)];
+        }
+
+        /// Gets the number of times an attempt computed the overlay
+        std::size_t getNumSuccesses(const Attempt& attempt) const
+        {
+            return numSuccesses[attemptIndex(attempt)];
+        }
+
+        /// Gets the total time spent in an attempt, in seconds
+        double getTime(const Attempt& attempt) const;
+
+        /**
+        * Gets the attempt which has most often computed the overlay,
+        * or the first attempt if none has.
+        * It can be used as the start of later overlays of similar inputs.
+        */
+        Attempt getMostSuccessful() const;
+
+        /// Resets all counters to zero
+        void reset();
+
+    private:
+
+        friend class OverlayNGRobust;
+
+        std::array<std::atomic<std::size_t>, NUM_ATTEMPTS> numAttempts;
+        std::array<std::atomic<std::size_t>, NUM_ATTEMPTS> numSuccesses;
+        std::array<std::atomic<std::int64_t>, NUM_ATTEMPTS> nanoseconds;
+
+        void record(std::size_t index, bool isSuccess, std::chrono::steady_clock::duration time);
+
+        // Declare type as noncopyable
+        Stats(const Stats& other) = delete;
+        Stats& operator=(const Stats& rhs) = delete;
+    };
+
     class SRUnionStrategy : public operation::geounion::UnionStrategy {
 
         std::unique_ptr<geom::Geometry> Union(const geom::Geometry* g0, const geom::Geometry* g1) override
@@ -153,6 +254,21 @@ public:
     static std::unique_ptr<Geometry> Overlay(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
+    /**
+    * Computes an overlay, starting from a given attempt.
+    * If it and all the later attempts fail, the earlier attempts are made.
+    *
+    * @param geom0 the first geometry
+    * @param geom1 the second geometry
+    * @param opCode the overlay operation code (see OverlayNG)
+    * @param stats the counters of attempts to update (may be null)
+    * @param start the first attempt to make
+    * @return the result of the overlay operation
+    */
+    static std::unique_ptr<Geometry> Overlay(
+        const Geometry* geom0, const Geometry* geom1, int opCode,
+        Stats* stats, const Attempt& start = Attempt());
+
     static std::unique_ptr<Geometry> overlaySnapTries(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
@@ -162,8 +278,20 @@ public:
     */
     static double snapTolerance(const Geometry* geom0, const Geometry* geom1);
 
+private:
+
+    static std::size_t attemptIndex(const Attempt& attempt);
 
+    static Attempt attemptAt(std::size_t index);
 
+    /**
+    * Makes an attempt at an overlay.
+    *
+    * @return the result, or null if the attempt failed
+    */
+    static std::unique_ptr<Geometry> overlayAttempt(
+        const Geometry* geom0, const Geometry* geom1, int opCode,
+        std::size_t index, double snapTol, std::runtime_error& exFloating);
 
 };
 
@@ -0,0 +1,205 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class LinearRing;
+class PrecisionModel;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * \brief Computes the overlay of two polygonal geometries tile by tile.
+ *
+ * The extent of the inputs is divided by a grid, sized so that tiles
+ * hold about a given number of input vertices. The grid cells are grouped
+ * into tiles by splitting the extent recursively until the inputs have
+ * at most that number of vertices in each tile. The inputs are clipped
+ * to the tiles with RectangleIntersection, and each tile is overlaid
+ * independently with OverlayNG, optionally on several threads, so the
+ * size of each overlay graph is bounded by the size of a tile rather
+ * than of the inputs.
+ *
+ * Before clipping, a vertex is added to the input edges wherever they
+ * cross a grid line. The crossing point only depends on the edge, so
+ * clipping never computes new coordinates on a tile boundary, and the
+ * inputs on both sides of it have the same vertices along it.
+ * The tile results are joined without an overlay: the vertices of the
+ * tile results on a tile boundary are added to the results on the other
+ * side of it, and the polygons sharing edges along the boundary are
+ * merged by cutting their rings at the shared edges and linking what
+ * is left into new rings. Beyond the result itself, this needs memory
+ * in proportion to the number of vertices on tile boundaries.
+ *
+ * The semantics are those of OverlayNG in strict mode: the result of an
+ * overlay of polygons is polygonal.
+ * With a FLOATING precision model the vertices added at grid lines are
+ * removed from the result, which then has the vertices of an overlay
+ * without tiling, except for intersection points on edges crossing a
+ * grid line, which are computed from a part of the edge and so may
+ * differ from it in the last bits.
+ * With a FIXED precision model the grid lines are on the precision grid
+ * and the tiles are snap-rounded independently, so edges crossing tile
+ * boundaries keep a vertex at the crossing point, and vertices near tile
+ * boundaries may differ slightly from those of an overlay without tiling.
+ * Parts of a tile result which collapse to lines are dropped.
+ *
+ * Inputs which are not both polygonal are overlaid without tiling.
+ * If the overlay of a tile fails, the inputs are overlaid without tiling:
+ * with OverlayNG and the same precision model if it is FIXED, and with
+ * OverlayNGRobust if it is FLOATING.
+ */
+class GEOS_DLL OverlayNGTiled {
+
+public:
+
+    /// Default maximum number of input vertices in a tile
+    static constexpr std::size_t MAX_TILE_VERTICES_DEFAULT = 50000;
+
+    /**
+     * Creates a tiled overlay operation with a defined precision model.
+     *
+     * @param geom0 the first geometry
+     * @param geom1 the second geometry
+     * @param pm the precision model to use
+     * @param opCode the overlay operation code (see OverlayNG)
+     */
+    OverlayNGTiled(const geom::Geometry* geom0, const geom::Geometry* geom1,
+                   const geom::PrecisionModel* pm, int opCode);
+
+    /**
+     * Creates a tiled overlay operation using the precision model
+     * of the first geometry.
+     */
+    OverlayNGTiled(const geom::Geometry* geom0, const geom::Geometry* geom1, int opCode);
+
+    /**
+     * Sets the maximum number of vertices of both inputs in a tile.
+     * Tiles are not split further once they reach this size.
+     */
+    void setMaxTileVertices(std::size_t n) { maxTileVertices = n; }
+
+    /**
+     * Sets the number of threads used to overlay the tiles
+     * (0 = hardware concurrency, default 1).
+     * The result does not depend on the number of threads.
+     */
+    void setNumThreads(std::size_t n) { numThreads = n; }
+
+    /**
+     * Gets the result of the overlay operation.
+     *
+     * @return the result of the overlay operation
+     */
+    std::unique_ptr<geom::Geometry> getResult();
+
+    /**
+     * Computes an overlay operation tile by tile.
+     *
+     * @param geom0 the first geometry
+     * @param geom1 the second geometry
+     * @param opCode the overlay operation code (see OverlayNG)
+     * @param pm the precision model to use
+     * @param numThreads the number of threads (0 = hardware concurrency)
+     * @return the result of the overlay operation
+     */
+    static std::unique_ptr<geom::Geometry> overlay(const geom::Geometry* geom0, const geom::Geometry* geom1,
+            int opCode, const geom::PrecisionModel* pm, std::size_t numThreads = 1);
+
+private:
+
+    // Limits the number of grid cells along each axis
+    static constexpr std::size_t MAX_GRID_CELLS = 256;
+
+    // A range of grid cells and the parts of the inputs in it
+    struct Tile {
+        std::size_t ix0, ix1, iy0, iy1;
+        std::unique_ptr<geom::Geometry> geom[2];
+
+        std::size_t numCells() const { return (ix1 - ix0) * (iy1 - iy0); }
+    };
+
+    const geom::Geometry* geom0;
+    const geom::Geometry* geom1;
+    const geom::PrecisionModel* pm;
+    int opCode;
+    std::size_t maxTileVertices;
+    std::size_t numThreads;
+
+    // Ordinates of the grid lines, including the bounds of the extent
+    std::vector<double> gridX;
+    std::vector<double> gridY;
+
+    // Points added to the inputs where their edges cross grid lines,
+    // with a FLOATING precision model
+    std::unordered_set<geom::CoordinateXY, geom::CoordinateXY::HashCode> crossings;
+
+    std::unique_ptr<geom::Geometry> overlayTiled();
+
+    std::unique_ptr<geom::Geometry> overlayUntiled() const;
+
+    bool computeGrid(const geom::Envelope& env, std::size_t numPts);
+
+    std::unique_ptr<geom::Geometry> nodeToGrid(const geom::Geometry& geom);
+
+    std::unique_ptr<geom::CoordinateSequence> nodeToGrid(const geom::CoordinateSequence& ring);
+
+    geom::Envelope envelope(const Tile& tile) const;
+
+    void partition(Tile root, std::vector<Tile>& leaves) const;
+
+    bool isEmptyResult(const Tile& tile) const;
+
+    std::unique_ptr<geom::Geometry> overlayTile(const Tile& tile) const;
+
+    std::unique_ptr<geom::LinearRing> createRing(std::unique_ptr<geom::CoordinateSequence> pts) const;
+
+    std::unique_ptr<geom::Geometry> stitch(std::vector<std::unique_ptr<geom::Geometry>>& tileResults) const;
+
+    // Declare type as noncopyable
+    OverlayNGTiled(const OverlayNGTiled& other) = delete;
+    OverlayNGTiled& operator=(const OverlayNGTiled& rhs) = delete;
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -24,6 +24,10 @@
 
 #include <geos/operation/union/UnionStrategy.h>
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 // Forward declarations
 namespace geos {
 namespace geom {
@@ -140,6 +144,20 @@ public:
     static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys);
     static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun);
 
+    /** \brief
+     * Computes the union of a collection of polygonal [Geometrys](@ref geom::Geometry),
+     * running independent subtree unions on up to `numThreads` threads.
+     *
+     * @param polys a collection of polygonal [Geometrys](@ref geom::Geometry).
+     *              ownership of elements *and* vector are left to caller.
+     * @param unionFun strategy to apply; must be safe to call concurrently
+     * @param numThreads maximum number of threads (0 = hardware concurrency)
+     *
+     * @see setNumThreads
+     */
+    static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun,
+                                                 std::size_t numThreads);
+
     /** \brief
      * Computes the union of a set of polygonal [Geometrys](@ref geom::Geometry).
      *
@@ -147,17 +165,18 @@ public:
      * @param start start iterator
      * @param end end iterator
      * @param unionStrategy strategy to apply
+     * @param numThreads maximum number of threads (0 = hardware concurrency)
      */
     template <class T>
     static std::unique_ptr<geom::Geometry>
-    Union(T start, T end, UnionStrategy *unionStrategy)
+    Union(T start, T end, UnionStrategy *unionStrategy, std::size_t numThreads = 1)
     {
         std::vector<geom::Polygon*> polys;
         for(T i = start; i != end; ++i) {
             const geom::Polygon* p = dynamic_cast<const geom::Polygon*>(*i);
             polys.push_back(const_cast<geom::Polygon*>(p));
         }
-        return Union(&polys, unionStrategy);
+        return Union(&polys, unionStrategy, numThreads);
     }
 
     /** \brief
@@ -179,14 +198,34 @@ public:
         : inputPolys(polys)
         , geomFactory(nullptr)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {}
 
     CascadedPolygonUnion(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun)
         : inputPolys(polys)
         , geomFactory(nullptr)
         , unionFunction(unionFun)
+        , numThreads(1)
     {}
 
+    /** \brief
+     * Sets the maximum number of threads used to compute the union.
+     *
+     * The partial unions of disjoint subtrees of the cascade are
+     * independent, so they can be computed concurrently. The tree shape
+     * does not depend on the thread count, so the result is identical
+     * to the single-threaded one.
+     *
+     * When more than one thread is used the union strategy must be
+     * safe to call concurrently (the default strategy is).
+     *
+     * @param n maximum number of threads (0 = hardware concurrency, default 1)
+     */
+    void setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
     /** \brief
      * Computes the union of the input geometries.
      *
@@ -199,6 +238,7 @@ private:
 
     UnionStrategy* unionFunction;
     ClassicUnionStrategy defaultUnionFunction;
+    std::size_t numThreads;
 
     /**
      * Unions a section of a list using a recursive binary union on each half
@@ -211,6 +251,20 @@ private:
      */
     std::unique_ptr<geom::Geometry> binaryUnion(const std::vector<const geom::Geometry*> & geoms, std::size_t start, std::size_t end);
 
+    /**
+     * Unions a section of a list in the same way as binaryUnion,
+     * handing the left half of each split to another thread
+     * until the thread budget is used up.
+     *
+     * @param geoms the list of geometries containing the section to union
+     * @param start the start index of the section
+     * @param end the index after the end of the section
+     * @param threads the number of threads available for this section
+     * @return the union of the list section
+     */
+    std::unique_ptr<geom::Geometry> binaryUnionParallel(const std::vector<const geom::Geometry*> & geoms,
+                                                        std::size_t start, std::size_t end, std::size_t threads);
+
     /**
      * Computes the union of two geometries,
      * either of both of which may be null.
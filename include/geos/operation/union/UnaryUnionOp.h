@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -116,6 +117,7 @@ public:
     UnaryUnionOp(const T& geoms, geom::GeometryFactory& geomFactIn)
         : geomFact(&geomFactIn)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extractGeoms(geoms);
     }
@@ -124,6 +126,7 @@ public:
     UnaryUnionOp(const T& geoms)
         : geomFact(nullptr)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extractGeoms(geoms);
     }
@@ -131,6 +134,7 @@ public:
     UnaryUnionOp(const geom::Geometry& geom)
         : geomFact(geom.getFactory())
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extract(geom);
     }
@@ -140,6 +144,25 @@ public:
         unionFunction = unionFun;
     }
 
+    /**
+     * \brief
+     * Sets the maximum number of threads used to union the polygonal
+     * components.
+     *
+     * Independent partial unions of the polygon cascade are then computed
+     * concurrently. The result is identical to the single-threaded one.
+     * When a custom union function is set, it must be safe to call
+     * concurrently.
+     *
+     * @param n maximum number of threads (0 = hardware concurrency, default 1)
+     *
+     * @see CascadedPolygonUnion::setNumThreads
+     */
+    void setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
     /**
      * \brief
      * Gets the union of the input geometries.
@@ -229,6 +252,7 @@ private:
 
     UnionStrategy* unionFunction;
     ClassicUnionStrategy defaultUnionFunction;
+    std::size_t numThreads;
 
 };
 
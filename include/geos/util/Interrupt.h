@@ -21,7 +21,13 @@ namespace util { // geos::util
 
 #define GEOS_CHECK_FOR_INTERRUPTS() geos::util::Interrupt::process()
 
-/** \brief Used to manage interruption requests and callbacks. */
+/** \brief Used to manage interruption requests and callbacks.
+ *
+ * The request flag and the callback are shared by all threads. An
+ * operation running on several threads (see util::parallelFor) checks
+ * for interruption from each of them, and the first thread to see a
+ * request clears it and stops the whole operation.
+ */
 class GEOS_DLL Interrupt {
 
 public:
@@ -51,6 +57,9 @@ public:
      *
      * The callback can be used to call Interrupt::request()
      *
+     * Multi-threaded operations invoke the callback from each of
+     * their threads, so it must be safe to call concurrently.
+     *
      */
     static Callback* registerCallback(Callback* cb);
 
@@ -0,0 +1,135 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * Resolves a requested number of worker threads.
+ *
+ * A request of 0 means "use all hardware threads".
+ *
+ * @param requested the requested number of threads
+ * @return the number of threads to use (always at least 1)
+ */
+inline std::size_t
+resolveThreadCount(std::size_t requested)
+{
+    if (requested == 0) {
+        requested = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(requested, 1);
+}
+
+/** \brief
+ * Invokes `f(begin, end)` over consecutive blocks of the index range `[0, n)`,
+ * distributing the blocks over up to `numThreads` threads.
+ *
+ * Blocks are handed out on demand, so threads that finish early pick up
+ * the remaining work. The calling thread participates in the work.
+ * If an invocation throws, blocks that have not yet started are skipped
+ * and the first exception is rethrown in the calling thread once all
+ * workers have stopped.
+ *
+ * The callable must be safe to invoke concurrently on disjoint blocks.
+ *
+ * @param n number of items
+ * @param numThreads maximum number of threads (0 = hardware concurrency)
+ * @param blockSize number of items per block
+ * @param f callable invoked as `f(std::size_t begin, std::size_t end)`
+ */
+template<typename F>
+void
+parallelFor(std::size_t n, std::size_t numThreads, std::size_t blockSize, F&& f)
+{
+    if (n == 0) {
+        return;
+    }
+    blockSize = std::max<std::size_t>(blockSize, 1);
+
+    const std::size_t numBlocks = (n + blockSize - 1) / blockSize;
+    numThreads = std::min(resolveThreadCount(numThreads), numBlocks);
+
+    if (numThreads == 1) {
+        for (std::size_t begin = 0; begin < n; begin += blockSize) {
+            f(begin, std::min(begin + blockSize, n));
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> nextBlock(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorLock;
+
+    auto worker = [&]() {
+        for (;;) {
+            if (failed.load(std::memory_order_relaxed)) {
+                return;
+            }
+            std::size_t block = nextBlock.fetch_add(1, std::memory_order_relaxed);
+            if (block >= numBlocks) {
+                return;
+            }
+            std::size_t begin = block * blockSize;
+            try {
+                f(begin, std::min(begin + blockSize, n));
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> guard(errorLock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t i = 1; i < numThreads; i++) {
+        try {
+            threads.emplace_back(worker);
+        }
+        catch (const std::system_error&) {
+            // Could not start another thread; carry on with the ones we have.
+            break;
+        }
+    }
+
+    worker();
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
+
@@ -21,10 +21,13 @@
 
 #include <geos/algorithm/Area.h>
 #include <geos/geom/CircularArc.h>
+#include <geos/geom/CoordinateColumns.h>
 #include <geos/geom/Curve.h>
 #include <geos/geom/SimpleCurve.h>
 #include <geos/util/IllegalArgumentException.h>
 
+#include "util/Simd.h"
+
 using geos::geom::CoordinateXY;
 
 namespace geos {
@@ -79,20 +82,72 @@ Area::ofRingSigned(const geom::CoordinateSequence* ring)
     /*
      * Based on the Shoelace formula.
      * http://en.wikipedia.org/wiki/Shoelace_formula
+     *
+     * Each Double2 holds the (x, y) of one point. The terms for two
+     * consecutive points are computed together and added to the sum
+     * one after the other, in the same order as a scalar loop.
+     */
+    using util::Double2;
+
+    const std::size_t s = ring->stride();
+    const double* p = ring->data();
+    const double x0 = p[0];
+    const Double2 x0x0 = Double2::broadcast(x0);
+
+    double sum = 0.0;
+    std::size_t i = 1;
+    for(; i + 2 < n; i += 2) {
+        const double* pi = p + i * s;
+        Double2 prev = Double2::load(pi - s);
+        Double2 curr = Double2::load(pi);
+        Double2 next = Double2::load(pi + s);
+        Double2 next2 = Double2::load(pi + 2 * s);
+
+        Double2 x = Double2::firsts(curr, next) - x0x0;
+        Double2 dy = Double2::seconds(prev, curr) - Double2::seconds(next, next2);
+        Double2 terms = x * dy;
+        sum += terms.first();
+        sum += terms.second();
+    }
+
+    for(; i < n - 1; i++) {
+        const double* pi = p + i * s;
+        sum += (pi[0] - x0) * ((pi - s)[1] - (pi + s)[1]);
+    }
+    return sum / 2.0;
+}
+
+/* public static */
+double
+Area::ofRingSigned(const geom::CoordinateColumns& ring)
+{
+    std::size_t n = ring.size();
+    if(n < 3) {
+        return 0.0;
+    }
+    /*
+     * Same computation as for a CoordinateSequence, reading the
+     * ordinates from contiguous columns.
      */
-    CoordinateXY p0, p1, p2;
-    p1 = ring->getAt<CoordinateXY>(0);
-    p2 = ring->getAt<CoordinateXY>(1);
-    double x0 = p1.x;
-    p2.x -= x0;
+    using util::Double2;
+
+    const double* xs = ring.x();
+    const double* ys = ring.y();
+    const double x0 = xs[0];
+    const Double2 x0x0 = Double2::broadcast(x0);
+
     double sum = 0.0;
-    for(std::size_t i = 1; i < n - 1; i++) {
-        p0.y = p1.y;
-        p1.x = p2.x;
-        p1.y = p2.y;
-        p2 = ring->getAt<CoordinateXY>(i + 1);
-        p2.x -= x0;
-        sum += p1.x * (p0.y - p2.y);
+    std::size_t i = 1;
+    for(; i + 2 < n; i += 2) {
+        Double2 x = Double2::load(xs + i) - x0x0;
+        Double2 dy = Double2::load(ys + i - 1) - Double2::load(ys + i + 1);
+        Double2 terms = x * dy;
+        sum += terms.first();
+        sum += terms.second();
+    }
+
+    for(; i < n - 1; i++) {
+        sum += (xs[i] - x0) * (ys[i - 1] - ys[i + 1]);
     }
     return sum / 2.0;
 }
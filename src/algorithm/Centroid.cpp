@@ -25,6 +25,8 @@
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/LineString.h>
 
+#include "util/Simd.h"
+
 
 #include <cmath> // for std::abs
 
@@ -118,9 +120,7 @@ Centroid::addShell(const CoordinateSequence& pts)
         setAreaBasePoint(pts.getAt<CoordinateXY>(0));
     }
     bool isPositiveArea = ! Orientation::isCCW(&pts);
-    for(std::size_t i = 0; i < len - 1; ++i) {
-        addTriangle(*areaBasePt, pts.getAt<CoordinateXY>(i), pts.getAt<CoordinateXY>(i + 1), isPositiveArea);
-    }
+    addTriangles(pts, isPositiveArea);
     addLineSegments(pts);
 }
 
@@ -133,40 +133,49 @@ Centroid::addHole(const CoordinateSequence& pts)
     }
 
     bool isPositiveArea = Orientation::isCCW(&pts);
-    for(std::size_t i = 0, e = pts.size() - 1; i < e; ++i) {
-        addTriangle(*areaBasePt, pts.getAt<CoordinateXY>(i), pts.getAt<CoordinateXY>(i + 1), isPositiveArea);
-    }
+    addTriangles(pts, isPositiveArea);
     addLineSegments(pts);
 }
 
 /* private */
 void
-Centroid::addTriangle(const CoordinateXY& p0, const CoordinateXY& p1, const CoordinateXY& p2, bool isPositiveArea)
+Centroid::addTriangles(const CoordinateSequence& pts, bool isPositiveArea)
 {
-    double sign = (isPositiveArea) ? 1.0 : -1.0;
-    centroid3(p0, p1, p2, triangleCent3);
-    double a2 = area2(p0, p1, p2);
-    cg3.x += sign * a2 * triangleCent3.x;
-    cg3.y += sign * a2 * triangleCent3.y;
-    areasum2 += sign * a2;
-}
+    std::size_t npts = pts.size();
+    if(npts < 2) {
+        return;
+    }
 
-/* static private */
-void
-Centroid::centroid3(const CoordinateXY& p1, const CoordinateXY& p2, const CoordinateXY& p3, CoordinateXY& c)
-{
-    c.x = p1.x + p2.x + p3.x;
-    c.y = p1.y + p2.y + p3.y;
-    return;
-}
+    // Each Double2 holds an (x, y) pair, so the x and y sums of the
+    // triangle centroids are updated together.
+    using util::Double2;
 
-/* static private */
-double
-Centroid::area2(const CoordinateXY& p1, const CoordinateXY& p2, const CoordinateXY& p3)
-{
-    return
-        (p2.x - p1.x) * (p3.y - p1.y) -
-        (p3.x - p1.x) * (p2.y - p1.y);
+    const double sign = (isPositiveArea) ? 1.0 : -1.0;
+    const std::size_t s = pts.stride();
+    const double* p = pts.data();
+    const double* last = p + (npts - 1) * s;
+
+    const Double2 base(areaBasePt->x, areaBasePt->y);
+    Double2 cg(cg3.x, cg3.y);
+
+    for(; p < last; p += s) {
+        Double2 p1 = Double2::load(p);
+        Double2 p2 = Double2::load(p + s);
+
+        // three times the centroid of the triangle base-p1-p2
+        Double2 cent3 = (base + p1) + p2;
+
+        // twice the signed area of the triangle base-p1-p2
+        Double2 d1 = p1 - base;
+        Double2 d2 = p2 - base;
+        double a2 = d1.first() * d2.second() - d2.first() * d1.second();
+
+        cg = cg + Double2::broadcast(sign * a2) * cent3;
+        areasum2 += sign * a2;
+    }
+
+    cg3.x = cg.first();
+    cg3.y = cg.second();
 }
 
 /* private */
@@ -174,22 +183,55 @@ void
 Centroid::addLineSegments(const CoordinateSequence& pts)
 {
     std::size_t npts = pts.size();
+    if(npts == 0) {
+        return;
+    }
+
+    using util::Double2;
+
+    const Double2 half = Double2::broadcast(0.5);
+    const std::size_t s = pts.stride();
+    const double* p = pts.data();
+    const double* last = p + (npts - 1) * s;
+
     double lineLen = 0.0;
-    for(std::size_t i = 0; i < npts - 1; i++) {
-        double segmentLen = pts.getAt<CoordinateXY>(i).distance(pts.getAt<CoordinateXY>(i + 1));
+    Double2 cent(lineCentSum.x, lineCentSum.y);
+
+    auto addSegment = [&](double segmentLen, const double* p0) {
         if(segmentLen == 0.0) {
-            continue;
+            return;
         }
-
         lineLen += segmentLen;
+        Double2 mid = (Double2::load(p0) + Double2::load(p0 + s)) * half;
+        cent = cent + Double2::broadcast(segmentLen) * mid;
+    };
+
+    // segment lengths are computed two at a time
+    for(; p + s < last; p += 2 * s) {
+        Double2 p0 = Double2::load(p);
+        Double2 p1 = Double2::load(p + s);
+        Double2 p2 = Double2::load(p + 2 * s);
+
+        Double2 d01 = p1 - p0;
+        Double2 d12 = p2 - p1;
+        d01 = d01 * d01;
+        d12 = d12 * d12;
+        Double2 segLen = Double2::sqrt(Double2::firsts(d01, d12) + Double2::seconds(d01, d12));
 
-        double midx = (pts.getAt<CoordinateXY>(i).x + pts.getAt<CoordinateXY>(i + 1).x) / 2;
-        lineCentSum.x += segmentLen * midx;
-        double midy = (pts.getAt<CoordinateXY>(i).y + pts.getAt<CoordinateXY>(i + 1).y) / 2;
-        lineCentSum.y += segmentLen * midy;
+        addSegment(segLen.first(), p);
+        addSegment(segLen.second(), p + s);
     }
+    if(p < last) {
+        double dx = p[s] - p[0];
+        double dy = p[s + 1] - p[1];
+        addSegment(std::sqrt(dx * dx + dy * dy), p);
+    }
+
+    lineCentSum.x = cent.first();
+    lineCentSum.y = cent.second();
+
     totalLength += lineLen;
-    if(lineLen == 0.0 && npts > 0) {
+    if(lineLen == 0.0) {
         addPoint(pts[0]);
     }
 }
@@ -20,6 +20,9 @@
 #include <vector>
 
 #include <geos/algorithm/Length.h>
+#include <geos/geom/CoordinateColumns.h>
+
+#include "util/Simd.h"
 
 namespace geos {
 namespace algorithm { // geos.algorithm
@@ -34,23 +37,66 @@ Length::ofLine(const geom::CoordinateSequence* pts)
         return 0.0;
     }
 
-    double len = 0.0;
+    using util::Double2;
+
+    const std::size_t s = pts->stride();
+    const double* p = pts->data();
+    const double* last = p + (n - 1) * s;
 
-    const geom::CoordinateXY& p = pts->getAt<geom::CoordinateXY>(0);
-    double x0 = p.x;
-    double y0 = p.y;
+    // Each Double2 holds the (x, y) of one point. Two segment lengths are
+    // computed at once, and added to the sum in order, so that the result
+    // is the same as adding up the segments one by one.
+    double len = 0.0;
+    for(; p + s < last; p += 2 * s) {
+        Double2 p0 = Double2::load(p);
+        Double2 p1 = Double2::load(p + s);
+        Double2 p2 = Double2::load(p + 2 * s);
 
-    for(std::size_t i = 1; i < n; i++) {
-        const geom::CoordinateXY& pi = pts->getAt<geom::CoordinateXY>(i);
-        double x1 = pi.x;
-        double y1 = pi.y;
-        double dx = x1 - x0;
-        double dy = y1 - y0;
+        Double2 d01 = p1 - p0;
+        Double2 d12 = p2 - p1;
+        d01 = d01 * d01;
+        d12 = d12 * d12;
+        Double2 segLen = Double2::sqrt(Double2::firsts(d01, d12) + Double2::seconds(d01, d12));
 
+        len += segLen.first();
+        len += segLen.second();
+    }
+    if(p < last) {
+        double dx = p[s] - p[0];
+        double dy = p[s + 1] - p[1];
         len += std::sqrt(dx * dx + dy * dy);
+    }
+    return len;
+}
 
-        x0 = x1;
-        y0 = y1;
+/* public static */
+double
+Length::ofLine(const geom::CoordinateColumns& pts)
+{
+    std::size_t n = pts.size();
+    if(n <= 1) {
+        return 0.0;
+    }
+
+    using util::Double2;
+
+    const double* xs = pts.x();
+    const double* ys = pts.y();
+
+    double len = 0.0;
+    std::size_t i = 1;
+    for(; i + 1 < n; i += 2) {
+        Double2 dx = Double2::load(xs + i) - Double2::load(xs + i - 1);
+        Double2 dy = Double2::load(ys + i) - Double2::load(ys + i - 1);
+        Double2 segLen = Double2::sqrt(dx * dx + dy * dy);
+
+        len += segLen.first();
+        len += segLen.second();
+    }
+    if(i < n) {
+        double dx = xs[i] - xs[i - 1];
+        double dy = ys[i] - ys[i - 1];
+        len += std::sqrt(dx * dx + dy * dy);
     }
     return len;
 }
@@ -129,6 +129,16 @@ RayCrossingCounter::processSequence(const geom::CoordinateSequence& seq, bool is
 void
 RayCrossingCounter::countSegment(const geom::CoordinateXY& p1,
                                  const geom::CoordinateXY& p2)
+{
+    countSegment(point, p1, p2, crossingCount, isPointOnSegment);
+}
+
+/*static*/ void
+RayCrossingCounter::countSegment(const geom::CoordinateXY& point,
+                                 const geom::CoordinateXY& p1,
+                                 const geom::CoordinateXY& p2,
+                                 std::size_t& crossingCount,
+                                 bool& isPointOnSegment)
 {
     // For each segment, check if it crosses
     // a horizontal ray running from the test point in
@@ -30,6 +30,8 @@
 #include <geos/index/ItemVisitor.h>
 
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 using geos::geom::CoordinateXY;
 
@@ -60,6 +62,8 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g
         nsegs += line->getCoordinatesRO()->size() - 1;
     }
     index = decltype(index)(10, nsegs);
+    numSegments = nsegs;
+    meanSegmentHeight = 0;
 
     for(const geom::LineString* line : lines) {
         //-- only include rings of Polygons or LinearRings
@@ -68,6 +72,13 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g
 
         addLine(line->getCoordinatesRO());
     }
+
+    if (nsegs > 0) {
+        meanSegmentHeight /= static_cast<double>(nsegs);
+    }
+
+    // build now rather than on first query, so that queries never modify the tree
+    index.build();
 }
 
 void
@@ -78,6 +89,7 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::addLine(const geom::Coordina
         auto r = std::minmax(seg.p0().y, seg.p1().y);
 
         index.insert(index::strtree::Interval(r.first, r.second), seg);
+        meanSegmentHeight += r.second - r.first;
     }
 }
 
@@ -104,9 +116,9 @@ IndexedPointInAreaLocator::IndexedPointInAreaLocator(const geom::Geometry& g)
 geom::Location
 IndexedPointInAreaLocator::locate(const geom::CoordinateXY* /*const*/ p)
 {
-    if (index == nullptr) {
+    std::call_once(indexBuilt, [this]() {
         buildIndex(areaGeom);
-    }
+    });
 
     algorithm::RayCrossingCounter rcc(*p);
 
@@ -117,6 +129,89 @@ IndexedPointInAreaLocator::locate(const geom::CoordinateXY* /*const*/ p)
     return rcc.getLocation();
 }
 
+void
+IndexedPointInAreaLocator::locateMany(const double* x, const double* y, std::size_t n,
+                                      geom::Location* locations)
+{
+    std::call_once(indexBuilt, [this]() {
+        buildIndex(areaGeom);
+    });
+
+    // With few segments, single point queries are cheap
+    // enough that sorting the points does not pay off.
+    constexpr std::size_t MIN_SEGMENTS_FOR_BATCHES = 2048;
+    if (index->getNumSegments() < MIN_SEGMENTS_FOR_BATCHES) {
+        PointOnGeometryLocator::locateMany(x, y, n, locations);
+        return;
+    }
+
+    struct PointState {
+        CoordinateXY pt;
+        std::size_t pos;
+        std::size_t crossingCount;
+        bool onSegment;
+    };
+
+    // Points are processed in order of Y. Points without a finite Y
+    // cannot be ordered, and are located one at a time.
+    std::vector<PointState> points;
+    points.reserve(n);
+    for (std::size_t i = 0; i < n; i++) {
+        CoordinateXY pt(x[i], y[i]);
+        if (std::isfinite(pt.y)) {
+            points.push_back({ pt, i, 0, false });
+        } else {
+            locations[i] = locate(&pt);
+        }
+    }
+    std::sort(points.begin(), points.end(), [](const PointState& a, const PointState& b) {
+        return a.pt.y < b.pt.y;
+    });
+
+    // The index query for a batch finds all segments overlapping the Y
+    // extent of the batch. Limiting that extent to the mean height of a
+    // segment keeps the number of segments found within about twice the
+    // number found for a single point.
+    constexpr std::size_t MAX_BATCH_SIZE = 64;
+    const double maxBatchHeight = index->getMeanSegmentHeight();
+
+    for (auto batchBegin = points.begin(); batchBegin != points.end(); ) {
+        const double ymin = batchBegin->pt.y;
+        auto batchEnd = std::next(batchBegin);
+        while (batchEnd != points.end() && batchEnd - batchBegin < static_cast<std::ptrdiff_t>(MAX_BATCH_SIZE)
+                && batchEnd->pt.y - ymin <= maxBatchHeight) {
+            ++batchEnd;
+        }
+        const double ymax = std::prev(batchEnd)->pt.y;
+
+        index->query(ymin, ymax, [batchBegin, batchEnd](const SegmentView& seg) {
+            const CoordinateXY& p0 = seg.p0();
+            const CoordinateXY& p1 = seg.p1();
+            auto r = std::minmax(p0.y, p1.y);
+
+            // test the points of the batch within the Y extent of the segment
+            auto it = std::lower_bound(batchBegin, batchEnd, r.first, [](const PointState& ps, double v) {
+                return ps.pt.y < v;
+            });
+            for (; it != batchEnd && it->pt.y <= r.second; ++it) {
+                RayCrossingCounter::countSegment(it->pt, p0, p1, it->crossingCount, it->onSegment);
+            }
+        });
+
+        for (auto it = batchBegin; it != batchEnd; ++it) {
+            if (it->onSegment) {
+                locations[it->pos] = geom::Location::BOUNDARY;
+            } else if (it->crossingCount % 2 == 1) {
+                locations[it->pos] = geom::Location::INTERIOR;
+            } else {
+                locations[it->pos] = geom::Location::EXTERIOR;
+            }
+        }
+
+        batchBegin = batchEnd;
+    }
+}
+
 
 } // geos::algorithm::locate
 } // geos::algorithm
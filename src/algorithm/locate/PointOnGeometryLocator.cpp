@@ -14,11 +14,36 @@
 
 
 #include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateColumns.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <vector>
 
 namespace geos {
 namespace algorithm { // geos::algorithm
 namespace locate { // geos::algorithm::locate
 
+void
+PointOnGeometryLocator::locateMany(const double* x, const double* y, std::size_t n,
+                                   geom::Location* locations)
+{
+    for (std::size_t i = 0; i < n; i++) {
+        geom::CoordinateXY pt(x[i], y[i]);
+        locations[i] = locate(&pt);
+    }
+}
+
+void
+PointOnGeometryLocator::locateMany(const geom::CoordinateSequence& pts, geom::Location* locations)
+{
+    std::vector<double> x(pts.size());
+    std::vector<double> y(pts.size());
+    geom::CoordinateColumns::copyToArrays(pts, x.data(), y.data(), nullptr, nullptr);
+
+    locateMany(x.data(), y.data(), pts.size(), locations);
+}
+
 } // geos::algorithm::locate
 } // geos::algorithm
 } // geos
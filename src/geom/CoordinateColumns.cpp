@@ -0,0 +1,116 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/CoordinateColumns.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/constants.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace geos {
+namespace geom { // geos::geom
+
+CoordinateColumns::CoordinateColumns(const CoordinateSequence& seq)
+    : m_x(seq.size())
+    , m_y(seq.size())
+    , m_hasZ(seq.hasZ())
+    , m_hasM(seq.hasM())
+{
+    if (m_hasZ) {
+        m_z.resize(seq.size());
+    }
+    if (m_hasM) {
+        m_m.resize(seq.size());
+    }
+
+    copyToArrays(seq, m_x.data(), m_y.data(),
+                 m_hasZ ? m_z.data() : nullptr,
+                 m_hasM ? m_m.data() : nullptr);
+}
+
+Envelope
+CoordinateColumns::getEnvelope() const
+{
+    if (isEmpty()) {
+        return Envelope();
+    }
+
+    const std::size_t n = size();
+    const double* xs = x();
+    const double* ys = y();
+
+    double xmin = std::numeric_limits<double>::infinity();
+    double ymin = std::numeric_limits<double>::infinity();
+    double xmax = -std::numeric_limits<double>::infinity();
+    double ymax = -std::numeric_limits<double>::infinity();
+
+    // separate loops over contiguous columns are easy for compilers to vectorize
+    for (std::size_t i = 0; i < n; i++) {
+        xmin = std::min(xmin, xs[i]);
+        xmax = std::max(xmax, xs[i]);
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        ymin = std::min(ymin, ys[i]);
+        ymax = std::max(ymax, ys[i]);
+    }
+
+    return Envelope(xmin, xmax, ymin, ymax);
+}
+
+void
+CoordinateColumns::copyToArrays(const CoordinateSequence& seq, double* x, double* y, double* z, double* m)
+{
+    std::size_t stride;
+    std::ptrdiff_t zOffset = -1;
+    std::ptrdiff_t mOffset = -1;
+
+    switch(seq.getCoordinateType()) {
+        case CoordinateType::XY: stride = 2; break;
+        case CoordinateType::XYZ: stride = 3; zOffset = 2; break;
+        case CoordinateType::XYM: stride = 3; mOffset = 2; break;
+        default: stride = 4; zOffset = 2; mOffset = 3; break;
+    }
+
+    const std::size_t n = seq.size();
+    const double* src = seq.data();
+
+    for (std::size_t i = 0; i < n; i++) {
+        x[i] = src[i * stride];
+        y[i] = src[i * stride + 1];
+    }
+
+    if (z) {
+        if (zOffset < 0) {
+            std::fill(z, z + n, DoubleNotANumber);
+        } else {
+            for (std::size_t i = 0; i < n; i++) {
+                z[i] = src[i * stride + static_cast<std::size_t>(zOffset)];
+            }
+        }
+    }
+
+    if (m) {
+        if (mOffset < 0) {
+            std::fill(m, m + n, DoubleNotANumber);
+        } else {
+            for (std::size_t i = 0; i < n; i++) {
+                m[i] = src[i * stride + static_cast<std::size_t>(mOffset)];
+            }
+        }
+    }
+}
+
+} // namespace geos::geom
+} // namespace geos
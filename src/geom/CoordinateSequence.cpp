@@ -23,12 +23,15 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/util.h>
 
+#include "util/Simd.h"
+
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
 #include <vector>
 #include <cassert>
 #include <iterator>
+#include <limits>
 #include <sstream>
 
 namespace geos {
@@ -505,9 +508,72 @@ CoordinateSequence::equalsIdentical(const CoordinateSequence& other) const
     return true;
 }
 
+namespace {
+
+/*
+ * Computes the minima and maxima of the (x, y) ordinates of the
+ * coordinates in [p, end) into bounds. Each lane holds (x, y). Two running minima
+ * and maxima are kept, so that consecutive coordinates do not wait on
+ * each other.
+ *
+ * If checkFinite is set, returns false if any x or y is NaN or infinite.
+ */
+template<bool checkFinite>
+bool
+computeBounds(const double* p, const double* end, std::size_t s, Envelope& bounds)
+{
+    using util::Double2;
+    Double2 lo0 = Double2::broadcast(std::numeric_limits<double>::infinity());
+    Double2 hi0 = Double2::broadcast(-std::numeric_limits<double>::infinity());
+    Double2 lo1 = lo0;
+    Double2 hi1 = hi0;
+    // v - v is NaN for a NaN or infinite v, and 0 otherwise
+    Double2 diff = Double2::broadcast(0.0);
+
+    for (; p + s < end; p += 2 * s) {
+        Double2 a = Double2::load(p);
+        Double2 b = Double2::load(p + s);
+        lo0 = Double2::min(a, lo0);
+        hi0 = Double2::max(a, hi0);
+        lo1 = Double2::min(b, lo1);
+        hi1 = Double2::max(b, hi1);
+        if (checkFinite) {
+            diff = diff + (a - a) + (b - b);
+        }
+    }
+    if (p < end) {
+        Double2 a = Double2::load(p);
+        lo0 = Double2::min(a, lo0);
+        hi0 = Double2::max(a, hi0);
+        if (checkFinite) {
+            diff = diff + (a - a);
+        }
+    }
+
+    Double2 lo = Double2::min(lo1, lo0);
+    Double2 hi = Double2::max(hi1, hi0);
+    bounds.init(lo.first(), hi.first(), lo.second(), hi.second());
+
+    return !checkFinite || diff.first() + diff.second() == 0.0;
+}
+
+} // anonymous namespace
+
 void
 CoordinateSequence::expandEnvelope(Envelope& env) const
 {
+    if (isEmpty()) {
+        return;
+    }
+
+    Envelope bounds;
+    if (computeBounds<true>(m_vect.data(), m_vect.data() + m_vect.size(), stride(), bounds)) {
+        env.expandToInclude(bounds);
+        return;
+    }
+
+    // Envelope::expandToInclude skips NaN ordinates one coordinate
+    // at a time, so keep its behaviour for the sequences having them.
     const std::size_t p_size = getSize();
     for(std::size_t i = 0; i < p_size; i++) {
         env.expandToInclude(getAt<CoordinateXY>(i));
@@ -520,19 +586,9 @@ CoordinateSequence::getEnvelope() const {
         return {};
     }
 
-    double xmin = std::numeric_limits<double>::infinity();
-    double ymin = std::numeric_limits<double>::infinity();
-    double xmax = -std::numeric_limits<double>::infinity();
-    double ymax = -std::numeric_limits<double>::infinity();
-
-    for (std::size_t i = 0; i < m_vect.size(); i += stride()) {
-        xmin = std::min(xmin, m_vect[i]);
-        xmax = std::max(xmax, m_vect[i]);
-        ymin = std::min(ymin, m_vect[i+1]);
-        ymax = std::max(ymax, m_vect[i+1]);
-    }
-
-    return {xmin, xmax, ymin, ymax};
+    Envelope bounds;
+    computeBounds<false>(m_vect.data(), m_vect.data() + m_vect.size(), stride(), bounds);
+    return bounds;
 }
 
 
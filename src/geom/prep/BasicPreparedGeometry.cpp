@@ -93,73 +93,73 @@ BasicPreparedGeometry::isAnyTargetComponentInTest(const geom::Geometry* testGeom
 bool
 BasicPreparedGeometry::within(const geom::Geometry* g) const
 {
-    return getRelateNG().within(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.within(g); });
 }
 
 bool
 BasicPreparedGeometry::contains(const geom::Geometry* g) const
 {
-    return getRelateNG().contains(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.contains(g); });
 }
 
 bool
 BasicPreparedGeometry::containsProperly(const geom::Geometry* g)	const
 {
-    return getRelateNG().relate(g, "T**FF*FF*");
+    return withRelateNG([&](RelateNG& rng) { return rng.relate(g, "T**FF*FF*"); });
 }
 
 bool
 BasicPreparedGeometry::coveredBy(const geom::Geometry* g) const
 {
-    return getRelateNG().coveredBy(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.coveredBy(g); });
 }
 
 bool
 BasicPreparedGeometry::covers(const geom::Geometry* g) const
 {
-    return getRelateNG().covers(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.covers(g); });
 }
 
 bool
 BasicPreparedGeometry::crosses(const geom::Geometry* g) const
 {
-    return getRelateNG().crosses(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.crosses(g); });
 }
 
 bool
 BasicPreparedGeometry::disjoint(const geom::Geometry* g)	const
 {
-    return getRelateNG().disjoint(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.disjoint(g); });
 }
 
 bool
 BasicPreparedGeometry::intersects(const geom::Geometry* g) const
 {
-    return getRelateNG().intersects(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.intersects(g); });
 }
 
 bool
 BasicPreparedGeometry::overlaps(const geom::Geometry* g)	const
 {
-    return getRelateNG().overlaps(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.overlaps(g); });
 }
 
 bool
 BasicPreparedGeometry::touches(const geom::Geometry* g) const
 {
-    return getRelateNG().touches(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.touches(g); });
 }
 
 bool
 BasicPreparedGeometry::relate(const geom::Geometry* g, const std::string& pat) const
 {
-    return getRelateNG().relate(g, pat);
+    return withRelateNG([&](RelateNG& rng) { return rng.relate(g, pat); });
 }
 
 std::unique_ptr<IntersectionMatrix>
 BasicPreparedGeometry::relate(const geom::Geometry* g) const
 {
-    return getRelateNG().relate(g);
+    return withRelateNG([&](RelateNG& rng) { return rng.relate(g); });
 }
 
 
@@ -18,11 +18,158 @@
 
 
 #include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Point.h>
+#include <geos/util/Parallel.h>
+
+#include <vector>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+namespace {
+
+typedef bool (PreparedGeometry::*Predicate)(const Geometry*) const;
+typedef bool (*LocationTest)(Location);
+
+// Number of items handed to a thread at a time
+constexpr std::size_t BLOCK_SIZE = 1024;
+
+void
+evaluateMany(const PreparedGeometry& pg, Predicate pred,
+             const Geometry* const* geoms, std::size_t n,
+             bool* results, std::size_t numThreads)
+{
+    util::parallelFor(n, numThreads, BLOCK_SIZE, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            results[i] = (pg.*pred)(geoms[i]);
+        }
+    });
+}
+
+void
+evaluateXYMany(const PreparedGeometry& pg, Predicate pred, LocationTest test,
+               algorithm::locate::PointOnGeometryLocator* locator,
+               const double* x, const double* y, std::size_t n,
+               bool* results, std::size_t numThreads)
+{
+    if (locator) {
+        const Envelope& env = *pg.getGeometry().getEnvelopeInternal();
+
+        // Points outside the envelope are exterior. The others
+        // are located together, so that the locator can share work.
+        util::parallelFor(n, numThreads, BLOCK_SIZE, [&](std::size_t begin, std::size_t end) {
+            std::vector<std::size_t> index;
+            std::vector<double> bx;
+            std::vector<double> by;
+            for (std::size_t i = begin; i < end; i++) {
+                if (env.contains(x[i], y[i])) {
+                    index.push_back(i);
+                    bx.push_back(x[i]);
+                    by.push_back(y[i]);
+                } else {
+                    results[i] = false;
+                }
+            }
+
+            std::vector<Location> locations(index.size());
+            locator->locateMany(bx.data(), by.data(), index.size(), locations.data());
+            for (std::size_t k = 0; k < index.size(); k++) {
+                results[index[k]] = test(locations[k]);
+            }
+        });
+        return;
+    }
+
+    // One reusable point per block
+    util::parallelFor(n, numThreads, BLOCK_SIZE, [&](std::size_t begin, std::size_t end) {
+        auto pt = pg.getGeometry().getFactory()->createPoint(CoordinateXY(0, 0));
+        for (std::size_t i = begin; i < end; i++) {
+            pt->setXY(x[i], y[i]);
+            results[i] = (pg.*pred)(pt.get());
+        }
+    });
+}
+
+bool
+isInterior(Location loc)
+{
+    return loc == Location::INTERIOR;
+}
+
+bool
+isNotExterior(Location loc)
+{
+    return loc != Location::EXTERIOR;
+}
+
+} // anonymous namespace
+
+void
+PreparedGeometry::intersectsMany(const Geometry* const* geoms, std::size_t n,
+                                 bool* results, std::size_t numThreads) const
+{
+    evaluateMany(*this, &PreparedGeometry::intersects, geoms, n, results, numThreads);
+}
+
+void
+PreparedGeometry::containsMany(const Geometry* const* geoms, std::size_t n,
+                               bool* results, std::size_t numThreads) const
+{
+    evaluateMany(*this, &PreparedGeometry::contains, geoms, n, results, numThreads);
+}
+
+void
+PreparedGeometry::containsProperlyMany(const Geometry* const* geoms, std::size_t n,
+                                       bool* results, std::size_t numThreads) const
+{
+    evaluateMany(*this, &PreparedGeometry::containsProperly, geoms, n, results, numThreads);
+}
+
+void
+PreparedGeometry::coversMany(const Geometry* const* geoms, std::size_t n,
+                             bool* results, std::size_t numThreads) const
+{
+    evaluateMany(*this, &PreparedGeometry::covers, geoms, n, results, numThreads);
+}
+
+bool
+PreparedGeometry::intersectsXY(double x, double y) const
+{
+    algorithm::locate::PointOnGeometryLocator* locator = getIndexedPointLocator();
+    if (locator) {
+        if (!getGeometry().getEnvelopeInternal()->contains(x, y)) {
+            return false;
+        }
+        CoordinateXY pt(x, y);
+        return isNotExterior(locator->locate(&pt));
+    }
+
+    auto pt = getGeometry().getFactory()->createPoint(CoordinateXY(x, y));
+    return intersects(pt.get());
+}
+
+void
+PreparedGeometry::intersectsXYMany(const double* x, const double* y, std::size_t n,
+                                   bool* results, std::size_t numThreads) const
+{
+    evaluateXYMany(*this, &PreparedGeometry::intersects, isNotExterior,
+                   getIndexedPointLocator(), x, y, n, results, numThreads);
+}
+
+void
+PreparedGeometry::containsXYMany(const double* x, const double* y, std::size_t n,
+                                 bool* results, std::size_t numThreads) const
+{
+    evaluateXYMany(*this, &PreparedGeometry::contains, isInterior,
+                   getIndexedPointLocator(), x, y, n, results, numThreads);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
@@ -42,8 +42,10 @@ namespace prep { // geos.geom.prep
 //
 PreparedPolygon::PreparedPolygon(const geom::Geometry* geom)
     : BasicPreparedGeometry(geom)
+    , ptOnGeomLocUsed(false)
 {
     isRectangle = getGeometry().isRectangle();
+    ptOnGeomLoc = detail::make_unique<algorithm::locate::SimplePointInAreaLocator>(&getGeometry());
 }
 
 PreparedPolygon::~PreparedPolygon()
@@ -58,10 +60,10 @@ noding::FastSegmentSetIntersectionFinder*
 PreparedPolygon::
 getIntersectionFinder() const
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderBuilt, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder.reset(new noding::FastSegmentSetIntersectionFinder(&segStrings));
-    }
+    });
     return segIntFinder.get();
 }
 
@@ -73,13 +75,20 @@ getPointLocator() const
     // instead of an IndexedPointInAreaLocator. There's a reasonable chance we will only use this locator
     // once (for example, if we get here through Geometry::intersects). So we create a simple locator for the
     // first usage and switch to an indexed locator when it is clear we're in a multiple-use scenario.
-    if(! ptOnGeomLoc) {
-        ptOnGeomLoc = detail::make_unique<algorithm::locate::SimplePointInAreaLocator>(&getGeometry());
+    if(! ptOnGeomLocUsed.exchange(true)) {
         return ptOnGeomLoc.get();
-    } else if (!indexedPtOnGeomLoc) {
-        indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::IndexedPointInAreaLocator>(getGeometry());
     }
 
+    return getIndexedPointLocator();
+}
+
+algorithm::locate::PointOnGeometryLocator*
+PreparedPolygon::
+getIndexedPointLocator() const
+{
+    std::call_once(indexedPtOnGeomLocBuilt, [this]() {
+        indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::IndexedPointInAreaLocator>(getGeometry());
+    });
     return indexedPtOnGeomLoc.get();
 }
 
@@ -159,9 +168,9 @@ operation::distance::IndexedFacetDistance*
 PreparedPolygon::
 getIndexedFacetDistance() const
 {
-    if(! indexedDistance ) {
+    std::call_once(indexedDistanceBuilt, [this]() {
         indexedDistance.reset(new operation::distance::IndexedFacetDistance(&getGeometry()));
-    }
+    });
     return indexedDistance.get();
 }
 
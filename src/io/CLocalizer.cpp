@@ -36,12 +36,17 @@ CLocalizer::CLocalizer()
     if(nullptr != p) {
         saved_locale = p;
     }
-    std::setlocale(LC_NUMERIC, "C");
+    // Switching locales is slow, skip it when already in the C locale
+    if(saved_locale != "C") {
+        std::setlocale(LC_NUMERIC, "C");
+    }
 }
 
 CLocalizer::~CLocalizer()
 {
-    std::setlocale(LC_NUMERIC, saved_locale.c_str());
+    if(saved_locale != "C") {
+        std::setlocale(LC_NUMERIC, saved_locale.c_str());
+    }
 }
 
 } // namespace geos.io
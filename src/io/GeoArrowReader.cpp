@@ -0,0 +1,233 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/util.h>
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+std::size_t
+offsetAt(const std::int32_t* offsets, std::size_t i)
+{
+    return static_cast<std::size_t>(offsets[i]);
+}
+
+/*
+ * Checks that an offsets array for n items is present, starts at
+ * a non-negative value and does not decrease.
+ */
+void
+checkOffsets(const std::int32_t* offsets, std::size_t n, const char* name)
+{
+    if (offsets == nullptr) {
+        throw ParseException(std::string("Missing GeoArrow ") + name);
+    }
+    if (offsets[0] < 0) {
+        throw ParseException(std::string("Negative GeoArrow ") + name);
+    }
+    for (std::size_t i = 0; i < n; i++) {
+        if (offsets[i + 1] < offsets[i]) {
+            throw ParseException(std::string("Decreasing GeoArrow ") + name);
+        }
+    }
+}
+
+} // anonymous namespace
+
+GeoArrowReader::GeoArrowReader(const GeometryFactory& f)
+    : factory(f)
+{}
+
+GeoArrowReader::GeoArrowReader()
+    : factory(*(GeometryFactory::getDefaultInstance()))
+{}
+
+std::vector<std::unique_ptr<Geometry>>
+GeoArrowReader::read(const GeoArrowBuffers& b) const
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(b.size);
+
+    switch(b.type) {
+    case GEOS_POINT:
+        for (std::size_t i = 0; i < b.size; i++) {
+            geoms.push_back(readPoint(b, i));
+        }
+        break;
+
+    case GEOS_LINESTRING:
+        checkOffsets(b.geomOffsets, b.size, "geometry offsets");
+        for (std::size_t i = 0; i < b.size; i++) {
+            geoms.push_back(factory.createLineString(
+                readCoordinates(b, offsetAt(b.geomOffsets, i), offsetAt(b.geomOffsets, i + 1))));
+        }
+        break;
+
+    case GEOS_POLYGON:
+        checkOffsets(b.geomOffsets, b.size, "geometry offsets");
+        checkOffsets(b.ringOffsets, offsetAt(b.geomOffsets, b.size), "ring offsets");
+        for (std::size_t i = 0; i < b.size; i++) {
+            geoms.push_back(readPolygon(b, b.ringOffsets,
+                                        offsetAt(b.geomOffsets, i), offsetAt(b.geomOffsets, i + 1)));
+        }
+        break;
+
+    case GEOS_MULTIPOINT:
+        checkOffsets(b.geomOffsets, b.size, "geometry offsets");
+        for (std::size_t i = 0; i < b.size; i++) {
+            std::vector<std::unique_ptr<Point>> points;
+            for (std::size_t j = offsetAt(b.geomOffsets, i); j < offsetAt(b.geomOffsets, i + 1); j++) {
+                points.push_back(readPoint(b, j));
+            }
+            geoms.push_back(factory.createMultiPoint(std::move(points)));
+        }
+        break;
+
+    case GEOS_MULTILINESTRING:
+        checkOffsets(b.geomOffsets, b.size, "geometry offsets");
+        checkOffsets(b.partOffsets, offsetAt(b.geomOffsets, b.size), "part offsets");
+        for (std::size_t i = 0; i < b.size; i++) {
+            std::vector<std::unique_ptr<LineString>> lines;
+            for (std::size_t j = offsetAt(b.geomOffsets, i); j < offsetAt(b.geomOffsets, i + 1); j++) {
+                lines.push_back(factory.createLineString(
+                    readCoordinates(b, offsetAt(b.partOffsets, j), offsetAt(b.partOffsets, j + 1))));
+            }
+            geoms.push_back(factory.createMultiLineString(std::move(lines)));
+        }
+        break;
+
+    case GEOS_MULTIPOLYGON:
+        checkOffsets(b.geomOffsets, b.size, "geometry offsets");
+        checkOffsets(b.partOffsets, offsetAt(b.geomOffsets, b.size), "part offsets");
+        checkOffsets(b.ringOffsets, offsetAt(b.partOffsets, offsetAt(b.geomOffsets, b.size)), "ring offsets");
+        for (std::size_t i = 0; i < b.size; i++) {
+            std::vector<std::unique_ptr<Polygon>> polys;
+            for (std::size_t j = offsetAt(b.geomOffsets, i); j < offsetAt(b.geomOffsets, i + 1); j++) {
+                polys.push_back(readPolygon(b, b.ringOffsets,
+                                            offsetAt(b.partOffsets, j), offsetAt(b.partOffsets, j + 1)));
+            }
+            geoms.push_back(factory.createMultiPolygon(std::move(polys)));
+        }
+        break;
+
+    default:
+        throw ParseException("Unsupported GeoArrow geometry type", static_cast<double>(b.type));
+    }
+
+    return geoms;
+}
+
+/*private*/
+std::unique_ptr<CoordinateSequence>
+GeoArrowReader::readCoordinates(const GeoArrowBuffers& b, std::size_t start, std::size_t end) const
+{
+    if (end > b.numCoords) {
+        throw ParseException("GeoArrow offsets beyond the coordinates");
+    }
+
+    const std::size_t dim = 2u + b.hasZ + b.hasM;
+    const std::size_t n = end - start;
+    const double* src = b.coords + start * dim;
+
+    auto seq = detail::make_unique<CoordinateSequence>(n, b.hasZ, b.hasM, false);
+
+    if (seq->stride() == dim) {
+        // Same interleaved layout as the sequence
+        std::memcpy(seq->data(), src, n * dim * sizeof(double));
+    }
+    else {
+        CoordinateXYZM c;
+        for (std::size_t i = 0; i < n; i++, src += dim) {
+            c.x = src[0];
+            c.y = src[1];
+            c.z = b.hasZ ? src[2] : DoubleNotANumber;
+            c.m = b.hasM ? src[2 + b.hasZ] : DoubleNotANumber;
+            seq->setAt(c, i);
+        }
+    }
+
+    const PrecisionModel& pm = *factory.getPrecisionModel();
+    if (!pm.isFloating()) {
+        for (std::size_t i = 0; i < n; i++) {
+            CoordinateXY& c = seq->getAt<CoordinateXY>(i);
+            pm.makePrecise(c);
+        }
+    }
+
+    return seq;
+}
+
+/*private*/
+std::unique_ptr<Point>
+GeoArrowReader::readPoint(const GeoArrowBuffers& b, std::size_t i) const
+{
+    if (i >= b.numCoords) {
+        throw ParseException("GeoArrow offsets beyond the coordinates");
+    }
+
+    const std::size_t dim = 2u + b.hasZ + b.hasM;
+    const double* src = b.coords + i * dim;
+
+    // POINT EMPTY
+    if (std::isnan(src[0]) && std::isnan(src[1])) {
+        return factory.createPoint(b.hasZ, b.hasM);
+    }
+
+    return factory.createPoint(readCoordinates(b, i, i + 1));
+}
+
+/*private*/
+std::unique_ptr<Polygon>
+GeoArrowReader::readPolygon(const GeoArrowBuffers& b, const std::int32_t* ringOffsets,
+                            std::size_t start, std::size_t end) const
+{
+    if (start == end) {
+        return factory.createPolygon(b.hasZ, b.hasM);
+    }
+
+    auto shell = factory.createLinearRing(
+        readCoordinates(b, offsetAt(ringOffsets, start), offsetAt(ringOffsets, start + 1)));
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for (std::size_t j = start + 1; j < end; j++) {
+        holes.push_back(factory.createLinearRing(
+            readCoordinates(b, offsetAt(ringOffsets, j), offsetAt(ringOffsets, j + 1))));
+    }
+
+    return factory.createPolygon(std::move(shell), std::move(holes));
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,255 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/constants.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/SimpleCurve.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+void
+pushOffset(std::vector<std::int32_t>& offsets, std::size_t value)
+{
+    if (value > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+        throw util::IllegalArgumentException("GeoArrow offsets exceed 32 bits");
+    }
+    offsets.push_back(static_cast<std::int32_t>(value));
+}
+
+/*
+ * Returns the single type of a geometry, with isMulti set for
+ * multi types. Empty GeometryCollections have no type.
+ */
+bool
+getSingleType(const Geometry& g, GeometryTypeId& type, bool& isMulti)
+{
+    switch(g.getGeometryTypeId()) {
+    case GEOS_POINT: type = GEOS_POINT; isMulti = false; return true;
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING: type = GEOS_LINESTRING; isMulti = false; return true;
+    case GEOS_POLYGON: type = GEOS_POLYGON; isMulti = false; return true;
+    case GEOS_MULTIPOINT: type = GEOS_POINT; isMulti = true; return true;
+    case GEOS_MULTILINESTRING: type = GEOS_LINESTRING; isMulti = true; return true;
+    case GEOS_MULTIPOLYGON: type = GEOS_POLYGON; isMulti = true; return true;
+    case GEOS_GEOMETRYCOLLECTION:
+        if (g.isEmpty()) {
+            return false;
+        }
+        break;
+    default:
+        break;
+    }
+    throw util::IllegalArgumentException("GeoArrow does not support " + g.getGeometryType());
+}
+
+bool
+isEmptyCollection(const Geometry& g)
+{
+    return g.getGeometryTypeId() == GEOS_GEOMETRYCOLLECTION;
+}
+
+} // anonymous namespace
+
+GeoArrowArray
+GeoArrowWriter::write(const Geometry* const* geoms, std::size_t n) const
+{
+    GeoArrowArray arr;
+    arr.type = GEOS_POINT;
+    arr.hasZ = false;
+    arr.hasM = false;
+    arr.size = n;
+
+    bool hasType = false;
+    bool isMulti = false;
+    for (std::size_t i = 0; i < n; i++) {
+        const Geometry& g = *geoms[i];
+        arr.hasZ |= g.hasZ();
+        arr.hasM |= g.hasM();
+
+        GeometryTypeId type;
+        bool geomIsMulti;
+        if (!getSingleType(g, type, geomIsMulti)) {
+            continue;
+        }
+        if (hasType && type != arr.type) {
+            throw util::IllegalArgumentException("GeoArrow arrays hold geometries of a single type");
+        }
+        hasType = true;
+        arr.type = type;
+        isMulti |= geomIsMulti;
+    }
+    if (isMulti) {
+        arr.type = Geometry::multiTypeId(arr.type);
+    }
+
+    const std::size_t dim = 2u + arr.hasZ + arr.hasM;
+
+    switch(arr.type) {
+    case GEOS_POINT:
+        arr.coords.reserve(n * dim);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            if (g.isEmpty()) {
+                // POINT EMPTY
+                arr.coords.insert(arr.coords.end(), dim, DoubleNotANumber);
+            }
+            else {
+                writeCoordinates(*static_cast<const Point&>(g).getCoordinatesRO(), arr);
+            }
+        }
+        break;
+
+    case GEOS_LINESTRING:
+        pushOffset(arr.geomOffsets, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            if (!isEmptyCollection(g)) {
+                writeCoordinates(*static_cast<const SimpleCurve&>(g).getCoordinatesRO(), arr);
+            }
+            pushOffset(arr.geomOffsets, arr.coords.size() / dim);
+        }
+        break;
+
+    case GEOS_POLYGON:
+        pushOffset(arr.geomOffsets, 0);
+        pushOffset(arr.ringOffsets, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            if (!isEmptyCollection(g)) {
+                writePolygon(static_cast<const Polygon&>(g), arr);
+            }
+            pushOffset(arr.geomOffsets, arr.ringOffsets.size() - 1);
+        }
+        break;
+
+    case GEOS_MULTIPOINT:
+        pushOffset(arr.geomOffsets, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            for (std::size_t j = 0; j < g.getNumGeometries(); j++) {
+                const Geometry& pt = *g.getGeometryN(j);
+                if (pt.isEmpty()) {
+                    // An empty Point is a part of a MultiPoint,
+                    // but not of a single Point
+                    if (g.getGeometryTypeId() == GEOS_MULTIPOINT) {
+                        arr.coords.insert(arr.coords.end(), dim, DoubleNotANumber);
+                    }
+                }
+                else {
+                    writeCoordinates(*static_cast<const Point&>(pt).getCoordinatesRO(), arr);
+                }
+            }
+            pushOffset(arr.geomOffsets, arr.coords.size() / dim);
+        }
+        break;
+
+    case GEOS_MULTILINESTRING:
+        pushOffset(arr.geomOffsets, 0);
+        pushOffset(arr.partOffsets, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            if (!g.isEmpty()) {
+                for (std::size_t j = 0; j < g.getNumGeometries(); j++) {
+                    const auto& line = static_cast<const SimpleCurve&>(*g.getGeometryN(j));
+                    writeCoordinates(*line.getCoordinatesRO(), arr);
+                    pushOffset(arr.partOffsets, arr.coords.size() / dim);
+                }
+            }
+            pushOffset(arr.geomOffsets, arr.partOffsets.size() - 1);
+        }
+        break;
+
+    case GEOS_MULTIPOLYGON:
+        pushOffset(arr.geomOffsets, 0);
+        pushOffset(arr.partOffsets, 0);
+        pushOffset(arr.ringOffsets, 0);
+        for (std::size_t i = 0; i < n; i++) {
+            const Geometry& g = *geoms[i];
+            if (!g.isEmpty()) {
+                for (std::size_t j = 0; j < g.getNumGeometries(); j++) {
+                    writePolygon(static_cast<const Polygon&>(*g.getGeometryN(j)), arr);
+                    pushOffset(arr.partOffsets, arr.ringOffsets.size() - 1);
+                }
+            }
+            pushOffset(arr.geomOffsets, arr.partOffsets.size() - 1);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return arr;
+}
+
+/*private*/
+void
+GeoArrowWriter::writeCoordinates(const CoordinateSequence& seq, GeoArrowArray& arr)
+{
+    const std::size_t dim = 2u + arr.hasZ + arr.hasM;
+
+    if (seq.hasZ() == arr.hasZ && seq.hasM() == arr.hasM && seq.stride() == dim) {
+        // Same interleaved layout as the array
+        arr.coords.insert(arr.coords.end(), seq.data(), seq.data() + seq.size() * dim);
+        return;
+    }
+
+    CoordinateXYZM c;
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        seq.getAt(i, c);
+        arr.coords.push_back(c.x);
+        arr.coords.push_back(c.y);
+        if (arr.hasZ) {
+            arr.coords.push_back(seq.hasZ() ? c.z : DoubleNotANumber);
+        }
+        if (arr.hasM) {
+            arr.coords.push_back(seq.hasM() ? c.m : DoubleNotANumber);
+        }
+    }
+}
+
+/*private*/
+void
+GeoArrowWriter::writePolygon(const Polygon& poly, GeoArrowArray& arr)
+{
+    if (poly.isEmpty()) {
+        return;
+    }
+
+    const std::size_t dim = 2u + arr.hasZ + arr.hasM;
+
+    writeCoordinates(*poly.getExteriorRing()->getCoordinatesRO(), arr);
+    pushOffset(arr.ringOffsets, arr.coords.size() / dim);
+    for (std::size_t k = 0; k < poly.getNumInteriorRing(); k++) {
+        writeCoordinates(*poly.getInteriorRingN(k)->getCoordinatesRO(), arr);
+        pushOffset(arr.ringOffsets, arr.coords.size() / dim);
+    }
+}
+
+} // namespace geos.io
+} // namespace geos
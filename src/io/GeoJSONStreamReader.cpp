@@ -0,0 +1,928 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+#include "geos/vend/include_nlohmann_json.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <map>
+
+using namespace geos::geom;
+using json = geos_nlohmann::json;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+/*
+ * Collects the nested arrays of a "coordinates" member as they are
+ * parsed. Positions are stored as XYZ triples, and the number of
+ * children of the arrays at each nesting level is recorded in
+ * document order, so the geometry can be built once its type is known.
+ */
+class CoordinateArrays {
+
+public:
+
+    CoordinateArrays() : position{}, numberLevel(-1), maxLevel(-1), nextPosition(0) {}
+
+    bool isOpen() const
+    {
+        return !open.empty();
+    }
+
+    void startArray()
+    {
+        if (!open.empty()) {
+            if (numberLevel == level()) {
+                throw ParseException("Expected number in GeoJSON coordinates");
+            }
+            open.back()++;
+        }
+        open.push_back(0);
+        if (level() >= static_cast<int>(counts.size())) {
+            counts.emplace_back();
+        }
+        maxLevel = std::max(maxLevel, level());
+    }
+
+    void endArray()
+    {
+        std::size_t n = open.back();
+        if (numberLevel == level() && n > 0) {
+            if (n == 1) {
+                throw ParseException("Expected two or three coordinates found one");
+            }
+            if (n > 3) {
+                throw ParseException("Expected two or three coordinates found more than three");
+            }
+            positions.push_back(position[0]);
+            positions.push_back(position[1]);
+            positions.push_back(n == 3 ? position[2] : DoubleNotANumber);
+        }
+        counts[static_cast<std::size_t>(level())].push_back(n);
+        open.pop_back();
+    }
+
+    void number(double d)
+    {
+        if (numberLevel == -1) {
+            numberLevel = level();
+        }
+        if (numberLevel != level() || maxLevel > level()) {
+            throw ParseException("Unexpected number in GeoJSON coordinates");
+        }
+        std::size_t i = open.back()++;
+        if (i < 3) {
+            position[i] = d;
+        }
+    }
+
+    /*
+     * Checks that the arrays are nested as expected for a
+     * geometry type with positions at the given depth.
+     */
+    void checkDepth(int depth) const
+    {
+        if (maxLevel >= depth || (numberLevel != -1 && numberLevel != depth - 1)) {
+            throw ParseException("Unexpected nesting of GeoJSON coordinates");
+        }
+    }
+
+    /*
+     * Returns the number of children of the next array at a level.
+     */
+    std::size_t nextCount(std::size_t lvl)
+    {
+        cursors.resize(counts.size(), 0);
+        if (lvl >= counts.size() || cursors[lvl] >= counts[lvl].size()) {
+            throw ParseException("Unexpected nesting of GeoJSON coordinates");
+        }
+        return counts[lvl][cursors[lvl]++];
+    }
+
+    Coordinate readCoordinate()
+    {
+        checkPositions(1);
+        const double* p = positions.data() + 3 * nextPosition++;
+        return Coordinate(p[0], p[1], p[2]);
+    }
+
+    std::unique_ptr<CoordinateSequence> readSequence(std::size_t n)
+    {
+        checkPositions(n);
+        const double* p = positions.data() + 3 * nextPosition;
+        nextPosition += n;
+
+        bool hasZ = false;
+        for (std::size_t i = 0; i < n && !hasZ; i++) {
+            hasZ = !std::isnan(p[3 * i + 2]);
+        }
+
+        auto seq = detail::make_unique<CoordinateSequence>(n, hasZ, false, false);
+        if (hasZ && seq->stride() == 3) {
+            std::memcpy(seq->data(), p, 3 * n * sizeof(double));
+        }
+        else {
+            for (std::size_t i = 0; i < n; i++, p += 3) {
+                seq->setAt(Coordinate(p[0], p[1], p[2]), i);
+            }
+        }
+        return seq;
+    }
+
+private:
+
+    int level() const
+    {
+        return static_cast<int>(open.size()) - 1;
+    }
+
+    void checkPositions(std::size_t n) const
+    {
+        if (3 * (nextPosition + n) > positions.size()) {
+            throw ParseException("Expected two or three coordinates");
+        }
+    }
+
+    // number of children of each array at each level, in document order
+    std::vector<std::vector<std::size_t>> counts;
+    // number of children of each open array
+    std::vector<std::size_t> open;
+    std::vector<double> positions;
+    double position[3];
+    int numberLevel;
+    int maxLevel;
+
+    std::vector<std::size_t> cursors;
+    std::size_t nextPosition;
+};
+
+/*
+ * Builds a map of GeoJSONValues from the events of a JSON object.
+ */
+class PropertyBuilder {
+
+public:
+
+    bool isOpen() const
+    {
+        return !stack.empty();
+    }
+
+    void start(bool isArray)
+    {
+        stack.emplace_back();
+        stack.back().isArray = isArray;
+    }
+
+    void key(std::string& k)
+    {
+        stack.back().key = std::move(k);
+    }
+
+    void value(const GeoJSONValue& v)
+    {
+        Frame& f = stack.back();
+        if (f.isArray) {
+            f.array.push_back(v);
+        }
+        else {
+            f.object[f.key] = v;
+        }
+    }
+
+    /*
+     * Ends the innermost object or array, returning true and
+     * setting result if it was the outermost object.
+     */
+    bool end(std::map<std::string, GeoJSONValue>& result)
+    {
+        Frame f = std::move(stack.back());
+        stack.pop_back();
+        if (stack.empty()) {
+            result = std::move(f.object);
+            return true;
+        }
+        if (f.isArray) {
+            value(GeoJSONValue(f.array));
+        }
+        else {
+            value(GeoJSONValue(f.object));
+        }
+        return false;
+    }
+
+private:
+
+    struct Frame {
+        bool isArray;
+        std::map<std::string, GeoJSONValue> object;
+        std::vector<GeoJSONValue> array;
+        std::string key;
+    };
+
+    std::vector<Frame> stack;
+};
+
+/*
+ * Builds a GeoJSONFeature from the events of a JSON parser.
+ *
+ * Features and geometries are both handled as objects, so that
+ * members may appear in any order. A geometry is built when the
+ * end of its object is reached.
+ */
+class FeatureHandler : public json::json_sax_t {
+
+public:
+
+    FeatureHandler(const GeometryFactory& gf, bool p_requireFeature)
+        : factory(gf)
+        , requireFeature(p_requireFeature)
+        , slot(Slot::ROOT)
+        , skipDepth(0)
+    {}
+
+    std::unique_ptr<GeoJSONFeature> getFeature()
+    {
+        return std::move(feature);
+    }
+
+    bool null() override
+    {
+        if (skipDepth > 0) {
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.value(GeoJSONValue());
+            return true;
+        }
+        switch(slot) {
+        case Slot::ID:
+            current().id.clear();
+            break;
+        case Slot::PROPERTIES:
+        case Slot::SKIP:
+            break;
+        default:
+            unexpected("null");
+        }
+        slot = Slot::KEY;
+        return true;
+    }
+
+    bool boolean(bool val) override
+    {
+        if (skipDepth > 0) {
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.value(GeoJSONValue(val));
+            return true;
+        }
+        if (slot != Slot::SKIP) {
+            unexpected("boolean");
+        }
+        slot = Slot::KEY;
+        return true;
+    }
+
+    bool number_integer(number_integer_t val) override
+    {
+        return number(static_cast<double>(val), json(val));
+    }
+
+    bool number_unsigned(number_unsigned_t val) override
+    {
+        return number(static_cast<double>(val), json(val));
+    }
+
+    bool number_float(number_float_t val, const string_t&) override
+    {
+        return number(val, json(val));
+    }
+
+    bool string(string_t& val) override
+    {
+        if (skipDepth > 0) {
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.value(GeoJSONValue(val));
+            return true;
+        }
+        switch(slot) {
+        case Slot::TYPE:
+            current().type = std::move(val);
+            break;
+        case Slot::ID:
+            current().id = std::move(val);
+            break;
+        case Slot::SKIP:
+            break;
+        default:
+            unexpected("string");
+        }
+        slot = Slot::KEY;
+        return true;
+    }
+
+    bool binary(binary_t&) override
+    {
+        unexpected("binary value");
+        return false;
+    }
+
+    bool start_object(std::size_t) override
+    {
+        if (skipDepth > 0) {
+            skipDepth++;
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.start(false);
+            return true;
+        }
+        switch(slot) {
+        case Slot::ROOT:
+        case Slot::GEOMETRY:
+        case Slot::GEOMETRY_LIST:
+            objects.emplace_back();
+            objects.back().target = slot;
+            slot = Slot::KEY;
+            break;
+        case Slot::PROPERTIES:
+            properties.start(false);
+            break;
+        case Slot::SKIP:
+            skipDepth = 1;
+            break;
+        default:
+            unexpected("object");
+        }
+        return true;
+    }
+
+    bool key(string_t& val) override
+    {
+        if (skipDepth > 0) {
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.key(val);
+            return true;
+        }
+        if (val == "type") {
+            slot = Slot::TYPE;
+        }
+        else if (val == "coordinates") {
+            slot = Slot::COORDINATES;
+        }
+        else if (val == "geometries") {
+            slot = Slot::GEOMETRIES;
+        }
+        else if (val == "geometry") {
+            slot = Slot::GEOMETRY;
+        }
+        else if (val == "properties") {
+            slot = Slot::PROPERTIES;
+        }
+        else if (val == "id") {
+            slot = Slot::ID;
+        }
+        else {
+            slot = Slot::SKIP;
+        }
+        return true;
+    }
+
+    bool end_object() override
+    {
+        if (skipDepth > 0) {
+            if (--skipDepth == 0) {
+                slot = Slot::KEY;
+            }
+            return true;
+        }
+        if (properties.isOpen()) {
+            if (properties.end(current().properties)) {
+                slot = Slot::KEY;
+            }
+            return true;
+        }
+        finishObject();
+        return true;
+    }
+
+    bool start_array(std::size_t) override
+    {
+        if (skipDepth > 0) {
+            skipDepth++;
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.start(true);
+            return true;
+        }
+        switch(slot) {
+        case Slot::COORDINATES:
+            current().coords.startArray();
+            current().hasCoordinates = true;
+            slot = Slot::IN_COORDINATES;
+            break;
+        case Slot::IN_COORDINATES:
+            current().coords.startArray();
+            break;
+        case Slot::GEOMETRIES:
+            current().hasGeometries = true;
+            slot = Slot::GEOMETRY_LIST;
+            break;
+        case Slot::SKIP:
+            skipDepth = 1;
+            break;
+        default:
+            unexpected("array");
+        }
+        return true;
+    }
+
+    bool end_array() override
+    {
+        if (skipDepth > 0) {
+            if (--skipDepth == 0) {
+                slot = Slot::KEY;
+            }
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.end(current().properties);
+            return true;
+        }
+        if (slot == Slot::IN_COORDINATES) {
+            current().coords.endArray();
+            if (!current().coords.isOpen()) {
+                slot = Slot::KEY;
+            }
+        }
+        else {
+            // end of "geometries"
+            slot = Slot::KEY;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&,
+                     const geos_nlohmann::detail::exception& ex) override
+    {
+        throw ParseException("Error parsing JSON", ex.what());
+    }
+
+private:
+
+    // What the next JSON value is read as
+    enum class Slot {
+        ROOT,
+        KEY,
+        TYPE,
+        ID,
+        COORDINATES,
+        IN_COORDINATES,
+        GEOMETRIES,
+        GEOMETRY_LIST,
+        GEOMETRY,
+        PROPERTIES,
+        SKIP
+    };
+
+    // A Feature or Geometry object being read
+    struct Object {
+        Slot target;
+        std::string type;
+        bool hasCoordinates = false;
+        bool hasGeometries = false;
+        CoordinateArrays coords;
+        std::vector<std::unique_ptr<Geometry>> geometries;
+        std::unique_ptr<Geometry> geometry;
+        std::map<std::string, GeoJSONValue> properties;
+        std::string id;
+    };
+
+    Object& current()
+    {
+        return objects.back();
+    }
+
+    [[noreturn]] static void unexpected(const std::string& what)
+    {
+        throw ParseException("Unexpected " + what + " in GeoJSON");
+    }
+
+    bool number(double d, const json& j)
+    {
+        if (skipDepth > 0) {
+            return true;
+        }
+        if (properties.isOpen()) {
+            properties.value(GeoJSONValue(d));
+            return true;
+        }
+        switch(slot) {
+        case Slot::IN_COORDINATES:
+            current().coords.number(d);
+            return true;
+        case Slot::ID:
+            current().id = j.dump();
+            break;
+        case Slot::SKIP:
+            break;
+        default:
+            unexpected("number");
+        }
+        slot = Slot::KEY;
+        return true;
+    }
+
+    void finishObject()
+    {
+        Object obj = std::move(objects.back());
+        objects.pop_back();
+
+        if (obj.type == "Feature" && obj.target == Slot::ROOT) {
+            if (!obj.geometry) {
+                throw ParseException("Missing GeoJSON Feature geometry");
+            }
+            feature = detail::make_unique<GeoJSONFeature>(
+                          std::move(obj.geometry), std::move(obj.properties), std::move(obj.id));
+        }
+        else if (obj.target == Slot::ROOT && requireFeature) {
+            throw ParseException("Expected GeoJSON Feature but encountered", obj.type);
+        }
+        else {
+            auto g = readGeometry(obj);
+            if (obj.target == Slot::ROOT) {
+                feature = detail::make_unique<GeoJSONFeature>(
+                              std::move(g), std::map<std::string, GeoJSONValue>{});
+            }
+            else if (obj.target == Slot::GEOMETRY) {
+                current().geometry = std::move(g);
+            }
+            else {
+                current().geometries.push_back(std::move(g));
+            }
+        }
+
+        slot = obj.target == Slot::GEOMETRY_LIST ? Slot::GEOMETRY_LIST : Slot::KEY;
+    }
+
+    std::unique_ptr<Geometry> readGeometry(Object& obj) const
+    {
+        const std::string& type = obj.type;
+        if (type.empty()) {
+            throw ParseException("Missing GeoJSON geometry type");
+        }
+        if (type == "GeometryCollection") {
+            if (!obj.hasGeometries) {
+                throw ParseException("Missing GeoJSON geometries");
+            }
+            return factory.createGeometryCollection(std::move(obj.geometries));
+        }
+
+        int depth;
+        if (type == "Point") {
+            depth = 1;
+        }
+        else if (type == "LineString" || type == "MultiPoint") {
+            depth = 2;
+        }
+        else if (type == "Polygon" || type == "MultiLineString") {
+            depth = 3;
+        }
+        else if (type == "MultiPolygon") {
+            depth = 4;
+        }
+        else {
+            throw ParseException{"Unknown geometry type!"};
+        }
+
+        if (!obj.hasCoordinates) {
+            throw ParseException("Missing GeoJSON coordinates");
+        }
+        CoordinateArrays& coords = obj.coords;
+        coords.checkDepth(depth);
+
+        if (type == "Point") {
+            if (coords.nextCount(0) == 0) {
+                return factory.createPoint(2);
+            }
+            return std::unique_ptr<Point>(factory.createPoint(coords.readCoordinate()));
+        }
+        else if (type == "LineString") {
+            return factory.createLineString(coords.readSequence(coords.nextCount(0)));
+        }
+        else if (type == "MultiPoint") {
+            std::size_t n = coords.nextCount(0);
+            std::vector<std::unique_ptr<Point>> points;
+            points.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                points.push_back(std::unique_ptr<Point>(factory.createPoint(coords.readCoordinate())));
+            }
+            return factory.createMultiPoint(std::move(points));
+        }
+        else if (type == "Polygon") {
+            return readPolygon(coords, 0);
+        }
+        else if (type == "MultiLineString") {
+            std::size_t n = coords.nextCount(0);
+            std::vector<std::unique_ptr<LineString>> lines;
+            lines.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                lines.push_back(factory.createLineString(coords.readSequence(coords.nextCount(1))));
+            }
+            return factory.createMultiLineString(std::move(lines));
+        }
+        else {
+            std::size_t n = coords.nextCount(0);
+            std::vector<std::unique_ptr<Polygon>> polygons;
+            polygons.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                polygons.push_back(readPolygon(coords, 1));
+            }
+            return factory.createMultiPolygon(std::move(polygons));
+        }
+    }
+
+    std::unique_ptr<Polygon> readPolygon(CoordinateArrays& coords, std::size_t level) const
+    {
+        std::size_t nRings = coords.nextCount(level);
+        if (nRings == 0) {
+            return factory.createPolygon(2);
+        }
+        auto shell = factory.createLinearRing(coords.readSequence(coords.nextCount(level + 1)));
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        holes.reserve(nRings - 1);
+        for (std::size_t i = 1; i < nRings; i++) {
+            holes.push_back(factory.createLinearRing(coords.readSequence(coords.nextCount(level + 1))));
+        }
+        if (holes.empty()) {
+            return factory.createPolygon(std::move(shell));
+        }
+        return factory.createPolygon(std::move(shell), std::move(holes));
+    }
+
+    const GeometryFactory& factory;
+    bool requireFeature;
+
+    Slot slot;
+    std::size_t skipDepth;
+    std::vector<Object> objects;
+    PropertyBuilder properties;
+    std::unique_ptr<GeoJSONFeature> feature;
+};
+
+bool
+isSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Record separator of GeoJSON text sequences (RFC 8142)
+const char RECORD_SEPARATOR = '\x1e';
+
+} // anonymous namespace
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr, const GeometryFactory& gf)
+    : instr(p_instr)
+    , geometryFactory(gf)
+    , buf(1 << 16)
+    , bufPos(0)
+    , bufEnd(0)
+    , state(State::BETWEEN_OBJECTS)
+    , depth(0)
+    , inString(false)
+    , escaped(false)
+    , expectKey(false)
+    , readingKey(false)
+    , afterFeaturesKey(false)
+    , isCollection(false)
+{}
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr)
+    : GeoJSONStreamReader(p_instr, *(GeometryFactory::getDefaultInstance()))
+{}
+
+GeoJSONStreamReader::~GeoJSONStreamReader() = default;
+
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::next()
+{
+    std::string text;
+    bool isCollectionMember;
+    if (!nextObjectText(text, isCollectionMember)) {
+        return nullptr;
+    }
+
+    FeatureHandler handler(geometryFactory, isCollectionMember);
+    try {
+        json::sax_parse(text, &handler);
+    }
+    catch (json::exception& ex) {
+        throw ParseException("Error parsing JSON", ex.what());
+    }
+    return handler.getFeature();
+}
+
+/*private*/
+bool
+GeoJSONStreamReader::nextChar(char& c)
+{
+    if (bufPos == bufEnd) {
+        instr.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+        bufPos = 0;
+        bufEnd = static_cast<std::size_t>(instr.gcount());
+        if (bufEnd == 0) {
+            return false;
+        }
+    }
+    c = buf[bufPos++];
+    return true;
+}
+
+/*private*/
+bool
+GeoJSONStreamReader::nextObjectText(std::string& text, bool& isCollectionMember)
+{
+    // Finds the text of the next top-level object, or of the next
+    // member of the "features" array of a top-level object. Only
+    // strings and nesting are tracked; the text is validated when
+    // it is parsed.
+    char c;
+    while (nextChar(c)) {
+        switch(state) {
+        case State::BETWEEN_OBJECTS:
+            if (isSpace(c) || c == RECORD_SEPARATOR) {
+                continue;
+            }
+            if (c != '{') {
+                throw ParseException("Expected '{' in GeoJSON input");
+            }
+            state = State::IN_OBJECT;
+            depth = 1;
+            expectKey = true;
+            readingKey = false;
+            afterFeaturesKey = false;
+            isCollection = false;
+            objectText.assign(1, c);
+            break;
+
+        case State::IN_OBJECT:
+            if (!isCollection) {
+                objectText.push_back(c);
+            }
+            if (inString) {
+                if (escaped) {
+                    escaped = false;
+                }
+                else if (c == '\\') {
+                    escaped = true;
+                }
+                else if (c == '"') {
+                    inString = false;
+                    readingKey = false;
+                    continue;
+                }
+                if (readingKey) {
+                    key.push_back(c);
+                }
+                continue;
+            }
+            if (afterFeaturesKey && !isSpace(c)) {
+                afterFeaturesKey = false;
+                if (c == '[') {
+                    // Read the members of the array one at a time
+                    isCollection = true;
+                    objectText.clear();
+                    state = State::IN_FEATURES;
+                    continue;
+                }
+            }
+            switch(c) {
+            case '"':
+                inString = true;
+                if (depth == 1 && expectKey) {
+                    expectKey = false;
+                    readingKey = true;
+                    key.clear();
+                }
+                break;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (--depth == 0) {
+                    state = State::BETWEEN_OBJECTS;
+                    if (!isCollection) {
+                        text.swap(objectText);
+                        isCollectionMember = false;
+                        return true;
+                    }
+                }
+                break;
+            case ',':
+                expectKey = (depth == 1);
+                break;
+            case ':':
+                afterFeaturesKey = (depth == 1 && key == "features");
+                break;
+            }
+            break;
+
+        case State::IN_FEATURES:
+            if (isSpace(c) || c == ',') {
+                continue;
+            }
+            if (c == ']') {
+                state = State::IN_OBJECT;
+                continue;
+            }
+            if (c != '{') {
+                throw ParseException("Expected '{' in GeoJSON features");
+            }
+            state = State::IN_FEATURE;
+            depth = 2;
+            objectText.assign(1, c);
+            break;
+
+        case State::IN_FEATURE:
+            objectText.push_back(c);
+            if (inString) {
+                if (escaped) {
+                    escaped = false;
+                }
+                else if (c == '\\') {
+                    escaped = true;
+                }
+                else if (c == '"') {
+                    inString = false;
+                }
+                continue;
+            }
+            switch(c) {
+            case '"':
+                inString = true;
+                break;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (--depth == 1) {
+                    state = State::IN_FEATURES;
+                    text.swap(objectText);
+                    isCollectionMember = true;
+                    return true;
+                }
+                break;
+            }
+            break;
+        }
+    }
+
+    if (state != State::BETWEEN_OBJECTS) {
+        throw ParseException("Unexpected end of GeoJSON input");
+    }
+    return false;
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,457 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+#include <geos/util/IllegalArgumentException.h>
+#include "geos/vend/include_nlohmann_json.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <ostream>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+// Size at which buffered output is written to the stream
+const std::size_t FLUSH_SIZE = 1 << 16;
+
+} // anonymous namespace
+
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::ostream& p_os)
+    : os(&p_os)
+    , out(ownBuffer)
+    , outputDimension(3)
+    , roundingPrecision(-1)
+    , inFeatureCollection(false)
+    , isFirstFeature(false)
+{
+    ownBuffer.reserve(FLUSH_SIZE);
+}
+
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::string& buffer)
+    : os(nullptr)
+    , out(buffer)
+    , outputDimension(3)
+    , roundingPrecision(-1)
+    , inFeatureCollection(false)
+    , isFirstFeature(false)
+{}
+
+GeoJSONStreamWriter::~GeoJSONStreamWriter()
+{
+    flush();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::setOutputDimension(uint8_t dims)
+{
+    if(dims < 2 || dims > 3) {
+        throw util::IllegalArgumentException("GeoJSON output dimension must be 2 or 3");
+    }
+    outputDimension = dims;
+}
+
+/* public */
+void
+GeoJSONStreamWriter::flush()
+{
+    if (os != nullptr && !ownBuffer.empty()) {
+        os->write(ownBuffer.data(), static_cast<std::streamsize>(ownBuffer.size()));
+        ownBuffer.clear();
+    }
+}
+
+/* public */
+void
+GeoJSONStreamWriter::write(const Geometry* geometry, GeoJSONType type)
+{
+    if (inFeatureCollection && type != GeoJSONType::FEATURE) {
+        throw util::IllegalArgumentException("Only features can be written to a GeoJSON FeatureCollection");
+    }
+
+    switch(type) {
+    case GeoJSONType::GEOMETRY:
+        writeGeometry(geometry);
+        break;
+    case GeoJSONType::FEATURE:
+        writeFeature(geometry, nullptr);
+        break;
+    case GeoJSONType::FEATURE_COLLECTION:
+        beginFeatureCollection();
+        writeFeature(geometry, nullptr);
+        endFeatureCollection();
+        break;
+    }
+    flushIfFull();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::write(const GeoJSONFeature& feature)
+{
+    writeFeature(feature.getGeometry(), &feature);
+    flushIfFull();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::write(const GeoJSONFeatureCollection& features)
+{
+    beginFeatureCollection();
+    for (const auto& feature : features.getFeatures()) {
+        writeFeature(feature.getGeometry(), &feature);
+        flushIfFull();
+    }
+    endFeatureCollection();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::beginFeatureCollection()
+{
+    if (inFeatureCollection) {
+        throw util::IllegalArgumentException("GeoJSON FeatureCollections cannot be nested");
+    }
+    append("{\"type\":\"FeatureCollection\",\"features\":[");
+    inFeatureCollection = true;
+    isFirstFeature = true;
+}
+
+/* public */
+void
+GeoJSONStreamWriter::endFeatureCollection()
+{
+    if (!inFeatureCollection) {
+        throw util::IllegalArgumentException("No GeoJSON FeatureCollection has been begun");
+    }
+    append("]}");
+    inFeatureCollection = false;
+    flushIfFull();
+}
+
+/* private */
+void
+GeoJSONStreamWriter::flushIfFull()
+{
+    if (os != nullptr && ownBuffer.size() >= FLUSH_SIZE) {
+        flush();
+    }
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeFeature(const Geometry* geometry, const GeoJSONFeature* feature)
+{
+    if (inFeatureCollection) {
+        if (!isFirstFeature) {
+            out.push_back(',');
+        }
+        isFirstFeature = false;
+    }
+
+    append("{\"type\":\"Feature\",");
+    if (feature != nullptr && !feature->getId().empty()) {
+        append("\"id\":");
+        writeString(feature->getId());
+        out.push_back(',');
+    }
+    append("\"geometry\":");
+    writeGeometry(geometry);
+    // RFC 7946 requires a properties member, even if empty
+    append(",\"properties\":{");
+    if (feature != nullptr) {
+        bool first = true;
+        for (const auto& property : feature->getProperties()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            writeString(property.first);
+            out.push_back(':');
+            writeValue(property.second);
+        }
+    }
+    append("}}");
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeGeometry(const Geometry* geometry)
+{
+    util::ensureNoCurvedComponents(geometry);
+
+    switch(geometry->getGeometryTypeId()) {
+    case GEOS_POINT: {
+        const auto* point = static_cast<const Point*>(geometry);
+        append("{\"type\":\"Point\",\"coordinates\":");
+        if (point->isEmpty()) {
+            append("[]");
+        }
+        else {
+            writeCoordinate(point->getX(), point->getY(), point->getZ());
+        }
+        break;
+    }
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+        append("{\"type\":\"LineString\",\"coordinates\":");
+        writeCoordinates(*static_cast<const LineString*>(geometry)->getCoordinatesRO());
+        break;
+    case GEOS_POLYGON:
+        append("{\"type\":\"Polygon\",\"coordinates\":");
+        writePolygonCoordinates(*static_cast<const Polygon*>(geometry));
+        break;
+    case GEOS_MULTIPOINT: {
+        append("{\"type\":\"MultiPoint\",\"coordinates\":[");
+        bool first = true;
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            const auto* point = static_cast<const Point*>(geometry->getGeometryN(i));
+            if (point->isEmpty()) {
+                continue;
+            }
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            writeCoordinate(point->getX(), point->getY(), point->getZ());
+        }
+        out.push_back(']');
+        break;
+    }
+    case GEOS_MULTILINESTRING:
+        append("{\"type\":\"MultiLineString\",\"coordinates\":[");
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            writeCoordinates(*static_cast<const LineString*>(geometry->getGeometryN(i))->getCoordinatesRO());
+        }
+        out.push_back(']');
+        break;
+    case GEOS_MULTIPOLYGON:
+        append("{\"type\":\"MultiPolygon\",\"coordinates\":[");
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            writePolygonCoordinates(*static_cast<const Polygon*>(geometry->getGeometryN(i)));
+        }
+        out.push_back(']');
+        break;
+    case GEOS_GEOMETRYCOLLECTION:
+        append("{\"type\":\"GeometryCollection\",\"geometries\":[");
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            writeGeometry(geometry->getGeometryN(i));
+        }
+        out.push_back(']');
+        break;
+    default:
+        throw util::IllegalArgumentException("Unsupported geometry type for GeoJSON: " + geometry->getGeometryType());
+    }
+    out.push_back('}');
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writePolygonCoordinates(const Polygon& poly)
+{
+    out.push_back('[');
+    writeCoordinates(*poly.getExteriorRing()->getCoordinatesRO());
+    for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+        out.push_back(',');
+        writeCoordinates(*poly.getInteriorRingN(i)->getCoordinatesRO());
+    }
+    out.push_back(']');
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeCoordinates(const CoordinateSequence& seq)
+{
+    out.push_back('[');
+    Coordinate c;
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        if (i > 0) {
+            out.push_back(',');
+        }
+        seq.getAt(i, c);
+        writeCoordinate(c.x, c.y, c.z);
+    }
+    out.push_back(']');
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeCoordinate(double x, double y, double z)
+{
+    // Room for "[x,y,z]"
+    char buf[3 * 32 + 4];
+    char* p = buf;
+
+    *p++ = '[';
+    p = writeNumber(x, p);
+    *p++ = ',';
+    p = writeNumber(y, p);
+    if (outputDimension > 2 && !std::isnan(z)) {
+        *p++ = ',';
+        p = writeNumber(z, p);
+    }
+    *p++ = ']';
+    out.append(buf, static_cast<std::size_t>(p - buf));
+    // a large geometry is not buffered whole
+    flushIfFull();
+}
+
+/* private */
+char*
+GeoJSONStreamWriter::writeNumber(double d, char* buf) const
+{
+    if (!std::isfinite(d)) {
+        std::memcpy(buf, "null", 4);
+        return buf + 4;
+    }
+    if (roundingPrecision >= 0) {
+        return buf + WKTWriter::writeTrimmedNumber(d, static_cast<std::uint32_t>(roundingPrecision), buf);
+    }
+    // Same shortest round-trip format as GeoJSONWriter
+    return geos_nlohmann::detail::to_chars(buf, buf + 32, d);
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeValue(const GeoJSONValue& value)
+{
+    if (value.isNumber()) {
+        double d = value.getNumber();
+        if (std::isfinite(d)) {
+            // Same shortest round-trip format as GeoJSONWriter,
+            // which does not round property values
+            char buf[64];
+            char* end = geos_nlohmann::detail::to_chars(buf, buf + sizeof(buf), d);
+            out.append(buf, static_cast<std::size_t>(end - buf));
+        }
+        else {
+            append("null");
+        }
+    }
+    else if (value.isString()) {
+        writeString(value.getString());
+    }
+    else if (value.isBoolean()) {
+        append(value.getBoolean() ? "true" : "false");
+    }
+    else if (value.isNull()) {
+        append("null");
+    }
+    else if (value.isArray()) {
+        out.push_back('[');
+        bool first = true;
+        for (const GeoJSONValue& v : value.getArray()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            writeValue(v);
+        }
+        out.push_back(']');
+    }
+    else if (value.isObject()) {
+        out.push_back('{');
+        bool first = true;
+        for (const auto& entry : value.getObject()) {
+            if (!first) {
+                out.push_back(',');
+            }
+            first = false;
+            writeString(entry.first);
+            out.push_back(':');
+            writeValue(entry.second);
+        }
+        out.push_back('}');
+    }
+}
+
+/* private */
+void
+GeoJSONStreamWriter::writeString(const std::string& s)
+{
+    static const char* hexDigits = "0123456789abcdef";
+
+    out.push_back('"');
+    for (char ch : s) {
+        switch(ch) {
+        case '"':
+            append("\\\"");
+            break;
+        case '\\':
+            append("\\\\");
+            break;
+        case '\b':
+            append("\\b");
+            break;
+        case '\f':
+            append("\\f");
+            break;
+        case '\n':
+            append("\\n");
+            break;
+        case '\r':
+            append("\\r");
+            break;
+        case '\t':
+            append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                append("\\u00");
+                out.push_back(hexDigits[(ch >> 4) & 0xf]);
+                out.push_back(hexDigits[ch & 0xf]);
+            }
+            else {
+                out.push_back(ch);
+            }
+        }
+    }
+    out.push_back('"');
+    flushIfFull();
+}
+
+/* private */
+void
+GeoJSONStreamWriter::append(const char* s)
+{
+    out.append(s);
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,373 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/MVTEncoder.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/operation/intersection/Rectangle.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/operation/overlayng/PrecisionReducer.h>
+#include <geos/operation/valid/IsValidOp.h>
+#include <geos/util.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/math.h>
+
+#include <cmath>
+
+using namespace geos::geom;
+using geos::operation::intersection::Rectangle;
+using geos::operation::intersection::RectangleIntersection;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+const uint32_t CMD_MOVE_TO = 1;
+const uint32_t CMD_LINE_TO = 2;
+const uint32_t CMD_CLOSE_PATH = 7;
+
+// Largest extent and buffer, keeping tile coordinates and their
+// differences within 32 bits
+const uint32_t MAX_EXTENT = 1u << 28;
+
+uint32_t
+command(uint32_t id, std::size_t count)
+{
+    return static_cast<uint32_t>(count << 3) | id;
+}
+
+uint32_t
+zigzag(int32_t n)
+{
+    return (static_cast<uint32_t>(n) << 1) ^ static_cast<uint32_t>(n >> 31);
+}
+
+template<typename F>
+void
+forEachElement(const Geometry& g, F&& f)
+{
+    if (g.isCollection()) {
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            forEachElement(*g.getGeometryN(i), f);
+        }
+    }
+    else {
+        f(g);
+    }
+}
+
+} // anonymous namespace
+
+MVTEncoder::MVTEncoder(const Envelope& p_tileEnvelope, uint32_t p_extent, uint32_t buffer)
+    : tileEnvelope(p_tileEnvelope)
+    , extent(p_extent)
+    , scaleX(0)
+    , scaleY(0)
+    , cursorX(0)
+    , cursorY(0)
+{
+    if (tileEnvelope.isNull() || !(tileEnvelope.getWidth() > 0) || !(tileEnvelope.getHeight() > 0)) {
+        throw util::IllegalArgumentException("MVT tile envelope must have a positive area");
+    }
+    if (extent == 0 || extent > MAX_EXTENT || buffer > MAX_EXTENT) {
+        throw util::IllegalArgumentException("MVT extent or buffer out of range");
+    }
+
+    scaleX = extent / tileEnvelope.getWidth();
+    scaleY = extent / tileEnvelope.getHeight();
+
+    const double bufferX = buffer / scaleX;
+    const double bufferY = buffer / scaleY;
+    clipEnvelope = Envelope(tileEnvelope.getMinX() - bufferX, tileEnvelope.getMaxX() + bufferX,
+                            tileEnvelope.getMinY() - bufferY, tileEnvelope.getMaxY() + bufferY);
+}
+
+/* public */
+MVTEncoder::GeomType
+MVTEncoder::encode(const Geometry& g, std::vector<uint32_t>& commands)
+{
+    commands.clear();
+    util::ensureNoCurvedComponents(g);
+
+    if (g.isEmpty()) {
+        return UNKNOWN;
+    }
+
+    // Points are filtered while encoding. Other geometries are only
+    // clipped if they are not entirely within the tile.
+    const Geometry* input = &g;
+    std::unique_ptr<Geometry> clipped;
+    const int dim = static_cast<int>(g.getDimension());
+    if (dim > 0 && !clipEnvelope.covers(*g.getEnvelopeInternal())) {
+        Rectangle rect(clipEnvelope.getMinX(), clipEnvelope.getMinY(),
+                       clipEnvelope.getMaxX(), clipEnvelope.getMaxY());
+        clipped = RectangleIntersection::clip(g, rect);
+        if (clipped == nullptr) {
+            return UNKNOWN;
+        }
+        input = clipped.get();
+    }
+
+    cursorX = 0;
+    cursorY = 0;
+
+    GeomType type;
+    switch(dim) {
+    case 0:
+        encodePoints(*input, commands);
+        type = POINT;
+        break;
+    case 1:
+        encodeLines(*input, commands);
+        type = LINESTRING;
+        break;
+    default:
+        encodePolygons(*input, commands);
+        type = POLYGON;
+        break;
+    }
+
+    return commands.empty() ? UNKNOWN : type;
+}
+
+/* private */
+void
+MVTEncoder::encodePoints(const Geometry& g, std::vector<uint32_t>& commands)
+{
+    tilePoints.clear();
+    forEachElement(g, [this](const Geometry& elem) {
+        if (elem.getGeometryTypeId() != GEOS_POINT || elem.isEmpty()) {
+            return;
+        }
+        const CoordinateXY& c = *static_cast<const Point&>(elem).getCoordinate();
+        // checked before filtering, so that they are not dropped silently
+        if (!std::isfinite(c.x) || !std::isfinite(c.y)) {
+            throw util::IllegalArgumentException("Cannot encode non-finite coordinate as MVT");
+        }
+        if (clipEnvelope.covers(c.x, c.y)) {
+            tilePoints.push_back(toTileX(c.x));
+            tilePoints.push_back(toTileY(c.y));
+        }
+    });
+
+    const std::size_t n = tilePoints.size() / 2;
+    if (n == 0) {
+        return;
+    }
+    commands.push_back(command(CMD_MOVE_TO, n));
+    for (std::size_t i = 0; i < n; i++) {
+        writeParameters(tilePoints[2 * i], tilePoints[2 * i + 1], commands);
+    }
+}
+
+/* private */
+void
+MVTEncoder::encodeLines(const Geometry& g, std::vector<uint32_t>& commands)
+{
+    forEachElement(g, [this, &commands](const Geometry& elem) {
+        if (elem.getGeometryTypeId() != GEOS_LINESTRING && elem.getGeometryTypeId() != GEOS_LINEARRING) {
+            return;
+        }
+        toTilePoints(*static_cast<const LineString&>(elem).getCoordinatesRO());
+
+        const std::size_t n = tilePoints.size() / 2;
+        if (n < 2) {
+            return;
+        }
+        commands.push_back(command(CMD_MOVE_TO, 1));
+        writeParameters(tilePoints[0], tilePoints[1], commands);
+        commands.push_back(command(CMD_LINE_TO, n - 1));
+        for (std::size_t i = 1; i < n; i++) {
+            writeParameters(tilePoints[2 * i], tilePoints[2 * i + 1], commands);
+        }
+    });
+}
+
+/* private */
+void
+MVTEncoder::encodePolygons(const Geometry& g, std::vector<uint32_t>& commands)
+{
+    std::vector<std::unique_ptr<Polygon>> polys;
+    forEachElement(g, [this, &polys](const Geometry& elem) {
+        if (elem.getGeometryTypeId() != GEOS_POLYGON) {
+            return;
+        }
+        auto poly = toTilePolygon(static_cast<const Polygon&>(elem));
+        if (poly) {
+            polys.push_back(std::move(poly));
+        }
+    });
+    if (polys.empty()) {
+        return;
+    }
+
+    std::unique_ptr<Geometry> tileGeom;
+    if (polys.size() == 1) {
+        tileGeom = std::move(polys[0]);
+    }
+    else {
+        tileGeom = g.getFactory()->createMultiPolygon(std::move(polys));
+    }
+
+    // Rounding can collapse or cross rings. Snap-rounding the polygons
+    // to the tile grid makes them valid again, with integer coordinates.
+    if (!operation::valid::IsValidOp(tileGeom.get()).isValid()) {
+        PrecisionModel pm(1.0);
+        tileGeom = operation::overlayng::PrecisionReducer::reducePrecision(tileGeom.get(), &pm);
+    }
+
+    forEachElement(*tileGeom, [this, &commands](const Geometry& elem) {
+        if (elem.getGeometryTypeId() != GEOS_POLYGON || elem.isEmpty()) {
+            return;
+        }
+        const Polygon& poly = static_cast<const Polygon&>(elem);
+        encodeRing(*poly.getExteriorRing()->getCoordinatesRO(), true, commands);
+        for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+            encodeRing(*poly.getInteriorRingN(i)->getCoordinatesRO(), false, commands);
+        }
+    });
+}
+
+/* private */
+void
+MVTEncoder::encodeRing(const CoordinateSequence& seq, bool isShell, std::vector<uint32_t>& commands)
+{
+    // The closing point is implied by ClosePath
+    const std::size_t n = seq.size() - 1;
+
+    // Twice the signed area, positive for rings that are clockwise
+    // with Y pointing down
+    int64_t area = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        const CoordinateXY& p0 = seq.getAt<CoordinateXY>(i);
+        const CoordinateXY& p1 = seq.getAt<CoordinateXY>(i + 1);
+        area += static_cast<int64_t>(p0.x) * static_cast<int64_t>(p1.y)
+              - static_cast<int64_t>(p1.x) * static_cast<int64_t>(p0.y);
+    }
+    if (area == 0) {
+        return;
+    }
+    const bool reverse = (area > 0) != isShell;
+
+    commands.push_back(command(CMD_MOVE_TO, 1));
+    const CoordinateXY& first = seq.getAt<CoordinateXY>(0);
+    writeParameters(static_cast<int32_t>(first.x), static_cast<int32_t>(first.y), commands);
+    commands.push_back(command(CMD_LINE_TO, n - 1));
+    for (std::size_t i = 1; i < n; i++) {
+        const CoordinateXY& c = seq.getAt<CoordinateXY>(reverse ? n - i : i);
+        writeParameters(static_cast<int32_t>(c.x), static_cast<int32_t>(c.y), commands);
+    }
+    commands.push_back(command(CMD_CLOSE_PATH, 1));
+}
+
+/* private */
+std::unique_ptr<Polygon>
+MVTEncoder::toTilePolygon(const Polygon& poly) const
+{
+    const GeometryFactory* factory = poly.getFactory();
+
+    auto shellSeq = toTileRing(*poly.getExteriorRing()->getCoordinatesRO());
+    if (!shellSeq) {
+        return nullptr;
+    }
+    auto shell = factory->createLinearRing(std::move(shellSeq));
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+        auto holeSeq = toTileRing(*poly.getInteriorRingN(i)->getCoordinatesRO());
+        if (holeSeq) {
+            holes.push_back(factory->createLinearRing(std::move(holeSeq)));
+        }
+    }
+    return factory->createPolygon(std::move(shell), std::move(holes));
+}
+
+/* private */
+std::unique_ptr<CoordinateSequence>
+MVTEncoder::toTileRing(const CoordinateSequence& seq) const
+{
+    auto ring = detail::make_unique<CoordinateSequence>(0u, false, false);
+    ring->reserve(seq.size());
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        const CoordinateXY& c = seq.getAt<CoordinateXY>(i);
+        ring->add(CoordinateXY(toTileX(c.x), toTileY(c.y)), false);
+    }
+    // Rings collapsed to a line or a point are dropped
+    if (ring->size() < 4) {
+        return nullptr;
+    }
+    return ring;
+}
+
+/* private */
+void
+MVTEncoder::toTilePoints(const CoordinateSequence& seq)
+{
+    tilePoints.clear();
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        const CoordinateXY& c = seq.getAt<CoordinateXY>(i);
+        const int32_t x = toTileX(c.x);
+        const int32_t y = toTileY(c.y);
+        const std::size_t n = tilePoints.size();
+        if (n > 0 && tilePoints[n - 2] == x && tilePoints[n - 1] == y) {
+            continue;
+        }
+        tilePoints.push_back(x);
+        tilePoints.push_back(y);
+    }
+}
+
+/* private */
+int32_t
+MVTEncoder::toTileX(double x) const
+{
+    const double v = util::round((x - tileEnvelope.getMinX()) * scaleX);
+    if (!std::isfinite(v)) {
+        throw util::IllegalArgumentException("Cannot encode non-finite coordinate as MVT");
+    }
+    return static_cast<int32_t>(v);
+}
+
+/* private */
+int32_t
+MVTEncoder::toTileY(double y) const
+{
+    const double v = util::round((tileEnvelope.getMaxY() - y) * scaleY);
+    if (!std::isfinite(v)) {
+        throw util::IllegalArgumentException("Cannot encode non-finite coordinate as MVT");
+    }
+    return static_cast<int32_t>(v);
+}
+
+/* private */
+void
+MVTEncoder::writeParameters(int32_t x, int32_t y, std::vector<uint32_t>& commands)
+{
+    commands.push_back(zigzag(x - cursorX));
+    commands.push_back(zigzag(y - cursorY));
+    cursorX = x;
+    cursorY = y;
+}
+
+} // namespace geos.io
+} // namespace geos
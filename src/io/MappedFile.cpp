@@ -0,0 +1,128 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/MappedFile.h>
+#include <geos/util/GEOSException.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace geos {
+namespace io { // geos.io
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path)
+    : fileData(nullptr)
+    , fileSize(0)
+    , mappingHandle(nullptr)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw util::GEOSException("Cannot open " + path);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw util::GEOSException("Cannot get size of " + path);
+    }
+    fileSize = static_cast<std::size_t>(size.QuadPart);
+    if (fileSize == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mappingHandle == nullptr) {
+        throw util::GEOSException("Cannot map " + path);
+    }
+
+    fileData = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (fileData == nullptr) {
+        CloseHandle(mappingHandle);
+        throw util::GEOSException("Cannot map " + path);
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (fileData != nullptr) {
+        UnmapViewOfFile(fileData);
+    }
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+    : fileData(nullptr)
+    , fileSize(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw util::GEOSException("Cannot open " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        throw util::GEOSException("Cannot get size of " + path + ": " + std::strerror(err));
+    }
+    fileSize = static_cast<std::size_t>(st.st_size);
+    if (fileSize == 0) {
+        close(fd);
+        return;
+    }
+
+    void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    // The mapping stays valid after the file is closed
+    close(fd);
+    if (addr == MAP_FAILED) {
+        throw util::GEOSException("Cannot map " + path + ": " + std::strerror(err));
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(addr, fileSize, MADV_SEQUENTIAL);
+#endif
+    fileData = static_cast<const unsigned char*>(addr);
+}
+
+MappedFile::~MappedFile()
+{
+    if (fileData != nullptr) {
+        munmap(const_cast<unsigned char*>(fileData), fileSize);
+    }
+}
+
+#endif
+
+} // namespace geos.io
+} // namespace geos
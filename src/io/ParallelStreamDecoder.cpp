@@ -0,0 +1,172 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/ParallelStreamDecoder.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/Parallel.h>
+
+#include <system_error>
+
+using geos::geom::Geometry;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+// Number of records read per batch, per decoding thread
+const std::size_t RECORDS_PER_THREAD = 256;
+
+// Number of records decoded per work item
+const std::size_t BLOCK_SIZE = 16;
+
+} // anonymous namespace
+
+ParallelStreamDecoder::ParallelStreamDecoder(RecordReader p_reader,
+        RecordDecoder p_decoder,
+        std::size_t p_numThreads,
+        BatchScope p_scope)
+    : reader(std::move(p_reader))
+    , decoder(std::move(p_decoder))
+    , scope(std::move(p_scope))
+    , numThreads(util::resolveThreadCount(p_numThreads))
+    , batchSize(numThreads * RECORDS_PER_THREAD)
+    , currentPos(0)
+    , isStarted(false)
+{}
+
+ParallelStreamDecoder::~ParallelStreamDecoder()
+{
+    // The worker threads refer to the batch being decoded
+    if (decodingDone.valid()) {
+        decodingDone.wait();
+    }
+}
+
+/* public */
+std::unique_ptr<Geometry>
+ParallelStreamDecoder::next()
+{
+    if (scope && (current == nullptr || currentPos == current->records.size())) {
+        // Decode the next batch before returning, reusing the storage
+        // of the batch that has been returned
+        std::unique_ptr<Batch> batch = current ? std::move(current) : std::unique_ptr<Batch>(new Batch);
+        readBatch(*batch);
+        current = std::move(batch);
+        currentPos = 0;
+        if (current->records.empty()) {
+            return nullptr;
+        }
+        Batch* b = current.get();
+        scope([this, b]() {
+            decodeBatch(*b);
+        });
+    }
+    else if (current == nullptr || currentPos == current->records.size()) {
+        if (!isStarted) {
+            isStarted = true;
+            std::unique_ptr<Batch> first(new Batch);
+            readBatch(*first);
+            startDecoding(std::move(first));
+        }
+        if (decoding == nullptr) {
+            return nullptr;
+        }
+
+        // Read the following batch while the pending one is decoded,
+        // reusing the storage of the batch that has been returned
+        std::unique_ptr<Batch> following = current ? std::move(current) : std::unique_ptr<Batch>(new Batch);
+        readBatch(*following);
+
+        decodingDone.get();
+        current = std::move(decoding);
+        currentPos = 0;
+
+        if (!following->records.empty()) {
+            startDecoding(std::move(following));
+        }
+        if (current->records.empty()) {
+            return nullptr;
+        }
+    }
+
+    std::size_t i = currentPos++;
+    if (current->errors[i]) {
+        std::rethrow_exception(current->errors[i]);
+    }
+    return std::move(current->geoms[i]);
+}
+
+/* private */
+void
+ParallelStreamDecoder::readBatch(Batch& batch)
+{
+    // Keep the string capacity of records that are overwritten
+    std::size_t n = 0;
+    while (n < batchSize) {
+        if (n == batch.records.size()) {
+            batch.records.emplace_back();
+        }
+        if (!reader(batch.records[n])) {
+            break;
+        }
+        n++;
+    }
+    batch.records.resize(n);
+}
+
+/* private */
+void
+ParallelStreamDecoder::startDecoding(std::unique_ptr<Batch> batch)
+{
+    Batch* b = batch.get();
+    decoding = std::move(batch);
+
+    auto decodeAll = [this, b]() {
+        decodeBatch(*b);
+    };
+
+    try {
+        decodingDone = std::async(std::launch::async, decodeAll);
+    }
+    catch (const std::system_error&) {
+        // Could not start a thread; decode when the batch is needed
+        decodingDone = std::async(std::launch::deferred, decodeAll);
+    }
+}
+
+/* private */
+void
+ParallelStreamDecoder::decodeBatch(Batch& batch)
+{
+    const std::size_t n = batch.records.size();
+    batch.geoms.clear();
+    batch.geoms.resize(n);
+    batch.errors.assign(n, nullptr);
+
+    Batch* b = &batch;
+    util::parallelFor(n, numThreads, BLOCK_SIZE, [this, b](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            try {
+                b->geoms[i] = decoder(b->records[i]);
+            }
+            catch (...) {
+                b->errors[i] = std::current_exception();
+            }
+        }
+    });
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -20,6 +20,8 @@
 #include <geos/io/StringTokenizer.h>
 #include <geos/constants.h>
 
+#include <cfloat>
+#include <cstdint>
 #include <string>
 #include <cstdlib>
 #include <limits>
@@ -29,14 +31,130 @@ using std::string;
 namespace geos {
 namespace io { // geos.io
 
+namespace {
+
+bool
+isWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+bool
+isDelimiter(char c)
+{
+    return isWhitespace(c) || c == '(' || c == ')' || c == ',';
+}
+
+bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/*
+ * Parses a plain decimal number ([+-]digits[.digits][(e|E)[+-]digits])
+ * whose significand fits in 53 bits and whose decimal exponent is at
+ * most 22 in magnitude. Such a number is an exact double multiplied or
+ * divided by an exact power of ten, so a single correctly rounded
+ * operation gives the same result as strtod (Clinger's fast path).
+ *
+ * Returns false, without setting result, for any other text.
+ */
+bool
+parseSimpleNumber(const char* p, const char* end, double& result)
+{
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const std::uint64_t maxSignificand = std::uint64_t(1) << 53;
+
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    std::uint64_t significand = 0;
+    int numDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+
+    for (; p != end && isDigit(*p); ++p) {
+        hasDigits = true;
+        significand = significand * 10 + static_cast<std::uint64_t>(*p - '0');
+        if (significand > maxSignificand) {
+            return false;
+        }
+    }
+    if (p != end && *p == '.') {
+        for (++p; p != end && isDigit(*p); ++p) {
+            hasDigits = true;
+            significand = significand * 10 + static_cast<std::uint64_t>(*p - '0');
+            if (significand > maxSignificand) {
+                return false;
+            }
+            exponent--;
+        }
+    }
+    if (!hasDigits) {
+        return false;
+    }
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExponent = false;
+        if (p != end && (*p == '-' || *p == '+')) {
+            negativeExponent = (*p == '-');
+            ++p;
+        }
+        int exp = 0;
+        for (; p != end && isDigit(*p); ++p) {
+            exp = exp * 10 + (*p - '0');
+            if (++numDigits > 3) {
+                return false;
+            }
+        }
+        if (numDigits == 0) {
+            return false;
+        }
+        exponent += negativeExponent ? -exp : exp;
+    }
+
+    if (p != end || exponent < -22 || exponent > 22) {
+        return false;
+    }
+
+    double d = static_cast<double>(significand);
+    if (exponent < 0) {
+        d /= powersOfTen[-exponent];
+    }
+    else {
+        d *= powersOfTen[exponent];
+    }
+    result = negative ? -d : d;
+    return true;
+#else
+    (void) p;
+    (void) end;
+    (void) result;
+    return false;
+#endif
+}
+
+} // anonymous namespace
+
 /*public*/
 StringTokenizer::StringTokenizer(const string& txt)
     :
-    str(txt),
     stok(""),
-    ntok(0.0)
+    ntok(0.0),
+    iter(txt.c_str()),
+    end(txt.c_str() + txt.size()),
+    peekType(TT_EOF),
+    peekEnd(nullptr)
 {
-    iter = str.begin();
 }
 
 double
@@ -75,112 +193,90 @@ strtod_with_vc_fix(const char* str, char** str_end)
     return dbl;
 }
 
-/*public*/
+/*private*/
 int
-StringTokenizer::nextToken()
+StringTokenizer::readToken(const char*& pos)
 {
-    string tok = "";
-    if(iter == str.end()) {
+    while(pos != end && isWhitespace(*pos)) {
+        ++pos;
+    }
+    if(pos == end) {
         return StringTokenizer::TT_EOF;
     }
-    switch(*iter) {
+    switch(*pos) {
     case '(':
     case ')':
     case ',':
-        return *iter++;
-    case '\n':
-    case '\r':
-    case '\t':
-    case ' ':
-        string::size_type pos = str.find_first_not_of(" \n\r\t",
-                                static_cast<string::size_type>(iter - str.begin()));
-        if(pos == string::npos) {
-            return StringTokenizer::TT_EOF;
-        }
-        else {
-            iter = str.begin() + static_cast<string::difference_type>(pos);
-            return nextToken();
-        }
+        return *pos++;
     }
-    string::size_type pos = str.find_first_of("\n\r\t() ,",
-                            static_cast<string::size_type>(iter - str.begin()));
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-            iter = str.end();
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
+
+    // It's either a Number or a Word, let's see when it ends
+    const char* start = pos;
+    while(pos != end && !isDelimiter(*pos)) {
+        ++pos;
     }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos));
-        iter = str.begin() + static_cast<string::difference_type>(pos);
+
+    double dbl;
+    if(parseSimpleNumber(start, pos, dbl)) {
+        ntok = dbl;
+        stok.clear();
+        return StringTokenizer::TT_NUMBER;
     }
+
     char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
+#if !(_MSC_VER && !__INTEL_COMPILER)
+    // The text is null-terminated, so strtod can read it in place.
+    // Text it stops short of is a word; text beyond the token
+    // (e.g. "nan(...)") is handled on a copy of the token.
+    dbl = std::strtod(start, &stopstring);
+    if(stopstring == pos) {
+        ntok = dbl;
+        stok.clear();
+        return StringTokenizer::TT_NUMBER;
+    }
+    if(stopstring < pos) {
+        ntok = 0.0;
+        stok.assign(start, pos);
+        return StringTokenizer::TT_WORD;
+    }
+#endif
+
+    string tok(start, pos);
+    dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
     if(*stopstring == '\0') {
         ntok = dbl;
-        stok = "";
+        stok.clear();
         return StringTokenizer::TT_NUMBER;
     }
     else {
         ntok = 0.0;
-        stok = tok;
+        stok = std::move(tok);
         return StringTokenizer::TT_WORD;
     }
 }
 
 /*public*/
 int
-StringTokenizer::peekNextToken()
+StringTokenizer::nextToken()
 {
-
-    string::size_type pos;
-    string tok = "";
-    if(iter == str.end()) {
-        return StringTokenizer::TT_EOF;
-    }
-
-    pos = str.find_first_not_of(" \r\n\t", static_cast<string::size_type>(iter - str.begin()));
-
-    if(pos == string::npos) {
-        return StringTokenizer::TT_EOF;
-    }
-    switch(str[pos]) {
-    case '(':
-    case ')':
-    case ',':
-        return str[pos];
-    }
-
-    // It's either a Number or a Word, let's see when it ends
-    pos = str.find_first_of("\n\r\t() ,", pos + 1);
-
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
-    }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos)); //str.end());
+    if(peekEnd != nullptr) {
+        iter = peekEnd;
+        peekEnd = nullptr;
+        return peekType;
     }
+    return readToken(iter);
+}
 
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
-        ntok = dbl;
-        stok = "";
-        return StringTokenizer::TT_NUMBER;
-    }
-    else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
+/*public*/
+int
+StringTokenizer::peekNextToken()
+{
+    if(peekEnd == nullptr) {
+        const char* pos = iter;
+        peekType = readToken(pos);
+        peekEnd = pos;
     }
+    return peekType;
 }
 
 /*public*/
@@ -197,5 +293,18 @@ StringTokenizer::getSVal() const
     return stok;
 }
 
+/*public*/
+std::size_t
+StringTokenizer::countCommasBeforeCloser() const
+{
+    std::size_t count = 0;
+    for(const char* pos = iter; pos != end && *pos != ')'; ++pos) {
+        if(*pos == ',') {
+            count++;
+        }
+    }
+    return count;
+}
+
 } // namespace geos.io
 } // namespace geos
@@ -0,0 +1,286 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBConstants.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+const double POW10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8 };
+
+int64_t
+unzigzag(uint64_t n)
+{
+    return (n & 1) ? static_cast<int64_t>(~(n >> 1)) : static_cast<int64_t>(n >> 1);
+}
+
+double
+unquantize(int64_t q, int precision)
+{
+    // Dividing rounds q / 10^p correctly, multiplying by 10^-p would not
+    return precision >= 0 ? static_cast<double>(q) / POW10[precision] : static_cast<double>(q) * POW10[-precision];
+}
+
+} // anonymous namespace
+
+TWKBReader::TWKBReader(const GeometryFactory& f)
+    : factory(f)
+    , pos(nullptr)
+    , end(nullptr)
+    , hasZ(false)
+    , hasM(false)
+    , numOrdinates(2)
+    , precision{0, 0, 0, 0}
+    , previous{0, 0, 0, 0}
+{}
+
+TWKBReader::TWKBReader()
+    : TWKBReader(*(GeometryFactory::getDefaultInstance()))
+{}
+
+/* public */
+std::unique_ptr<Geometry>
+TWKBReader::read(const unsigned char* buf, std::size_t size)
+{
+    pos = buf;
+    end = buf + size;
+    return readGeometry();
+}
+
+/* public */
+std::unique_ptr<Geometry>
+TWKBReader::read(std::istream& is)
+{
+    std::vector<unsigned char> buf{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    return read(buf.data(), buf.size());
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TWKBReader::readGeometry()
+{
+    const unsigned char typeAndPrecision = readByte();
+    const int type = typeAndPrecision & 0x0f;
+    const int precisionXY = static_cast<int>(unzigzag(typeAndPrecision >> 4));
+
+    const unsigned char metadata = readByte();
+    hasZ = false;
+    hasM = false;
+    int precisionZ = 0;
+    int precisionM = 0;
+    if (metadata & TWKBConstants::twkbExtendedDims) {
+        const unsigned char ext = readByte();
+        hasZ = (ext & TWKBConstants::twkbHasZ) != 0;
+        hasM = (ext & TWKBConstants::twkbHasM) != 0;
+        precisionZ = (ext >> 2) & 0x07;
+        precisionM = (ext >> 5) & 0x07;
+    }
+    numOrdinates = 2u + (hasZ ? 1u : 0u) + (hasM ? 1u : 0u);
+    precision[0] = precisionXY;
+    precision[1] = precisionXY;
+    precision[2] = hasZ ? precisionZ : precisionM;
+    precision[3] = precisionM;
+    std::fill(previous, previous + 4, 0);
+
+    if (metadata & TWKBConstants::twkbSize) {
+        readVarint();
+    }
+    if (metadata & TWKBConstants::twkbBBox) {
+        for (std::size_t i = 0; i < 2 * numOrdinates; i++) {
+            readVarint();
+        }
+    }
+
+    GeometryTypeId typeId;
+    switch(type) {
+    case WKBConstants::wkbPoint: typeId = GEOS_POINT; break;
+    case WKBConstants::wkbLineString: typeId = GEOS_LINESTRING; break;
+    case WKBConstants::wkbPolygon: typeId = GEOS_POLYGON; break;
+    case WKBConstants::wkbMultiPoint: typeId = GEOS_MULTIPOINT; break;
+    case WKBConstants::wkbMultiLineString: typeId = GEOS_MULTILINESTRING; break;
+    case WKBConstants::wkbMultiPolygon: typeId = GEOS_MULTIPOLYGON; break;
+    case WKBConstants::wkbGeometryCollection: typeId = GEOS_GEOMETRYCOLLECTION; break;
+    default:
+        throw ParseException("Unknown TWKB geometry type", type);
+    }
+
+    if (metadata & TWKBConstants::twkbEmpty) {
+        return factory.createEmptyGeometry(typeId, hasZ, hasM);
+    }
+
+    std::size_t n = 1;
+    if (typeId != GEOS_POINT && typeId != GEOS_LINESTRING && typeId != GEOS_POLYGON) {
+        n = readCount();
+        if (metadata & TWKBConstants::twkbIdList) {
+            for (std::size_t i = 0; i < n; i++) {
+                readVarint();
+            }
+        }
+    }
+
+    switch(typeId) {
+    case GEOS_POINT:
+        return factory.createPoint(readCoordinates(1));
+    case GEOS_LINESTRING:
+        return factory.createLineString(readCoordinates(readCount()));
+    case GEOS_POLYGON:
+        return readPolygon();
+    case GEOS_MULTIPOINT: {
+        std::vector<std::unique_ptr<Point>> points(n);
+        for (auto& point : points) {
+            point = factory.createPoint(readCoordinates(1));
+        }
+        return factory.createMultiPoint(std::move(points));
+    }
+    case GEOS_MULTILINESTRING: {
+        std::vector<std::unique_ptr<LineString>> lines(n);
+        for (auto& line : lines) {
+            line = factory.createLineString(readCoordinates(readCount()));
+        }
+        return factory.createMultiLineString(std::move(lines));
+    }
+    case GEOS_MULTIPOLYGON: {
+        std::vector<std::unique_ptr<Polygon>> polys(n);
+        for (auto& poly : polys) {
+            poly = readPolygon();
+        }
+        return factory.createMultiPolygon(std::move(polys));
+    }
+    default: {
+        std::vector<std::unique_ptr<Geometry>> geoms(n);
+        for (auto& geom : geoms) {
+            geom = readGeometry();
+        }
+        return factory.createGeometryCollection(std::move(geoms));
+    }
+    }
+}
+
+/* private */
+std::unique_ptr<Polygon>
+TWKBReader::readPolygon()
+{
+    std::size_t numRings = readCount();
+    if (numRings == 0) {
+        return factory.createPolygon(hasZ, hasM);
+    }
+    auto shell = factory.createLinearRing(readCoordinates(readCount()));
+    std::vector<std::unique_ptr<LinearRing>> holes(numRings - 1);
+    for (auto& hole : holes) {
+        hole = factory.createLinearRing(readCoordinates(readCount()));
+    }
+    return factory.createPolygon(std::move(shell), std::move(holes));
+}
+
+/* private */
+std::unique_ptr<CoordinateSequence>
+TWKBReader::readCoordinates(std::size_t n)
+{
+    // Each value takes at least one byte
+    if (n > static_cast<std::size_t>(end - pos) / numOrdinates) {
+        throw ParseException("Unexpected EOF parsing TWKB");
+    }
+
+    auto seq = geos::detail::make_unique<CoordinateSequence>(n, hasZ, hasM, false);
+    CoordinateXYZM c;
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t k = 0; k < numOrdinates; k++) {
+            int64_t delta = unzigzag(readVarint());
+            // The sum of the deltas of crafted input can overflow
+            if (delta > 0 ? previous[k] > std::numeric_limits<int64_t>::max() - delta
+                    : previous[k] < std::numeric_limits<int64_t>::min() - delta) {
+                throw ParseException("TWKB coordinate out of range");
+            }
+            previous[k] += delta;
+        }
+        c.x = unquantize(previous[0], precision[0]);
+        c.y = unquantize(previous[1], precision[1]);
+        std::size_t k = 2;
+        if (hasZ) {
+            c.z = unquantize(previous[k], precision[k]);
+            k++;
+        }
+        if (hasM) {
+            c.m = unquantize(previous[k], precision[k]);
+        }
+        seq->setAt(c, i);
+    }
+    return seq;
+}
+
+/* private */
+unsigned char
+TWKBReader::readByte()
+{
+    if (pos == end) {
+        throw ParseException("Unexpected EOF parsing TWKB");
+    }
+    return *pos++;
+}
+
+/* private */
+uint64_t
+TWKBReader::readVarint()
+{
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        const unsigned char b = readByte();
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            return v;
+        }
+    }
+    throw ParseException("Invalid varint in TWKB");
+}
+
+/* private */
+std::size_t
+TWKBReader::readCount()
+{
+    uint64_t n = readVarint();
+    // Each item takes at least one byte
+    if (n > static_cast<uint64_t>(end - pos)) {
+        throw ParseException("Unexpected EOF parsing TWKB");
+    }
+    return static_cast<std::size_t>(n);
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,391 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/TWKBConstants.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+const double POW10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8 };
+
+// Largest magnitude of a rounded value, so that differences fit in 64 bits
+const double MAX_ROUNDED = 4.6e18;
+
+uint64_t
+zigzag(int64_t n)
+{
+    return n < 0 ? ~(static_cast<uint64_t>(n) << 1) : static_cast<uint64_t>(n) << 1;
+}
+
+void
+writeVarint(uint64_t v, std::vector<unsigned char>& out)
+{
+    while (v >= 0x80) {
+        out.push_back(static_cast<unsigned char>((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(v));
+}
+
+int64_t
+quantize(double v, int precision)
+{
+    double scaled = precision >= 0 ? v * POW10[precision] : v / POW10[-precision];
+    if (!(std::fabs(scaled) < MAX_ROUNDED)) {
+        throw util::IllegalArgumentException("Coordinate value cannot be written to TWKB at this precision");
+    }
+    return static_cast<int64_t>(std::llround(scaled));
+}
+
+} // anonymous namespace
+
+struct TWKBWriter::Bounds {
+    // Indexed by ordinate, X, Y, Z and M, so that the bounds of a child
+    // with fewer dimensions than its parent only expand the ones it has
+    int64_t min[4];
+    int64_t max[4];
+    bool has[4];
+
+    Bounds() : min{0, 0, 0, 0}, max{0, 0, 0, 0}, has{false, false, false, false} {}
+
+    void
+    expandToInclude(std::size_t i, int64_t v)
+    {
+        if (!has[i] || v < min[i]) {
+            min[i] = v;
+        }
+        if (!has[i] || v > max[i]) {
+            max[i] = v;
+        }
+        has[i] = true;
+    }
+
+    void
+    expandToInclude(const int64_t* q, bool withZ, bool withM)
+    {
+        expandToInclude(0, q[0]);
+        expandToInclude(1, q[1]);
+        std::size_t k = 2;
+        if (withZ) {
+            expandToInclude(2, q[k++]);
+        }
+        if (withM) {
+            expandToInclude(3, q[k]);
+        }
+    }
+
+    void
+    expandToInclude(const Bounds& other)
+    {
+        for (std::size_t i = 0; i < 4; i++) {
+            if (other.has[i]) {
+                expandToInclude(i, other.min[i]);
+                expandToInclude(i, other.max[i]);
+            }
+        }
+    }
+};
+
+TWKBWriter::TWKBWriter()
+    : precisionXY(0)
+    , precisionZ(0)
+    , precisionM(0)
+    , outputDimension(4)
+    , includeBoundingBox(false)
+    , includeSize(false)
+    , hasZ(false)
+    , hasM(false)
+    , numOrdinates(2)
+    , precision{0, 0, 0, 0}
+    , previous{0, 0, 0, 0}
+{}
+
+/* public */
+void
+TWKBWriter::setPrecision(int p)
+{
+    if (p < TWKBConstants::twkbMinPrecision || p > TWKBConstants::twkbMaxPrecision) {
+        throw util::IllegalArgumentException("TWKB precision must be between -8 and 7");
+    }
+    precisionXY = p;
+}
+
+/* public */
+void
+TWKBWriter::setPrecisionZ(int p)
+{
+    if (p < 0 || p > TWKBConstants::twkbMaxPrecisionZM) {
+        throw util::IllegalArgumentException("TWKB Z precision must be between 0 and 7");
+    }
+    precisionZ = p;
+}
+
+/* public */
+void
+TWKBWriter::setPrecisionM(int p)
+{
+    if (p < 0 || p > TWKBConstants::twkbMaxPrecisionZM) {
+        throw util::IllegalArgumentException("TWKB M precision must be between 0 and 7");
+    }
+    precisionM = p;
+}
+
+/* public */
+void
+TWKBWriter::setOutputDimension(uint8_t dims)
+{
+    if (dims < 2 || dims > 4) {
+        throw util::IllegalArgumentException("TWKB output dimension must be 2, 3, or 4");
+    }
+    outputDimension = dims;
+}
+
+/* public */
+void
+TWKBWriter::write(const Geometry& g, std::ostream& os)
+{
+    std::vector<unsigned char> buf;
+    write(g, buf);
+    os.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+}
+
+/* public */
+void
+TWKBWriter::write(const Geometry& g, std::vector<unsigned char>& buf)
+{
+    writeGeometry(g, buf, nullptr);
+}
+
+/* private */
+void
+TWKBWriter::writeGeometry(const Geometry& g, std::vector<unsigned char>& out, Bounds* parentBounds)
+{
+    util::ensureNoCurvedComponents(g);
+
+    // Drop M, then Z, to meet the output dimension, as WKBWriter does
+    hasZ = g.hasZ();
+    hasM = g.hasM();
+    std::size_t dims = 2u + (hasZ ? 1u : 0u) + (hasM ? 1u : 0u);
+    while (dims > outputDimension) {
+        if (hasM) {
+            hasM = false;
+        }
+        else {
+            hasZ = false;
+        }
+        dims--;
+    }
+    numOrdinates = dims;
+    // hasZ is overwritten by the elements of a collection
+    const bool withZ = hasZ;
+    precision[0] = precisionXY;
+    precision[1] = precisionXY;
+    precision[2] = hasZ ? precisionZ : precisionM;
+    precision[3] = precisionM;
+    std::fill(previous, previous + 4, 0);
+
+    const int type = WKBWriter::getWkbType(g);
+    const bool isEmpty = g.isEmpty();
+
+    unsigned char metadata = 0;
+    if (hasZ || hasM) {
+        metadata |= TWKBConstants::twkbExtendedDims;
+    }
+    if (isEmpty) {
+        metadata |= TWKBConstants::twkbEmpty;
+    }
+    else {
+        if (includeBoundingBox) {
+            metadata |= TWKBConstants::twkbBBox;
+        }
+        if (includeSize) {
+            metadata |= TWKBConstants::twkbSize;
+        }
+    }
+
+    out.push_back(static_cast<unsigned char>((zigzag(precisionXY) << 4) | static_cast<uint64_t>(type)));
+    out.push_back(metadata);
+    if (hasZ || hasM) {
+        int ext = (hasZ ? TWKBConstants::twkbHasZ : 0) | (hasM ? TWKBConstants::twkbHasM : 0);
+        ext |= (hasZ ? precisionZ : 0) << 2;
+        ext |= (hasM ? precisionM : 0) << 5;
+        out.push_back(static_cast<unsigned char>(ext));
+    }
+    if (isEmpty) {
+        return;
+    }
+
+    const std::size_t bodyStart = out.size();
+    Bounds bounds;
+    Bounds* b = includeBoundingBox ? &bounds : nullptr;
+
+    switch(type) {
+    case WKBConstants::wkbPoint:
+        writeCoordinates(*static_cast<const Point&>(g).getCoordinatesRO(), 1, false, out, b);
+        break;
+    case WKBConstants::wkbLineString:
+        writeCoordinates(*static_cast<const LineString&>(g).getCoordinatesRO(), 2, true, out, b);
+        break;
+    case WKBConstants::wkbPolygon:
+        writePolygon(static_cast<const Polygon&>(g), out, b);
+        break;
+    case WKBConstants::wkbMultiPoint: {
+        // Empty points cannot be represented in a TWKB MultiPoint
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            n += !g.getGeometryN(i)->isEmpty();
+        }
+        writeVarint(n, out);
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            const auto* point = static_cast<const Point*>(g.getGeometryN(i));
+            if (!point->isEmpty()) {
+                writeCoordinates(*point->getCoordinatesRO(), 1, false, out, b);
+            }
+        }
+        break;
+    }
+    case WKBConstants::wkbMultiLineString:
+        writeVarint(g.getNumGeometries(), out);
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            const auto* line = static_cast<const LineString*>(g.getGeometryN(i));
+            writeCoordinates(*line->getCoordinatesRO(), 2, true, out, b);
+        }
+        break;
+    case WKBConstants::wkbMultiPolygon:
+        writeVarint(g.getNumGeometries(), out);
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            writePolygon(*static_cast<const Polygon*>(g.getGeometryN(i)), out, b);
+        }
+        break;
+    case WKBConstants::wkbGeometryCollection:
+        writeVarint(g.getNumGeometries(), out);
+        for (std::size_t i = 0; i < g.getNumGeometries(); i++) {
+            writeGeometry(*g.getGeometryN(i), out, b);
+        }
+        break;
+    default:
+        throw util::IllegalArgumentException("Unsupported geometry type for TWKB: " + g.getGeometryType());
+    }
+
+    if (includeBoundingBox || includeSize) {
+        std::vector<unsigned char> bbox;
+        if (includeBoundingBox) {
+            for (std::size_t i = 0; i < dims; i++) {
+                std::size_t o = (i < 2 || (i == 2 && withZ)) ? i : 3;
+                writeVarint(zigzag(bounds.min[o]), bbox);
+                writeVarint(zigzag(bounds.max[o] - bounds.min[o]), bbox);
+            }
+        }
+        std::vector<unsigned char> head;
+        if (includeSize) {
+            writeVarint(bbox.size() + out.size() - bodyStart, head);
+        }
+        head.insert(head.end(), bbox.begin(), bbox.end());
+        out.insert(out.begin() + static_cast<std::ptrdiff_t>(bodyStart), head.begin(), head.end());
+    }
+
+    if (parentBounds != nullptr) {
+        parentBounds->expandToInclude(bounds);
+    }
+}
+
+/* private */
+void
+TWKBWriter::writePolygon(const Polygon& poly, std::vector<unsigned char>& out, Bounds* bounds)
+{
+    if (poly.isEmpty()) {
+        writeVarint(0, out);
+        return;
+    }
+    writeVarint(1 + poly.getNumInteriorRing(), out);
+    writeCoordinates(*poly.getExteriorRing()->getCoordinatesRO(), 4, true, out, bounds);
+    for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+        writeCoordinates(*poly.getInteriorRingN(i)->getCoordinatesRO(), 4, true, out, bounds);
+    }
+}
+
+/* private */
+void
+TWKBWriter::writeCoordinates(const CoordinateSequence& seq, std::size_t minPoints, bool writeCount,
+                             std::vector<unsigned char>& out, Bounds* bounds)
+{
+    // The number of points is only known once repeated points are dropped
+    std::vector<unsigned char>& dest = writeCount ? pointBuffer : out;
+    if (writeCount) {
+        pointBuffer.clear();
+    }
+
+    const std::size_t n = seq.size();
+    std::size_t numWritten = 0;
+    CoordinateXYZM c;
+    int64_t q[4];
+
+    for (std::size_t i = 0; i < n; i++) {
+        seq.getAt(i, c);
+        q[0] = quantize(c.x, precision[0]);
+        q[1] = quantize(c.y, precision[1]);
+        std::size_t k = 2;
+        if (hasZ) {
+            q[k] = quantize(c.z, precision[k]);
+            k++;
+        }
+        if (hasM) {
+            q[k] = quantize(c.m, precision[k]);
+        }
+
+        bool isRepeated = numWritten > 0 && std::equal(q, q + numOrdinates, previous);
+        if (isRepeated && numWritten + (n - i - 1) >= minPoints) {
+            continue;
+        }
+
+        for (k = 0; k < numOrdinates; k++) {
+            writeVarint(zigzag(q[k] - previous[k]), dest);
+            previous[k] = q[k];
+        }
+        if (bounds != nullptr) {
+            bounds->expandToInclude(q, hasZ, hasM);
+        }
+        numWritten++;
+    }
+
+    if (writeCount) {
+        writeVarint(numWritten, out);
+        out.insert(out.end(), pointBuffer.begin(), pointBuffer.end());
+    }
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -13,6 +13,7 @@
  **********************************************************************/
 
 #include <geos/io/WKBReader.h>
+#include <geos/io/ParseException.h>
 
 #include <fstream>
 #include <iostream>
@@ -20,6 +21,7 @@
 #include <memory> // for unique_ptr
 
 #include <geos/io/WKBStreamReader.h>
+#include <geos/util/IllegalStateException.h>
 
 using geos::geom::Geometry;
 
@@ -27,7 +29,18 @@ namespace geos {
 namespace io {
 
 WKBStreamReader::WKBStreamReader(std::istream& p_instr)
-    : instr(p_instr)
+    : instr(&p_instr)
+    , bufPos(nullptr)
+    , bufEnd(nullptr)
+    , numThreads(1)
+{
+}
+
+WKBStreamReader::WKBStreamReader(const unsigned char* buf, std::size_t size)
+    : instr(nullptr)
+    , bufPos(buf)
+    , bufEnd(buf + size)
+    , numThreads(1)
 {
 }
 
@@ -36,7 +49,15 @@ WKBStreamReader::~WKBStreamReader() {
 }
 
 /*public*/
-
+void
+WKBStreamReader::setNumThreads(std::size_t n)
+{
+    // Records read ahead by the decoder would be lost
+    if (decoder != nullptr) {
+        throw util::IllegalStateException("WKBStreamReader: cannot change the number of threads while decoding");
+    }
+    numThreads = n;
+}
 
 /*
 Return: nullptr if at EOF
@@ -44,9 +65,41 @@ Return: nullptr if at EOF
 std::unique_ptr<Geometry>
 WKBStreamReader::next()
 {
+    if (numThreads != 1) {
+        if (decoder == nullptr) {
+            ParallelStreamDecoder::RecordDecoder decode;
+            if (instr) {
+                decode = [](const std::string& line) {
+                    WKBReader reader;
+                    std::istringstream hex(line);
+                    return reader.readHEX(hex);
+                };
+            }
+            else {
+                decode = [](const std::string& record) {
+                    WKBReader reader;
+                    return reader.read(reinterpret_cast<const unsigned char*>(record.data()), record.size());
+                };
+            }
+            decoder.reset(new ParallelStreamDecoder(
+                [this](std::string& record) { return readRecord(record); },
+                decode,
+                numThreads));
+        }
+        return decoder->next();
+    }
+
+    if (!instr) {
+        const unsigned char* record;
+        std::size_t size;
+        if (!nextBinaryRecord(record, size)) {
+            return nullptr;
+        }
+        return rdr.read(record, size);
+    }
+
     std::string line;
-    std::getline(instr, line);
-    if (! instr) {
+    if (! readRecord(line)) {
         return nullptr;
     }
     std::istringstream hex(line);
@@ -54,5 +107,45 @@ WKBStreamReader::next()
     return g;
 }
 
+/*private*/
+bool
+WKBStreamReader::readRecord(std::string& line)
+{
+    if (!instr) {
+        const unsigned char* record;
+        std::size_t size;
+        if (!nextBinaryRecord(record, size)) {
+            return false;
+        }
+        line.assign(reinterpret_cast<const char*>(record), size);
+        return true;
+    }
+    std::getline(*instr, line);
+    return static_cast<bool>(*instr);
+}
+
+/*private*/
+bool
+WKBStreamReader::nextBinaryRecord(const unsigned char*& record, std::size_t& size)
+{
+    const std::size_t remaining = static_cast<std::size_t>(bufEnd - bufPos);
+    if (remaining == 0) {
+        return false;
+    }
+    if (remaining < 4) {
+        throw ParseException("Truncated WKB record size");
+    }
+    size = static_cast<std::size_t>(bufPos[0])
+           | static_cast<std::size_t>(bufPos[1]) << 8
+           | static_cast<std::size_t>(bufPos[2]) << 16
+           | static_cast<std::size_t>(bufPos[3]) << 24;
+    if (size > remaining - 4) {
+        throw ParseException("Truncated WKB record");
+    }
+    record = bufPos + 4;
+    bufPos = record + size;
+    return true;
+}
+
 }
 }
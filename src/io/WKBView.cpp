@@ -0,0 +1,204 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/WKBView.h>
+#include <geos/algorithm/CircularArcs.h>
+#include <geos/io/ByteOrderDataInStream.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKBReader.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+
+#include <cmath>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+WKBView::WKBView(const unsigned char* p_buf, std::size_t p_size)
+    : buf(p_buf)
+    , size(p_size)
+    , typeId(GEOS_GEOMETRYCOLLECTION)
+    , srid(0)
+    , m_hasZ(false)
+    , m_hasM(false)
+    , numPoints(0)
+{
+    ByteOrderDataInStream dis(buf, size);
+    scanGeometry(dis, true);
+}
+
+/*private*/
+void
+WKBView::scanGeometry(ByteOrderDataInStream& dis, bool isRoot)
+{
+    unsigned char byteOrder = dis.readByte();
+    if(byteOrder == WKBConstants::wkbNDR) {
+        dis.setOrder(ByteOrderValues::ENDIAN_LITTLE);
+    }
+    else if(byteOrder == WKBConstants::wkbXDR) {
+        dis.setOrder(ByteOrderValues::ENDIAN_BIG);
+    }
+    else {
+        throw ParseException("Unknown WKB byte order", static_cast<double>(byteOrder));
+    }
+
+    // Same type decoding as WKBReader::readGeometry
+    uint32_t typeInt = dis.readUnsigned();
+    uint32_t geometryType = (typeInt & 0xffff) % 1000;
+    uint32_t isoTypeRange = (typeInt & 0xffff) / 1000;
+    bool hasZ = (isoTypeRange == 1) || (isoTypeRange == 3) || (typeInt & 0x80000000) != 0;
+    bool hasM = (isoTypeRange == 2) || (isoTypeRange == 3) || (typeInt & 0x40000000) != 0;
+    unsigned int dim = 2u + (hasZ ? 1u : 0u) + (hasM ? 1u : 0u);
+
+    int geomSRID = 0;
+    if((typeInt & 0x20000000) != 0) {
+        geomSRID = dis.readInt();
+    }
+
+    GeometryTypeId geomTypeId;
+    switch(geometryType) {
+    case WKBConstants::wkbPoint:
+        // POINT EMPTY is written with NaN coordinates, which are not counted
+        geomTypeId = GEOS_POINT;
+        scanCoordinates(dis, 1, dim, false);
+        break;
+    case WKBConstants::wkbLineString:
+        geomTypeId = GEOS_LINESTRING;
+        scanCoordinates(dis, dis.readUnsigned(), dim, false);
+        break;
+    case WKBConstants::wkbCircularString:
+        geomTypeId = GEOS_CIRCULARSTRING;
+        scanCoordinates(dis, dis.readUnsigned(), dim, true);
+        break;
+    case WKBConstants::wkbPolygon: {
+        geomTypeId = GEOS_POLYGON;
+        uint32_t numRings = dis.readUnsigned();
+        for (uint32_t i = 0; i < numRings; i++) {
+            scanCoordinates(dis, dis.readUnsigned(), dim, false);
+        }
+        break;
+    }
+    case WKBConstants::wkbCompoundCurve:
+    case WKBConstants::wkbCurvePolygon:
+    case WKBConstants::wkbMultiPoint:
+    case WKBConstants::wkbMultiLineString:
+    case WKBConstants::wkbMultiPolygon:
+    case WKBConstants::wkbMultiCurve:
+    case WKBConstants::wkbMultiSurface:
+    case WKBConstants::wkbGeometryCollection: {
+        switch(geometryType) {
+        case WKBConstants::wkbCompoundCurve: geomTypeId = GEOS_COMPOUNDCURVE; break;
+        case WKBConstants::wkbCurvePolygon: geomTypeId = GEOS_CURVEPOLYGON; break;
+        case WKBConstants::wkbMultiPoint: geomTypeId = GEOS_MULTIPOINT; break;
+        case WKBConstants::wkbMultiLineString: geomTypeId = GEOS_MULTILINESTRING; break;
+        case WKBConstants::wkbMultiPolygon: geomTypeId = GEOS_MULTIPOLYGON; break;
+        case WKBConstants::wkbMultiCurve: geomTypeId = GEOS_MULTICURVE; break;
+        case WKBConstants::wkbMultiSurface: geomTypeId = GEOS_MULTISURFACE; break;
+        default: geomTypeId = GEOS_GEOMETRYCOLLECTION; break;
+        }
+        uint32_t numGeoms = dis.readUnsigned();
+        for (uint32_t i = 0; i < numGeoms; i++) {
+            scanGeometry(dis, false);
+        }
+        break;
+    }
+    default:
+        throw ParseException("Unknown WKB type", static_cast<double>(geometryType));
+    }
+
+    if (isRoot) {
+        typeId = geomTypeId;
+        srid = geomSRID;
+        m_hasZ = hasZ;
+        m_hasM = hasM;
+    }
+}
+
+/*private*/
+void
+WKBView::scanCoordinates(ByteOrderDataInStream& dis, uint32_t n, unsigned int dim, bool isArc)
+{
+    if (dis.size() / (dim * sizeof(double)) < n) {
+        throw ParseException("Input buffer is smaller than requested object size");
+    }
+
+    // The envelope of a circular string covers its arcs, as in SimpleCurve.
+    // Consecutive arcs share an endpoint: (0, 1, 2), (2, 3, 4), ...
+    // An arc with a NaN point is skipped as a whole, keeping the window
+    // of three points aligned with the arcs that follow.
+    CoordinateXY p0, p1;
+    bool isNaN0 = false;
+    bool isNaN1 = false;
+
+    for (uint32_t i = 0; i < n; i++) {
+        double x = dis.readDouble();
+        double y = dis.readDouble();
+        for (unsigned int j = 2; j < dim; j++) {
+            dis.readDouble();
+        }
+
+        if (!(std::isnan(x) && std::isnan(y))) {
+            numPoints++;
+        }
+        bool isNaN2 = std::isnan(x) || std::isnan(y);
+
+        if (isArc) {
+            CoordinateXY p2(x, y);
+            if (i >= 2 && i % 2 == 0 && !(isNaN0 || isNaN1 || isNaN2)) {
+                algorithm::CircularArcs::expandEnvelope(env, p0, p1, p2);
+            }
+            p0 = p1;
+            p1 = p2;
+            isNaN0 = isNaN1;
+            isNaN1 = isNaN2;
+        }
+        else if (!isNaN2) {
+            env.expandToInclude(x, y);
+        }
+    }
+}
+
+std::unique_ptr<Geometry>
+WKBView::toGeometry(const GeometryFactory& factory) const
+{
+    WKBReader reader(factory);
+    return reader.read(buf, size);
+}
+
+bool
+WKBView::intersects(const prep::PreparedGeometry& pg) const
+{
+    const Geometry& g = pg.getGeometry();
+
+    // WKBReader would round the coordinates to a fixed precision model,
+    // moving them away from the envelope computed here
+    if (g.getFactory()->getPrecisionModel()->isFloating()) {
+        if (isEmpty() || !g.getEnvelopeInternal()->intersects(env)) {
+            return false;
+        }
+        if (typeId == GEOS_POINT) {
+            return pg.intersectsXY(env.getMinX(), env.getMinY());
+        }
+    }
+
+    auto geom = toGeometry(*g.getFactory());
+    return pg.intersects(geom.get());
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -37,6 +37,7 @@
 #include <ostream>
 #include <sstream>
 #include <cassert>
+#include <cstring>
 
 #include "geos/util.h"
 
@@ -55,6 +56,8 @@ WKBWriter::WKBWriter(uint8_t dims, int bo, bool srid, int flv)
     , flavor(flv)
     , includeSRID(srid)
     , outStream(nullptr)
+    , outBuffer(nullptr)
+    , outSize(0)
 {
     if(dims < 2 || dims > 4) {
         throw util::IllegalArgumentException("WKB output dimension must be 2, 3, or 4");
@@ -100,14 +103,53 @@ WKBWriter::writeHEX(const Geometry& g, std::ostream& os)
 
 void
 WKBWriter::write(const Geometry& g, std::ostream& os)
+{
+    outStream = &os;
+    outBuffer = nullptr;
+    outSize = 0;
+    writeGeometry(g);
+    outStream = nullptr;
+}
+
+std::size_t
+WKBWriter::getWkbSize(const Geometry& g)
+{
+    outStream = nullptr;
+    outBuffer = nullptr;
+    outSize = 0;
+    writeGeometry(g);
+    return outSize;
+}
+
+std::size_t
+WKBWriter::write(const Geometry& g, unsigned char* p_buf)
+{
+    outStream = nullptr;
+    outBuffer = p_buf;
+    outSize = 0;
+    writeGeometry(g);
+    outBuffer = nullptr;
+    return outSize;
+}
+
+void
+WKBWriter::write(const Geometry& g, std::vector<unsigned char>& p_buf)
+{
+    std::size_t size = getWkbSize(g);
+    std::size_t offset = p_buf.size();
+    p_buf.resize(offset + size);
+    write(g, p_buf.data() + offset);
+}
+
+/*private*/
+void
+WKBWriter::writeGeometry(const Geometry& g)
 {
     OrdinateSet inputOrdinates = OrdinateSet::createXY();
     inputOrdinates.setM(g.hasM());
     inputOrdinates.setZ(g.hasZ());
     outputOrdinates = getOutputOrdinates(inputOrdinates);
 
-    outStream = &os;
-
     switch(g.getGeometryTypeId()) {
         case GEOS_POINT: writePoint(static_cast<const Point&>(g)); break;
         case GEOS_LINESTRING:
@@ -125,6 +167,19 @@ WKBWriter::write(const Geometry& g, std::ostream& os)
     }
 }
 
+/*private*/
+void
+WKBWriter::writeBytes(const unsigned char* bytes, std::size_t n)
+{
+    if (outStream) {
+        outStream->write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(n));
+    }
+    else if (outBuffer) {
+        std::memcpy(outBuffer + outSize, bytes, n);
+    }
+    outSize += n;
+}
+
 void
 WKBWriter::writePointEmpty(const Point& g)
 {
@@ -247,11 +302,11 @@ WKBWriter::writeCurvePolygon(const CurvePolygon& g)
     writeInt(static_cast<int>(nholes + 1));
 
     const Curve* ring = g.getExteriorRing();
-    write(*ring, *outStream);
+    writeGeometry(*ring);
 
     for(std::size_t i = 0; i < nholes; i++) {
         ring = g.getInteriorRingN(i);
-        write(*ring, *outStream);
+        writeGeometry(*ring);
     }
 }
 
@@ -268,12 +323,11 @@ WKBWriter::writeGeometryCollection(const GeometryCollection& g)
     auto orig_includeSRID = includeSRID;
     includeSRID = false;
 
-    assert(outStream);
     for(std::size_t i = 0; i < ngeoms; i++) {
         const Geometry* elem = g.getGeometryN(i);
         assert(elem);
 
-        write(*elem, *outStream);
+        writeGeometry(*elem);
     }
     includeSRID = orig_includeSRID;
 }
@@ -288,8 +342,7 @@ WKBWriter::writeByteOrder()
         buf[0] = WKBConstants::wkbXDR;
     }
 
-    assert(outStream);
-    outStream->write(reinterpret_cast<char*>(buf), 1);
+    writeBytes(buf, 1);
 }
 
 /* public */
@@ -358,8 +411,7 @@ void
 WKBWriter::writeInt(int val)
 {
     ByteOrderValues::putInt(val, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 4);
-    //outStream->write(reinterpret_cast<char *>(&val), 4);
+    writeBytes(buf, 4);
 }
 
 void
@@ -371,6 +423,36 @@ WKBWriter::writeCoordinateSequence(const CoordinateSequence& cs,
     if(sized) {
         writeInt(static_cast<int>(size));
     }
+
+    const auto outputDim = static_cast<std::size_t>(outputOrdinates.size());
+    if (outStream == nullptr && outBuffer == nullptr) {
+        outSize += size * outputDim * sizeof(double);
+        return;
+    }
+
+    // Copy the stored values directly if the byte order matches and the
+    // output ordinates are a prefix of the stored ones
+    bool isStoredPrefix = false;
+    switch(cs.getCoordinateType()) {
+        case CoordinateType::XY: isStoredPrefix = !outputOrdinates.hasZ() && !outputOrdinates.hasM(); break;
+        case CoordinateType::XYZ: isStoredPrefix = !outputOrdinates.hasM(); break;
+        case CoordinateType::XYM: isStoredPrefix = !outputOrdinates.hasZ(); break;
+        case CoordinateType::XYZM: isStoredPrefix = !outputOrdinates.hasM() || outputOrdinates.hasZ(); break;
+    }
+    if (isStoredPrefix && byteOrder == getMachineByteOrder()) {
+        const double* data = cs.data();
+        const std::size_t stride = cs.stride();
+        if (stride == outputDim) {
+            writeBytes(reinterpret_cast<const unsigned char*>(data), size * outputDim * sizeof(double));
+        }
+        else {
+            for(std::size_t i = 0; i < size; i++) {
+                writeBytes(reinterpret_cast<const unsigned char*>(data + i * stride), outputDim * sizeof(double));
+            }
+        }
+        return;
+    }
+
     for(std::size_t i = 0; i < size; i++) {
         writeCoordinate(cs, i);
     }
@@ -382,22 +464,20 @@ WKBWriter::writeCoordinate(const CoordinateSequence& cs, std::size_t idx)
 #if DEBUG_WKB_WRITER
     std::size_t << "writeCoordinate: X:" << cs.getX(idx) << " Y:" << cs.getY(idx) << std::endl;
 #endif
-    assert(outStream);
-
     CoordinateXYZM coord(DoubleNotANumber, DoubleNotANumber, DoubleNotANumber, DoubleNotANumber);
     cs.getAt(idx, coord);
 
     ByteOrderValues::putDouble(coord.x, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 8);
+    writeBytes(buf, 8);
     ByteOrderValues::putDouble(coord.y, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 8);
+    writeBytes(buf, 8);
     if(outputOrdinates.hasZ()) {
         ByteOrderValues::putDouble(coord.z, buf, byteOrder);
-        outStream->write(reinterpret_cast<char*>(buf), 8);
+        writeBytes(buf, 8);
     }
     if(outputOrdinates.hasM()) {
         ByteOrderValues::putDouble(coord.m, buf, byteOrder);
-        outStream->write(reinterpret_cast<char*>(buf), 8);
+        writeBytes(buf, 8);
     }
 }
 
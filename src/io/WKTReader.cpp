@@ -53,6 +53,12 @@ std::unique_ptr<Geometry>
 WKTReader::read(const std::string& wellKnownText) const
 {
     CLocalizer clocale;
+    return readWithoutLocale(wellKnownText);
+}
+
+std::unique_ptr<Geometry>
+WKTReader::readWithoutLocale(const std::string& wellKnownText) const
+{
     StringTokenizer tokenizer(wellKnownText);
     OrdinateSet ordinateFlags = OrdinateSet::createXY();
     auto ret = readGeometryTaggedText(&tokenizer, ordinateFlags);
@@ -77,14 +83,15 @@ WKTReader::getCoordinates(StringTokenizer* tokenizer, OrdinateSet& ordinateFlags
     getPreciseCoordinate(tokenizer, ordinateFlags, coord);
 
     auto coordinates = detail::make_unique<CoordinateSequence>(0u, ordinateFlags.hasZ(), ordinateFlags.hasM());
+    coordinates->reserve(1 + tokenizer->countCommasBeforeCloser());
     coordinates->add(coord);
 
-    nextToken = getNextCloserOrComma(tokenizer);
-    while(nextToken == ",") {
+    while(tokenizer->peekNextToken() == ',') {
+        tokenizer->nextToken();
         getPreciseCoordinate(tokenizer, ordinateFlags, coord);
         coordinates->add(coord);
-        nextToken = getNextCloserOrComma(tokenizer);
     }
+    getNextCloserOrComma(tokenizer);
 
     return coordinates;
 }
@@ -20,7 +20,9 @@
 #include <memory> // for unique_ptr
 #include <algorithm>
 
+#include <geos/io/CLocalizer.h>
 #include <geos/io/WKTStreamReader.h>
+#include <geos/util/IllegalStateException.h>
 
 using namespace geos::geom;
 
@@ -29,6 +31,7 @@ namespace io {
 
 WKTStreamReader::WKTStreamReader(std::istream& p_instr)
     : instr(p_instr)
+    , numThreads(1)
 {
 }
 
@@ -37,7 +40,15 @@ WKTStreamReader::~WKTStreamReader() {
 }
 
 /*public*/
-
+void
+WKTStreamReader::setNumThreads(std::size_t n)
+{
+    // Records read ahead by the decoder would be lost
+    if (decoder != nullptr) {
+        throw util::IllegalStateException("WKTStreamReader: cannot change the number of threads while decoding");
+    }
+    numThreads = n;
+}
 
 /*
 Return: nullptr if at EOF
@@ -45,15 +56,50 @@ Return: nullptr if at EOF
 std::unique_ptr<Geometry>
 WKTStreamReader::next()
 {
-    std::string wkt = "";
+    if (numThreads != 1) {
+        if (decoder == nullptr) {
+            /**
+            * setlocale is process-wide, so the decoding threads cannot
+            * each switch to the "C" locale as WKTReader::read does.
+            * The locale is switched once per batch instead, while the
+            * batch is decoded within next().
+            */
+            decoder.reset(new ParallelStreamDecoder(
+                [this](std::string& wkt) { return readRecord(wkt); },
+                [](const std::string& wkt) {
+                    WKTReader reader;
+                    return reader.readWithoutLocale(wkt);
+                },
+                numThreads,
+                [](const std::function<void()>& decodeBatch) {
+                    CLocalizer clocale;
+                    decodeBatch();
+                }));
+        }
+        return decoder->next();
+    }
+
+    std::string wkt;
+    if (! readRecord(wkt)) {
+        return nullptr;
+    }
+    auto g = rdr.read( wkt.c_str() );
+    return g;
+}
+
+/*private*/
+bool
+WKTStreamReader::readRecord(std::string& wkt)
+{
+    wkt.clear();
 
     std::string::difference_type lParen = 0;
     std::string::difference_type rParen = 0;
+    std::string line;
     do {
-        std::string line;
         std::getline(instr, line);
         if (! instr) {
-            return nullptr;
+            return false;
         }
 
         lParen += std::count(line.begin(), line.end(), '(');
@@ -62,10 +108,8 @@ WKTStreamReader::next()
         wkt += line;
     } while (lParen == 0 || lParen != rParen);
 
-    auto g = rdr.read( wkt.c_str() );
-    return g;
+    return true;
 }
 
-
 }
 }
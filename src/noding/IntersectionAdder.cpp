@@ -30,8 +30,9 @@ namespace noding { // geos.noding
 
 /*private*/
 bool
-IntersectionAdder::isTrivialIntersection(const SegmentString* e0,
-        std::size_t segIndex0, const SegmentString* e1, std::size_t segIndex1)
+IntersectionAdder::isTrivialIntersection(const algorithm::LineIntersector& li,
+        const SegmentString* e0, std::size_t segIndex0,
+        const SegmentString* e1, std::size_t segIndex1)
 {
     if(e0 != e1) {
         return false;
@@ -93,7 +94,7 @@ IntersectionAdder::processIntersections(
     // one trivial intersection,
     // the shared endpoint.  Don't bother adding it if it
     // is the only intersection.
-    if(! isTrivialIntersection(e0, segIndex0, e1, segIndex1)) {
+    if(! isTrivialIntersection(li, e0, segIndex0, e1, segIndex1)) {
         hasIntersectionVar = true;
 
         NodedSegmentString* ee0 = detail::down_cast<NodedSegmentString*>(e0);
@@ -112,5 +113,78 @@ IntersectionAdder::processIntersections(
     }
 }
 
+/*public*/
+void
+IntersectionAdder::computeIntersections(
+    SegmentString* e0,  std::size_t segIndex0,
+    SegmentString* e1,  std::size_t segIndex1,
+    algorithm::LineIntersector& batchLi, Batch& batch) const
+{
+    if(e0 == e1 && segIndex0 == segIndex1) {
+        return;
+    }
+
+    batch.numTests++;
+
+    const CoordinateSequence& seq0 = *e0->getCoordinates();
+    const CoordinateSequence& seq1 = *e1->getCoordinates();
+
+    batchLi.computeIntersection(seq0, segIndex0, seq1, segIndex1);
+
+    if(! batchLi.hasIntersection()) {
+        return;
+    }
+
+    batch.numIntersections++;
+
+    if(batchLi.isInteriorIntersection()) {
+        batch.numInteriorIntersections++;
+        batch.hasInterior = true;
+    }
+
+    if(! isTrivialIntersection(batchLi, e0, segIndex0, e1, segIndex1)) {
+        batch.hasIntersection = true;
+
+        // same order as NodedSegmentString::addIntersections
+        NodedSegmentString* ee0 = detail::down_cast<NodedSegmentString*>(e0);
+        NodedSegmentString* ee1 = detail::down_cast<NodedSegmentString*>(e1);
+        const std::size_t n = batchLi.getIntersectionNum();
+        for(std::size_t i = 0; i < n; i++) {
+            batch.nodes.push_back({ ee0, batchLi.getIntersection(i), segIndex0 });
+        }
+        for(std::size_t i = 0; i < n; i++) {
+            batch.nodes.push_back({ ee1, batchLi.getIntersection(i), segIndex1 });
+        }
+
+        if(batchLi.isProper()) {
+            batch.numProperIntersections++;
+            batch.properIntersectionPoint = batchLi.getIntersection(0);
+            batch.hasProper = true;
+        }
+    }
+}
+
+/*public*/
+void
+IntersectionAdder::addBatch(const Batch& batch)
+{
+    for(const auto& node : batch.nodes) {
+        node.segString->addIntersection(node.pt, node.segIndex);
+    }
+
+    numTests += batch.numTests;
+    numIntersections += batch.numIntersections;
+    numInteriorIntersections += batch.numInteriorIntersections;
+    numProperIntersections += batch.numProperIntersections;
+
+    hasIntersectionVar |= batch.hasIntersection;
+    hasInterior |= batch.hasInterior;
+    if(batch.hasProper) {
+        properIntersectionPoint = batch.properIntersectionPoint;
+        hasProper = true;
+        hasProperInterior = true;
+    }
+}
+
 } // namespace geos.noding
 } // namespace geos
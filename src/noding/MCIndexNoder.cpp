@@ -18,11 +18,15 @@
 
 #include <geos/noding/MCIndexNoder.h>
 #include <geos/noding/SegmentIntersector.h>
+#include <geos/noding/IntersectionAdder.h>
 #include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/snapround/SnapRoundingIntersectionAdder.h>
+#include <geos/algorithm/LineIntersector.h>
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/chain/MonotoneChainBuilder.h>
 #include <geos/geom/Envelope.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/Parallel.h>
 
 #include <cassert>
 #include <functional>
@@ -34,10 +38,48 @@
 
 using geos::index::chain::MonotoneChain;
 using geos::index::chain::MonotoneChainBuilder;
+using geos::index::chain::MonotoneChainOverlapAction;
 
 namespace geos {
 namespace noding { // geos.noding
 
+namespace {
+
+// Number of monotone chains whose overlaps are found per work item
+const std::size_t CHAINS_PER_BLOCK = 64;
+
+SegmentString*
+segmentString(const MonotoneChain& mc)
+{
+    return const_cast<SegmentString*>(static_cast<const SegmentString*>(mc.getContext()));
+}
+
+// Intersects the pairs of segments of overlapping chains into a batch
+template<typename Adder>
+class BatchIntersectionAction : public MonotoneChainOverlapAction {
+public:
+    BatchIntersectionAction(const Adder& p_adder, algorithm::LineIntersector& p_li,
+                            typename Adder::Batch& p_batch)
+        : adder(p_adder)
+        , li(p_li)
+        , batch(p_batch)
+    {}
+
+    void
+    overlap(const MonotoneChain& mc1, std::size_t start1,
+            const MonotoneChain& mc2, std::size_t start2) override
+    {
+        adder.computeIntersections(segmentString(mc1), start1, segmentString(mc2), start2, li, batch);
+    }
+
+private:
+    const Adder& adder;
+    algorithm::LineIntersector& li;
+    typename Adder::Batch& batch;
+};
+
+} // anonymous namespace
+
 /*public*/
 void
 MCIndexNoder::computeNodes(SegmentString::NonConstVect* inputSegStrings)
@@ -56,6 +98,18 @@ MCIndexNoder::computeNodes(SegmentString::NonConstVect* inputSegStrings)
         indexBuilt = true;
     }
 
+    // Only the intersectors which can compute batches of intersections
+    // concurrently are run on several threads
+    if (util::resolveThreadCount(numThreads) > 1) {
+        if (IntersectionAdder* adder = dynamic_cast<IntersectionAdder*>(segInt)) {
+            intersectChainsParallel(*adder);
+            return;
+        }
+        if (auto* srAdder = dynamic_cast<snapround::SnapRoundingIntersectionAdder*>(segInt)) {
+            intersectChainsParallel(*srAdder);
+            return;
+        }
+    }
     intersectChains();
 }
 
@@ -77,6 +131,51 @@ MCIndexNoder::intersectChains()
     });
 }
 
+/*private*/
+template<typename Adder>
+void
+MCIndexNoder::intersectChainsParallel(Adder& adder)
+{
+    // Blocks of chains are queried in parallel, in rounds of a few blocks
+    // per thread. The batches of a round are then added in block order,
+    // which is the order of a serial query, and interruption is checked
+    // on the calling thread before the next round.
+    index.build();
+    const std::size_t numChains = index.size();
+    const std::size_t numBlocks = (numChains + CHAINS_PER_BLOCK - 1) / CHAINS_PER_BLOCK;
+    const std::size_t blocksPerRound = 4 * util::resolveThreadCount(numThreads);
+
+    std::vector<typename Adder::Batch> batches;
+    std::vector<std::size_t> overlapCounts;
+    for (std::size_t firstBlock = 0; firstBlock < numBlocks; firstBlock += blocksPerRound) {
+        GEOS_CHECK_FOR_INTERRUPTS();
+
+        const std::size_t roundBlocks = std::min(blocksPerRound, numBlocks - firstBlock);
+        batches.assign(roundBlocks, typename Adder::Batch());
+        overlapCounts.assign(roundBlocks, 0);
+
+        util::parallelFor(roundBlocks, numThreads, 1, [&](std::size_t first, std::size_t last) {
+            algorithm::LineIntersector li(adder.getLineIntersector());
+            for (std::size_t i = first; i < last; i++) {
+                const std::size_t begin = (firstBlock + i) * CHAINS_PER_BLOCK;
+                const std::size_t end = std::min(begin + CHAINS_PER_BLOCK, numChains);
+
+                BatchIntersectionAction<Adder> action(adder, li, batches[i]);
+                std::size_t& count = overlapCounts[i];
+                index.queryPairs(begin, end, [this, &action, &count](const MonotoneChain* queryChain, const MonotoneChain* testChain) {
+                    queryChain->computeOverlaps(testChain, overlapTolerance, &action);
+                    count++;
+                });
+            }
+        });
+
+        for (std::size_t i = 0; i < roundBlocks; i++) {
+            adder.addBatch(batches[i]);
+            nOverlaps += static_cast<int>(overlapCounts[i]);
+        }
+    }
+}
+
 /*private*/
 void
 MCIndexNoder::add(SegmentString* segStr)
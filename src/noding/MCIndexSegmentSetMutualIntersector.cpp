@@ -44,7 +44,7 @@ MCIndexSegmentSetMutualIntersector::addToIndex(SegmentString* segStr)
 
 /*private*/
 void
-MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
+MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr, MonoChains& chains) const
 {
     if (segStr->size() == 0)
         return;
@@ -53,26 +53,45 @@ MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
                                     segStr, segChains);
     for (auto& mc : segChains) {
         if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
-            monoChains.push_back(mc);
+            chains.push_back(mc);
         }
     }
 }
 
 
 /*private*/
-void
-MCIndexSegmentSetMutualIntersector::intersectChains()
+int
+MCIndexSegmentSetMutualIntersector::intersectChains(MonoChains& chains, SegmentIntersector& si)
 {
-    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(*segInt);
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(si);
+    int overlaps = 0;
 
-    for(auto& queryChain : monoChains) {
-        index.query(queryChain.getEnvelope(overlapTolerance), [&queryChain, &overlapAction, this](const MonotoneChain* testChain) -> bool {
+    for(auto& queryChain : chains) {
+        index.query(queryChain.getEnvelope(overlapTolerance), [&queryChain, &overlapAction, &overlaps, &si, this](const MonotoneChain* testChain) -> bool {
             queryChain.computeOverlaps(testChain, overlapTolerance, &overlapAction);
-            nOverlaps++;
+            overlaps++;
 
-            return !segInt->isDone(); // abort early if segInt->isDone()
+            return !si.isDone(); // abort early if si.isDone()
         });
     }
+    return overlaps;
+}
+
+
+/*private*/
+void
+MCIndexSegmentSetMutualIntersector::buildIndex()
+{
+    // Only the first caller builds the index; concurrent callers
+    // wait for it to be complete.
+    std::call_once(indexBuilt, [this]() {
+        for (auto& mc: indexChains) {
+            if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
+                index.insert(&(mc.getEnvelope(overlapTolerance)), &mc);
+            }
+        }
+        index.build();
+    });
 }
 
 
@@ -94,25 +113,31 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
 void
 MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
 {
-    if (!indexBuilt) {
-        for (auto& mc: indexChains) {
-            if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
-                index.insert(&(mc.getEnvelope(overlapTolerance)), &mc);
-            }
-        }
-        indexBuilt = true;
-    }
+    buildIndex();
 
     // Reset counters for new inputs
     monoChains.clear();
     processCounter = indexCounter + 1;
-    nOverlaps = 0;
 
     for(const SegmentString* css: *segStrings) {
         SegmentString* ss = const_cast<SegmentString*>(css);
-        addToMonoChains(ss);
+        addToMonoChains(ss, monoChains);
+    }
+    nOverlaps = intersectChains(monoChains, *segInt);
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings, SegmentIntersector& si)
+{
+    buildIndex();
+
+    MonoChains chains;
+    for(const SegmentString* css: *segStrings) {
+        SegmentString* ss = const_cast<SegmentString*>(css);
+        addToMonoChains(ss, chains);
     }
-    intersectChains();
+    intersectChains(chains, si);
 }
 
 
@@ -153,7 +153,7 @@ HotPixelIndex::find(const geom::Coordinate& pixelPt)
 
 /*public*/
 void
-HotPixelIndex::query(const CoordinateXY& p0, const CoordinateXY& p1, index::kdtree::KdNodeVisitor& visitor)
+HotPixelIndex::query(const CoordinateXY& p0, const CoordinateXY& p1, index::kdtree::KdNodeVisitor& visitor) const
 {
     Envelope queryEnv(p0, p1);
     queryEnv.expandBy(1.0 / scaleFactor);
@@ -76,6 +76,63 @@ SnapRoundingIntersectionAdder::processIntersections(
     processNearVertex(seq1, segIndex1 + 1, seq0, segIndex0, e0);
 }
 
+/*public*/
+void
+SnapRoundingIntersectionAdder::computeIntersections(
+    SegmentString* e0, std::size_t segIndex0,
+    SegmentString* e1, std::size_t segIndex1,
+    LineIntersector& batchLi, Batch& batch) const
+{
+    if (e0 == e1 && segIndex0 == segIndex1) return;
+
+    const CoordinateSequence& seq0 = *e0->getCoordinates();
+    const CoordinateSequence& seq1 = *e1->getCoordinates();
+
+    batchLi.computeIntersection(seq0, segIndex0, seq1, segIndex1);
+
+    if (batchLi.hasIntersection() && batchLi.isInteriorIntersection()) {
+        // same order as processIntersections
+        const std::size_t intNum = batchLi.getIntersectionNum();
+        for (std::size_t intIndex = 0; intIndex < intNum; intIndex++) {
+            batch.intersections.add(batchLi.getIntersection(intIndex));
+        }
+        for (std::size_t intIndex = 0; intIndex < intNum; intIndex++) {
+            batch.nodes.push_back({ static_cast<NodedSegmentString*>(e0), batchLi.getIntersection(intIndex), segIndex0 });
+        }
+        for (std::size_t intIndex = 0; intIndex < intNum; intIndex++) {
+            batch.nodes.push_back({ static_cast<NodedSegmentString*>(e1), batchLi.getIntersection(intIndex), segIndex1 });
+        }
+        return;
+    }
+
+    auto nearVertex = [this, &batch](const CoordinateSequence& ptSeq, std::size_t ptIndex,
+                                     const CoordinateSequence& segSeq, std::size_t segIndex,
+                                     SegmentString* edge) {
+        if (isNearSegmentInterior(ptSeq.getAt<CoordinateXY>(ptIndex),
+                                  segSeq.getAt<CoordinateXY>(segIndex),
+                                  segSeq.getAt<CoordinateXY>(segIndex + 1))) {
+            batch.intersections.add(ptSeq, ptIndex, ptIndex);
+            batch.nodes.push_back({ static_cast<NodedSegmentString*>(edge), batch.intersections.back<CoordinateXYZM>(), segIndex });
+        }
+    };
+    nearVertex(seq0, segIndex0, seq1, segIndex1, e1);
+    nearVertex(seq0, segIndex0 + 1, seq1, segIndex1, e1);
+    nearVertex(seq1, segIndex1, seq0, segIndex0, e0);
+    nearVertex(seq1, segIndex1 + 1, seq0, segIndex0, e0);
+}
+
+/*public*/
+void
+SnapRoundingIntersectionAdder::addBatch(const Batch& batch)
+{
+    if (!batch.intersections.isEmpty()) {
+        intersections.add(batch.intersections);
+    }
+    for (const auto& node : batch.nodes) {
+        node.segString->addIntersection(node.pt, node.segIndex);
+    }
+}
+
 bool
 SnapRoundingIntersectionAdder::isNearSegmentInterior(
     const geom::CoordinateXY& p, const geom::CoordinateXY& p0, const geom::CoordinateXY& p1) const
@@ -23,6 +23,8 @@
 #include <geos/noding/NodedSegmentString.h>
 #include <geos/noding/snapround/SnapRoundingNoder.h>
 #include <geos/noding/snapround/SnapRoundingIntersectionAdder.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/Parallel.h>
 
 #include <algorithm> // for std::min and std::max
 #include <memory>
@@ -34,6 +36,12 @@ namespace geos {
 namespace noding { // geos.noding
 namespace snapround { // geos.noding.snapround
 
+namespace {
+
+// Number of segment strings snapped per work item
+const std::size_t SEGSTRINGS_PER_BLOCK = 16;
+
+} // anonymous namespace
 
 /*public*/
 std::vector<SegmentString*>*
@@ -80,6 +88,7 @@ SnapRoundingNoder::addIntersectionPixels(std::vector<SegmentString*>& segStrings
     double tolerance = 1.0 / pm->getScale() / INTERSECTION_NEARNESS_FACTOR;
     SnapRoundingIntersectionAdder intAdder(tolerance);
     MCIndexNoder noder(&intAdder, tolerance);
+    noder.setNumThreads(numThreads);
     noder.computeNodes(&segStrings);
     const auto& intPts = intAdder.getIntersections();
     pixelIndex.addNodes(&intPts);
@@ -112,6 +121,10 @@ SnapRoundingNoder::round(const CoordinateSequence& pts) const
 void
 SnapRoundingNoder::computeSnaps(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped)
 {
+    if (util::resolveThreadCount(numThreads) > 1) {
+        computeSnapsParallel(segStrings, snapped);
+        return;
+    }
     for (SegmentString* ss: segStrings) {
         NodedSegmentString* snappedSS = computeSegmentSnaps(detail::down_cast<NodedSegmentString*>(ss));
         if (snappedSS != nullptr) {
@@ -129,17 +142,81 @@ SnapRoundingNoder::computeSnaps(const std::vector<SegmentString*>& segStrings, s
     return;
 }
 
+/*private*/
+void
+SnapRoundingNoder::computeSnapsParallel(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped)
+{
+    const std::size_t n = segStrings.size();
+    std::vector<std::unique_ptr<NodedSegmentString>> snappedSS(n);
+    std::vector<std::vector<PixelHit>> hits(n);
+
+    /**
+    * Round the segment strings and find the hot pixels their segments
+    * intersect. The hot pixel index is only read.
+    */
+    util::parallelFor(n, numThreads, SEGSTRINGS_PER_BLOCK, [this, &segStrings, &snappedSS, &hits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            snappedSS[i].reset(computeSegmentSnaps(detail::down_cast<NodedSegmentString*>(segStrings[i]), &hits[i]));
+        }
+    });
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    /**
+    * Whether a hit adds a node depends on the hot pixels marked as nodes
+    * by the segments snapped before it, so decide in input order.
+    * Only the hits which add a node are kept.
+    */
+    for (auto& ssHits : hits) {
+        std::size_t numKept = 0;
+        for (const PixelHit& hit : ssHits) {
+            if (! hit.hp->isNode() && hit.hasVertex) {
+                continue;
+            }
+            hit.hp->setToNode();
+            ssHits[numKept++] = hit;
+        }
+        ssHits.resize(numKept);
+    }
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    /**
+    * Add the nodes; each segment string is only modified by one thread,
+    * and the hot pixels are only read.
+    */
+    util::parallelFor(n, numThreads, SEGSTRINGS_PER_BLOCK, [this, &snappedSS, &hits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            NodedSegmentString* nss = snappedSS[i].get();
+            if (nss == nullptr) {
+                continue;
+            }
+            for (const PixelHit& hit : hits[i]) {
+                nss->addIntersection(hit.hp->getCoordinate(), hit.segIndex);
+            }
+            addVertexNodeSnaps(nss);
+        }
+    });
+
+    for (auto& nss : snappedSS) {
+        if (nss != nullptr) {
+            snapped.push_back(nss.release());
+        }
+    }
+}
+
 /**
 * Add snapped vertices to a segment string.
 * If the segment string collapses completely due to rounding,
 * null is returned.
 *
 * @param ss the segment string to snap
+* @param hits if not null, records the hot pixels intersecting the segments instead of snapping to them
 * @return the snapped segment string, or null if it collapses completely
 */
 /*private*/
 NodedSegmentString*
-SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss)
+SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss, std::vector<PixelHit>* hits)
 {
     /**
     * Get edge coordinates, including added intersection nodes.
@@ -177,7 +254,12 @@ SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss)
         * (It is important to check original segment because rounding can
         * move it enough to intersect other hot pixels not intersecting original segment)
         */
-        snapSegment(p0, p1, snapSS, snapSSindex);
+        if (hits != nullptr) {
+            findSegmentHits(p0, p1, snapSSindex, *hits);
+        }
+        else {
+            snapSegment(p0, p1, snapSS, snapSSindex);
+        }
         snapSSindex++;
     }
     return snapSS;
@@ -239,7 +321,38 @@ SnapRoundingNoder::snapSegment(const CoordinateXY& p0, const CoordinateXY& p1, N
 
 /*private*/
 void
-SnapRoundingNoder::addVertexNodeSnaps(NodedSegmentString* ss)
+SnapRoundingNoder::findSegmentHits(const CoordinateXY& p0, const CoordinateXY& p1, std::size_t segIndex,
+                                   std::vector<PixelHit>& hits) const
+{
+    struct SegmentHitVisitor : KdNodeVisitor {
+        const CoordinateXY& p0;
+        const CoordinateXY& p1;
+        std::size_t segIndex;
+        std::vector<PixelHit>& hits;
+
+        SegmentHitVisitor(const CoordinateXY& pp0, const CoordinateXY& pp1, std::size_t psegIndex, std::vector<PixelHit>& phits)
+            : p0(pp0), p1(pp1), segIndex(psegIndex), hits(phits) {};
+
+        void visit(KdNode* node) override {
+            HotPixel* hp = static_cast<HotPixel*>(node->getData());
+            /**
+            * The tests of snapSegment() which depend on whether the
+            * hot pixel is a node are made once all segments are visited.
+            */
+            if (hp->intersects(p0, p1)) {
+                bool hasVertex = hp->intersects(p0) || hp->intersects(p1);
+                hits.push_back({ hp, segIndex, hasVertex });
+            }
+        }
+    };
+
+    SegmentHitVisitor shv(p0, p1, segIndex, hits);
+    pixelIndex.query(p0, p1, shv);
+}
+
+/*private*/
+void
+SnapRoundingNoder::addVertexNodeSnaps(NodedSegmentString* ss) const
 {
     const CoordinateSequence* pts = ss->getCoordinates();
     std::size_t i = 0;
@@ -252,7 +365,7 @@ SnapRoundingNoder::addVertexNodeSnaps(NodedSegmentString* ss)
 }
 
 void
-SnapRoundingNoder::snapVertexNode(const CoordinateXY& p0, NodedSegmentString* ss, std::size_t segIndex)
+SnapRoundingNoder::snapVertexNode(const CoordinateXY& p0, NodedSegmentString* ss, std::size_t segIndex) const
 {
 
     /* First define a visitor to use in the pixelIndex.query() */
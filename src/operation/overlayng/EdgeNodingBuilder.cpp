@@ -266,11 +266,11 @@ EdgeNodingBuilder::createEdgeSourceInfo(uint8_t index, int depthDelta, bool isHo
 void
 EdgeNodingBuilder::addEdge(std::unique_ptr<CoordinateSequence>& cas, const EdgeSourceInfo* info)
 {
-    // TODO: manage these internally to EdgeNodingBuilder in a std::deque,
-    // since they do not have a life span longer than the EdgeNodingBuilder
+    // Concentrate small memory allocations via std::deque, since the
+    // input edges do not have a life span longer than the EdgeNodingBuilder
     // in OverlayNG::buildGraph()
-    NodedSegmentString* ss = new NodedSegmentString(cas.release(), inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
-    inputEdges->push_back(ss);
+    inputEdgeQue.emplace_back(cas.release(), inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
+    inputEdges->push_back(&(inputEdgeQue.back()));
 }
 
 /*private*/
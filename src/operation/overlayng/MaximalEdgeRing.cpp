@@ -106,15 +106,17 @@ MaximalEdgeRing::attachEdges(OverlayEdge* p_startEdge)
 }
 
 /*public*/
-std::vector<std::unique_ptr<OverlayEdgeRing>>
-MaximalEdgeRing::buildMinimalRings(const GeometryFactory* geometryFactory)
+std::vector<OverlayEdgeRing*>
+MaximalEdgeRing::buildMinimalRings(const GeometryFactory* geometryFactory,
+    std::deque<OverlayEdgeRing>& ringStore)
 {
     linkMinimalRings();
-    std::vector<std::unique_ptr<OverlayEdgeRing>> outOERs;
+    std::vector<OverlayEdgeRing*> outOERs;
     OverlayEdge* e = startEdge;
     do {
         if (e->getEdgeRing() == nullptr) {
-            outOERs.emplace_back(new OverlayEdgeRing(e, geometryFactory));
+            ringStore.emplace_back(e, geometryFactory);
+            outOERs.push_back(&(ringStore.back()));
         }
         e = e->nextResultMax();
     }
@@ -0,0 +1,138 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/OverlayNGPrepared.h>
+
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayUtil.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+
+#include <vector>
+
+using namespace geos::geom;
+using geos::geom::prep::PreparedGeometry;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+namespace {
+
+bool
+isPolygonOrMultiPolygon(const Geometry& geom)
+{
+    auto typeId = geom.getGeometryTypeId();
+    return typeId == GEOS_POLYGON || typeId == GEOS_MULTIPOLYGON;
+}
+
+void
+addElements(std::unique_ptr<Geometry> geom, std::vector<std::unique_ptr<Geometry>>& elements)
+{
+    if (geom->isEmpty()) {
+        return;
+    }
+    if (geom->isCollection()) {
+        for (auto& element : static_cast<GeometryCollection*>(geom.get())->releaseGeometries()) {
+            elements.push_back(std::move(element));
+        }
+    }
+    else {
+        elements.push_back(std::move(geom));
+    }
+}
+
+} // anonymous namespace
+
+/*public*/
+OverlayNGPrepared::OverlayNGPrepared(const PreparedGeometry& p_mask, const PrecisionModel* p_pm)
+    : mask(p_mask)
+    , pm(p_pm)
+    , isMaskPolygonal(isPolygonOrMultiPolygon(p_mask.getGeometry()))
+{}
+
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGPrepared::overlay(const Geometry* geom, const PreparedGeometry& mask, int opCode, const PrecisionModel* pm)
+{
+    OverlayNGPrepared ov(mask, pm);
+    return ov.overlay(geom, opCode);
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayNGPrepared::overlay(const Geometry* geom, int opCode) const
+{
+    const Geometry* maskGeom = &mask.getGeometry();
+    const PrecisionModel* overlayPM = pm ? pm : geom->getFactory()->getPrecisionModel();
+
+    bool isShortCircuit = (opCode == OverlayNG::INTERSECTION || opCode == OverlayNG::DIFFERENCE)
+                          && isMaskPolygonal
+                          && isPolygonOrMultiPolygon(*geom)
+                          && !geom->isEmpty()
+                          && OverlayUtil::isFloating(overlayPM);
+    if (!isShortCircuit) {
+        return OverlayNG::overlay(geom, maskGeom, opCode, overlayPM);
+    }
+
+    /**
+    * Polygons disjoint from the mask or covered by it are in the result
+    * unchanged, or not at all. The other ones must be overlaid.
+    */
+    bool isIntersection = opCode == OverlayNG::INTERSECTION;
+    std::vector<std::unique_ptr<Geometry>> elements;
+    std::vector<const Geometry*> interacting;
+    for (std::size_t i = 0; i < geom->getNumGeometries(); i++) {
+        const Geometry* poly = geom->getGeometryN(i);
+        if (poly->isEmpty()) {
+            continue;
+        }
+        if (!mask.intersects(poly)) {
+            if (!isIntersection) {
+                elements.push_back(poly->clone());
+            }
+        }
+        else if (mask.covers(poly)) {
+            if (isIntersection) {
+                elements.push_back(poly->clone());
+            }
+        }
+        else {
+            interacting.push_back(poly);
+        }
+    }
+
+    const GeometryFactory* factory = geom->getFactory();
+    if (interacting.size() == geom->getNumGeometries()) {
+        return OverlayNG::overlay(geom, maskGeom, opCode, overlayPM);
+    }
+    if (!interacting.empty()) {
+        auto part = factory->createMultiPolygon(interacting);
+        addElements(OverlayNG::overlay(part.get(), maskGeom, opCode, overlayPM), elements);
+    }
+
+    if (elements.empty()) {
+        return OverlayUtil::createEmptyResult(OverlayUtil::resultDimension(opCode, 2, 2), factory);
+    }
+    // polygons come first, as in the results of OverlayNG
+    return factory->buildGeometry(std::move(elements));
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -26,6 +26,7 @@
 #include <geos/noding/snap/SnappingNoder.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/util/TopologyException.h>
 
 #include <stdexcept>
@@ -82,11 +83,19 @@ OverlayNGRobust::Union(const Geometry* a)
 /*public static*/
 std::unique_ptr<Geometry>
 OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCode)
+{
+    return Overlay(geom0, geom1, opCode, nullptr);
+}
+
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCode,
+                         Stats* stats, const Attempt& start)
 {
     geos::util::ensureNoCurvedComponents(geom0);
     geos::util::ensureNoCurvedComponents(geom1);
 
-    std::unique_ptr<Geometry> result;
+    std::size_t startIndex = attemptIndex(start);
     std::runtime_error exOriginal("");
 
     /**
@@ -100,60 +109,173 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
         return OverlayNG::overlay(geom0, geom1, opCode, geom0->getPrecisionModel());
     }
 
+    double snapTol = snapTolerance(geom0, geom1);
+
+    /**
+    * Make the attempts in order, from the start one.
+    * If they all fail, make the ones before it.
+    */
+    for (std::size_t i = 0; i < NUM_ATTEMPTS; i++) {
+        std::size_t index = (startIndex + i) % NUM_ATTEMPTS;
+        auto startTime = std::chrono::steady_clock::now();
+        auto result = overlayAttempt(geom0, geom1, opCode, index, snapTol, exOriginal);
+        if (stats != nullptr) {
+            stats->record(index, result != nullptr, std::chrono::steady_clock::now() - startTime);
+        }
+        if (result != nullptr) {
+            return result;
+        }
+    }
+
     /**
-     * First try overlay with a FLOAT noder, which is fastest and causes least
-     * change to geometry coordinates
-     * By default the noder is validated, which is required in order
-     * to detect certain invalid noding situations which otherwise
-     * cause incorrect overlay output.
+     * Just can't get overlay to work, so throw original error.
      */
-    try {
-        geom::PrecisionModel PM_FLOAT;
-#if GEOS_DEBUG
-        std::cerr << "Using floating point overlay." << std::endl;
-#endif
-        result = OverlayNG::overlay(geom0, geom1, opCode, &PM_FLOAT);
+    throw exOriginal;
+}
 
-        // Simple noding with no validation
-        // There are cases where this succeeds with invalid noding (e.g. STMLF 1608).
-        // So currently it is NOT safe to run overlay without noding validation
-        //result = OverlayNG.overlay(geom0, geom1, opCode, createFloatingNoValidNoder());
-        // std::cerr << "Floating point overlay success." << std::endl;
-        return result;
-    }
-    catch (const std::runtime_error &ex) {
+/*private static*/
+std::unique_ptr<Geometry>
+OverlayNGRobust::overlayAttempt(const Geometry* geom0, const Geometry* geom1, int opCode,
+                                std::size_t index, double snapTol, std::runtime_error& exFloating)
+{
+    Attempt attempt = attemptAt(index);
+    switch (attempt.strategy) {
+    case FLOATING:
         /**
-        * Capture original exception,
-        * so it can be rethrown if the remaining strategies all fail.
-        */
-        exOriginal = ex;
+         * First try overlay with a FLOAT noder, which is fastest and causes least
+         * change to geometry coordinates
+         * By default the noder is validated, which is required in order
+         * to detect certain invalid noding situations which otherwise
+         * cause incorrect overlay output.
+         */
+        try {
+            geom::PrecisionModel PM_FLOAT;
 #if GEOS_DEBUG
-        std::cerr << "Floating point overlay FAILURE: " << ex.what() << std::endl;
+            std::cerr << "Using floating point overlay." << std::endl;
 #endif
-    }
+            // Simple noding with no validation
+            // There are cases where this succeeds with invalid noding (e.g. STMLF 1608).
+            // So currently it is NOT safe to run overlay without noding validation
+            //result = OverlayNG.overlay(geom0, geom1, opCode, createFloatingNoValidNoder());
+            return OverlayNG::overlay(geom0, geom1, opCode, &PM_FLOAT);
+        }
+        catch (const std::runtime_error &ex) {
+            /**
+            * Capture original exception,
+            * so it can be rethrown if the remaining strategies all fail.
+            */
+            exFloating = ex;
+#if GEOS_DEBUG
+            std::cerr << "Floating point overlay FAILURE: " << ex.what() << std::endl;
+#endif
+        }
+        return nullptr;
 
     /**
-     * On failure retry using snapping noding with a "safe" tolerance.
-     * if this throws an exception just let it go,
-     * since it is something that is not a TopologyException
+     * On failure retry using snapping noding with a "safe" tolerance,
+     * increased at each try.
      */
-    result = overlaySnapTries(geom0, geom1, opCode);
-    if (result != nullptr)
-        return result;
+    case SNAPPING:
+    case SNAP_SELF:
+        for (int i = 0; i < attempt.snapTry; i++) {
+            snapTol = snapTol * 10;
+        }
+#if GEOS_DEBUG
+        std::cerr << "Trying overlaySnapping(tol " << snapTol << ")." << std::endl;
+#endif
+        if (attempt.strategy == SNAPPING) {
+            return overlaySnapping(geom0, geom1, opCode, snapTol);
+        }
+        /**
+         * Now try snapping each input individually,
+         * and then doing the overlay.
+         */
+        return overlaySnapBoth(geom0, geom1, opCode, snapTol);
 
     /**
      * On failure retry using snap-rounding with a heuristic scale factor (grid size).
      */
-    result = overlaySR(geom0, geom1, opCode);
-    if (result != nullptr)
-        return result;
+    case SNAP_ROUNDING:
+        return overlaySR(geom0, geom1, opCode);
+    }
+    return nullptr;
+}
 
-    /**
-     * Just can't get overlay to work, so throw original error.
-     */
-    throw exOriginal;
+/*private static*/
+std::size_t
+OverlayNGRobust::attemptIndex(const Attempt& attempt)
+{
+    bool isSnapping = attempt.strategy == SNAPPING || attempt.strategy == SNAP_SELF;
+    if (isSnapping && (attempt.snapTry < 0 || attempt.snapTry >= NUM_SNAP_TRIES)) {
+        throw geos::util::IllegalArgumentException("OverlayNGRobust: invalid snap try");
+    }
+    switch (attempt.strategy) {
+    case FLOATING:
+        return 0;
+    case SNAPPING:
+        return 1 + 2 * static_cast<std::size_t>(attempt.snapTry);
+    case SNAP_SELF:
+        return 2 + 2 * static_cast<std::size_t>(attempt.snapTry);
+    case SNAP_ROUNDING:
+        return NUM_ATTEMPTS - 1;
+    }
+    throw geos::util::IllegalArgumentException("OverlayNGRobust: invalid strategy");
+}
+
+/*private static*/
+OverlayNGRobust::Attempt
+OverlayNGRobust::attemptAt(std::size_t index)
+{
+    if (index == 0) {
+        return Attempt(FLOATING);
+    }
+    if (index == NUM_ATTEMPTS - 1) {
+        return Attempt(SNAP_ROUNDING);
+    }
+    return Attempt(index % 2 == 1 ? SNAPPING : SNAP_SELF, static_cast<int>((index - 1) / 2));
+}
+
+/*public*/
+double
+OverlayNGRobust::Stats::getTime(const Attempt& attempt) const
+{
+    return static_cast<double>(nanoseconds[attemptIndex(attempt)]) * 1e-9;
+}
+
+/*public*/
+OverlayNGRobust::Attempt
+OverlayNGRobust::Stats::getMostSuccessful() const
+{
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < NUM_ATTEMPTS; i++) {
+        if (numSuccesses[i] > numSuccesses[best]) {
+            best = i;
+        }
+    }
+    return attemptAt(best);
+}
+
+/*public*/
+void
+OverlayNGRobust::Stats::reset()
+{
+    for (std::size_t i = 0; i < NUM_ATTEMPTS; i++) {
+        numAttempts[i] = 0;
+        numSuccesses[i] = 0;
+        nanoseconds[i] = 0;
+    }
 }
 
+/*private*/
+void
+OverlayNGRobust::Stats::record(std::size_t index, bool isSuccess, std::chrono::steady_clock::duration time)
+{
+    numAttempts[index]++;
+    if (isSuccess) {
+        numSuccesses[index]++;
+    }
+    nanoseconds[index] += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
 
 /*private static*/
 std::unique_ptr<Geometry>
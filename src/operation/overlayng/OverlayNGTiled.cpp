@@ -0,0 +1,922 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/OverlayNGTiled.h>
+
+#include <geos/operation/overlayng/InputGeometry.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/overlayng/OverlayUtil.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/algorithm/PointLocation.h>
+#include <geos/algorithm/PolygonNodeTopology.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/intersection/Rectangle.h>
+#include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/Parallel.h>
+#include <geos/util/TopologyException.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+using namespace geos::geom;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+namespace {
+
+// Ordinates on a grid line, and the vertices lying on it
+using SeamVertices = std::map<double, std::vector<double>>;
+
+// A point where an edge crosses a grid line, and its position along the edge
+using Crossing = std::pair<double, CoordinateXYZM>;
+
+double
+ordinate(const CoordinateXYZM& p, bool isX)
+{
+    return isX ? p.x : p.y;
+}
+
+/*
+ * The point where segment a-b crosses the line x = c (or y = c).
+ * It is computed from the smaller endpoint, so an edge shared by
+ * several rings gets the same point whatever its direction.
+ */
+CoordinateXYZM
+crossing(const CoordinateXYZM& a, const CoordinateXYZM& b, bool isX, double c)
+{
+    const CoordinateXYZM& p0 = a.compareTo(b) <= 0 ? a : b;
+    const CoordinateXYZM& p1 = a.compareTo(b) <= 0 ? b : a;
+    CoordinateXYZM p;
+    double t;
+    if (isX) {
+        t = (c - p0.x) / (p1.x - p0.x);
+        p.x = c;
+        p.y = p0.y + (p1.y - p0.y) * t;
+    }
+    else {
+        t = (c - p0.y) / (p1.y - p0.y);
+        p.x = p0.x + (p1.x - p0.x) * t;
+        p.y = c;
+    }
+    p.z = p0.z + (p1.z - p0.z) * t;
+    p.m = p0.m + (p1.m - p0.m) * t;
+    return p;
+}
+
+/*
+ * Adds the points where segment a-b crosses the interior grid lines.
+ * The first and last lines are the bounds of the extent.
+ */
+void
+addCrossings(const CoordinateXYZM& a, const CoordinateXYZM& b, bool isX,
+             const std::vector<double>& lines, std::vector<Crossing>& crossings)
+{
+    double ordA = ordinate(a, isX);
+    double ordB = ordinate(b, isX);
+    double lo = std::min(ordA, ordB);
+    double hi = std::max(ordA, ordB);
+    auto last = lines.end() - 1;
+    for (auto it = std::upper_bound(lines.begin() + 1, last, lo); it != last && *it < hi; ++it) {
+        crossings.emplace_back((*it - ordA) / (ordB - ordA), crossing(a, b, isX, *it));
+    }
+}
+
+bool
+isGridLine(double ord, const std::vector<double>& lines)
+{
+    return std::binary_search(lines.begin() + 1, lines.end() - 1, ord);
+}
+
+bool
+isPolygonOrMultiPolygon(const Geometry& geom)
+{
+    auto typeId = geom.getGeometryTypeId();
+    return typeId == GEOS_POLYGON || typeId == GEOS_MULTIPOLYGON;
+}
+
+/*
+ * Clips polygons to a rectangle, dropping the parts of the clipped
+ * geometry which collapse to lines or points.
+ */
+std::unique_ptr<Geometry>
+clipToEnvelope(const Geometry& geom, const Envelope& env)
+{
+    const GeometryFactory* factory = geom.getFactory();
+    if (geom.isEmpty() || !env.intersects(geom.getEnvelopeInternal())) {
+        return factory->createMultiPolygon();
+    }
+    if (env.covers(geom.getEnvelopeInternal())) {
+        return geom.clone();
+    }
+
+    intersection::Rectangle rect(env.getMinX(), env.getMinY(), env.getMaxX(), env.getMaxY());
+    auto clipped = intersection::RectangleIntersection::clip(geom, rect);
+    if (clipped == nullptr) {
+        return factory->createMultiPolygon();
+    }
+    if (isPolygonOrMultiPolygon(*clipped)) {
+        return clipped;
+    }
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(*clipped, polys);
+    return factory->createMultiPolygon(std::vector<const Geometry*>(polys.begin(), polys.end()));
+}
+
+void
+collectSeamVertices(const CoordinateSequence& ring, const std::vector<double>& gridX, const std::vector<double>& gridY,
+                    SeamVertices& seamX, SeamVertices& seamY)
+{
+    ring.forEach<CoordinateXY>([&](const CoordinateXY& p) {
+        if (isGridLine(p.x, gridX)) {
+            seamX[p.x].push_back(p.y);
+        }
+        if (isGridLine(p.y, gridY)) {
+            seamY[p.y].push_back(p.x);
+        }
+    });
+}
+
+/*
+ * Adds the seam vertices lying strictly between a and b to a segment
+ * along the line x = a.x (or y = a.y).
+ */
+void
+addSeamVertices(const CoordinateXYZM& a, const CoordinateXYZM& b, bool isX,
+                const std::vector<double>& ords, CoordinateSequence& pts)
+{
+    double ordA = isX ? a.y : a.x;
+    double ordB = isX ? b.y : b.x;
+    auto addAt = [&](double ord) {
+        CoordinateXYZM p(a);
+        double t = (ord - ordA) / (ordB - ordA);
+        (isX ? p.y : p.x) = ord;
+        p.z = a.z + (b.z - a.z) * t;
+        p.m = a.m + (b.m - a.m) * t;
+        pts.add(p);
+    };
+    if (ordA < ordB) {
+        for (auto it = std::upper_bound(ords.begin(), ords.end(), ordA); it != ords.end() && *it < ordB; ++it) {
+            addAt(*it);
+        }
+    }
+    else {
+        for (auto it = std::lower_bound(ords.begin(), ords.end(), ordA); it != ords.begin() && *(it - 1) > ordB; --it) {
+            addAt(*(it - 1));
+        }
+    }
+}
+
+std::unique_ptr<CoordinateSequence>
+nodeSeams(const CoordinateSequence& pts, const SeamVertices& seamX, const SeamVertices& seamY)
+{
+    auto noded = detail::make_unique<CoordinateSequence>(0u, pts.hasZ(), pts.hasM());
+    noded->reserve(pts.size());
+    CoordinateXYZM a, b;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        pts.getAt(i, a);
+        noded->add(a);
+        if (i + 1 == pts.size()) {
+            break;
+        }
+        pts.getAt(i + 1, b);
+        if (a.x == b.x) {
+            auto it = seamX.find(a.x);
+            if (it != seamX.end()) {
+                addSeamVertices(a, b, true, it->second, *noded);
+            }
+        }
+        else if (a.y == b.y) {
+            auto it = seamY.find(a.y);
+            if (it != seamY.end()) {
+                addSeamVertices(a, b, false, it->second, *noded);
+            }
+        }
+    }
+    return noded;
+}
+
+// Directed edges of the tile results lying along a grid line
+using SeamSegments = std::set<std::pair<CoordinateXY, CoordinateXY>>;
+
+void
+collectSeamSegments(const CoordinateSequence& ring, const std::vector<double>& gridX, const std::vector<double>& gridY,
+                    std::vector<std::pair<CoordinateXY, CoordinateXY>>& segs)
+{
+    for (std::size_t i = 1; i < ring.size(); i++) {
+        const CoordinateXY& a = ring.getAt<CoordinateXY>(i - 1);
+        const CoordinateXY& b = ring.getAt<CoordinateXY>(i);
+        if ((a.x == b.x && isGridLine(a.x, gridX)) || (a.y == b.y && isGridLine(a.y, gridY))) {
+            segs.emplace_back(a, b);
+        }
+    }
+}
+
+/*
+ * Tests if the edge a-b is shared with the result of an adjacent tile,
+ * which has it in the opposite direction.
+ */
+bool
+isShared(const CoordinateXY& a, const CoordinateXY& b, const SeamSegments& seamSegments)
+{
+    return seamSegments.count(std::make_pair(b, a)) > 0;
+}
+
+bool
+hasSharedEdge(const CoordinateSequence& ring, const SeamSegments& seamSegments)
+{
+    for (std::size_t i = 1; i < ring.size(); i++) {
+        if (isShared(ring.getAt<CoordinateXY>(i - 1), ring.getAt<CoordinateXY>(i), seamSegments)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Cuts a ring which has shared edges into the chains of edges between them.
+ */
+void
+extractChains(const CoordinateSequence& ring, const SeamSegments& seamSegments,
+              std::vector<std::unique_ptr<CoordinateSequence>>& chains)
+{
+    auto isSharedAt = [&ring, &seamSegments](std::size_t i) {
+        return isShared(ring.getAt<CoordinateXY>(i), ring.getAt<CoordinateXY>(i + 1), seamSegments);
+    };
+
+    const std::size_t numSegs = ring.size() - 1;
+    std::size_t k = 0;
+    while (!isSharedAt(k)) {
+        k++;
+    }
+    // the last segment visited is the shared segment k, which ends the last chain
+    std::unique_ptr<CoordinateSequence> chain;
+    for (std::size_t step = 1; step <= numSegs; step++) {
+        std::size_t i = (k + step) % numSegs;
+        if (isSharedAt(i)) {
+            if (chain != nullptr) {
+                chains.push_back(std::move(chain));
+            }
+            continue;
+        }
+        if (chain == nullptr) {
+            chain = detail::make_unique<CoordinateSequence>(0u, ring.hasZ(), ring.hasM());
+            chain->add(ring, i, i);
+        }
+        chain->add(ring, i + 1, i + 1);
+    }
+}
+
+/*
+ * Links chains into rings. The interior of the result is on the right
+ * of the chains, so at a node the ring continues with the first chain
+ * counter-clockwise from the one it arrives by.
+ */
+void
+linkChains(const std::vector<std::unique_ptr<CoordinateSequence>>& chains,
+           std::vector<std::unique_ptr<CoordinateSequence>>& rings)
+{
+    using algorithm::PolygonNodeTopology;
+    constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    std::unordered_map<CoordinateXY, std::vector<std::size_t>, CoordinateXY::HashCode> chainsAt;
+    for (std::size_t i = 0; i < chains.size(); i++) {
+        chainsAt[chains[i]->front<CoordinateXY>()].push_back(i);
+    }
+
+    std::vector<bool> isUsed(chains.size(), false);
+    for (std::size_t first = 0; first < chains.size(); first++) {
+        if (isUsed[first]) {
+            continue;
+        }
+        auto ring = detail::make_unique<CoordinateSequence>(0u, chains[first]->hasZ(), chains[first]->hasM());
+        std::size_t c = first;
+        do {
+            const CoordinateSequence& chain = *chains[c];
+            isUsed[c] = true;
+            ring->add(chain, ring->isEmpty() ? 0 : 1, chain.size() - 1);
+
+            const CoordinateXY& node = chain.back<CoordinateXY>();
+            const CoordinateXY& prev = chain.getAt<CoordinateXY>(chain.size() - 2);
+            std::size_t next = NONE;
+            bool nextIsAfter = false;
+            auto it = chainsAt.find(node);
+            if (it != chainsAt.end()) {
+                for (std::size_t j : it->second) {
+                    if (isUsed[j] && j != first) {
+                        continue;
+                    }
+                    const CoordinateXY& p = chains[j]->getAt<CoordinateXY>(1);
+                    bool isAfter = PolygonNodeTopology::compareAngle(&node, &p, &prev) > 0;
+                    if (next == NONE || (isAfter && !nextIsAfter) ||
+                            (isAfter == nextIsAfter &&
+                             PolygonNodeTopology::compareAngle(&node, &p, &chains[next]->getAt<CoordinateXY>(1)) < 0)) {
+                        next = j;
+                        nextIsAfter = isAfter;
+                    }
+                }
+            }
+            if (next == NONE) {
+                throw geos::util::TopologyException("OverlayNGTiled: tile results do not match along a seam");
+            }
+            c = next;
+        }
+        while (c != first);
+
+        rings.push_back(std::move(ring));
+    }
+}
+
+/*
+ * Splits a closed ring at the vertices it visits more than once,
+ * where it touches itself, into simple rings.
+ */
+void
+splitAtRepeatedVertices(const CoordinateSequence& ring, std::vector<std::unique_ptr<CoordinateSequence>>& rings)
+{
+    CoordinateSequence path(0u, ring.hasZ(), ring.hasM());
+    std::unordered_map<CoordinateXY, std::size_t, CoordinateXY::HashCode> position;
+    for (std::size_t i = 0; i < ring.size(); i++) {
+        const CoordinateXY& p = ring.getAt<CoordinateXY>(i);
+        auto it = position.find(p);
+        if (it == position.end()) {
+            position[p] = path.size();
+            path.add(ring, i, i);
+            continue;
+        }
+        // the loop from the earlier visit of p back to it
+        std::size_t j = it->second;
+        auto loop = detail::make_unique<CoordinateSequence>(0u, ring.hasZ(), ring.hasM());
+        loop->add(path, j, path.size() - 1);
+        loop->add(ring, i, i);
+        for (std::size_t k = j + 1; k < path.size(); k++) {
+            position.erase(path.getAt<CoordinateXY>(k));
+        }
+        path.resize(j + 1);
+        rings.push_back(std::move(loop));
+    }
+}
+
+bool
+isInRing(const CoordinateSequence& ring, const CoordinateSequence& shell)
+{
+    for (std::size_t i = 0; i < ring.size(); i++) {
+        Location loc = algorithm::PointLocation::locateInRing(ring.getAt<CoordinateXY>(i), shell);
+        if (loc != Location::BOUNDARY) {
+            return loc == Location::INTERIOR;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+/*public*/
+OverlayNGTiled::OverlayNGTiled(const Geometry* p_geom0, const Geometry* p_geom1,
+                               const PrecisionModel* p_pm, int p_opCode)
+    : geom0(p_geom0)
+    , geom1(p_geom1)
+    , pm(p_pm ? p_pm : p_geom0->getFactory()->getPrecisionModel())
+    , opCode(p_opCode)
+    , maxTileVertices(MAX_TILE_VERTICES_DEFAULT)
+    , numThreads(1)
+{}
+
+/*public*/
+OverlayNGTiled::OverlayNGTiled(const Geometry* p_geom0, const Geometry* p_geom1, int p_opCode)
+    : OverlayNGTiled(p_geom0, p_geom1, nullptr, p_opCode)
+{}
+
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::overlay(const Geometry* geom0, const Geometry* geom1,
+                        int opCode, const PrecisionModel* pm, std::size_t numThreads)
+{
+    OverlayNGTiled ov(geom0, geom1, pm, opCode);
+    ov.setNumThreads(numThreads);
+    return ov.getResult();
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::getResult()
+{
+    if (!isPolygonOrMultiPolygon(*geom0) || !isPolygonOrMultiPolygon(*geom1)) {
+        return overlayUntiled();
+    }
+    if (OverlayUtil::isEmptyResult(opCode, geom0, geom1, pm)) {
+        return OverlayUtil::createEmptyResult(2, geom0->getFactory());
+    }
+
+    try {
+        return overlayTiled();
+    }
+    catch (const geos::util::TopologyException&) {}
+    catch (const geos::util::IllegalArgumentException&) {}
+
+    /**
+    * Clipping may create slivers which collapse when snap-rounded,
+    * or which RectangleIntersection cannot handle, so tiling may fail
+    * where an overlay of the whole inputs does not.
+    */
+    if (!OverlayUtil::isFloating(pm)) {
+        return overlayUntiled();
+    }
+    return OverlayNGRobust::Overlay(geom0, geom1, opCode);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::overlayTiled()
+{
+    /**
+    * Tiles cover the area where the result can lie, clipped robustly
+    * for INTERSECTION and DIFFERENCE as done by OverlayNG.
+    */
+    Envelope env;
+    std::unique_ptr<Geometry> clipped[2];
+    InputGeometry inputGeom(geom0, geom1);
+    if (OverlayUtil::clippingEnvelope(opCode, &inputGeom, pm, env)) {
+        clipped[0] = clipToEnvelope(*geom0, env);
+        clipped[1] = clipToEnvelope(*geom1, env);
+    }
+    else {
+        env = *geom0->getEnvelopeInternal();
+        env.expandToInclude(geom1->getEnvelopeInternal());
+        clipped[0] = geom0->clone();
+        clipped[1] = geom1->clone();
+    }
+
+    std::size_t numPts = clipped[0]->getNumPoints() + clipped[1]->getNumPoints();
+    if (numPts <= maxTileVertices || !computeGrid(env, numPts)) {
+        return overlayUntiled();
+    }
+
+    Tile root;
+    root.ix0 = root.iy0 = 0;
+    root.ix1 = gridX.size() - 1;
+    root.iy1 = gridY.size() - 1;
+    for (int i = 0; i < 2; i++) {
+        root.geom[i] = nodeToGrid(*clipped[i]);
+    }
+    // A crossing which is also an input vertex must stay in the result
+    for (int i = 0; i < 2 && !crossings.empty(); i++) {
+        for (std::size_t j = 0; j < clipped[i]->getNumGeometries(); j++) {
+            const Polygon* poly = static_cast<const Polygon*>(clipped[i]->getGeometryN(j));
+            for (std::size_t k = 0; k <= poly->getNumInteriorRing() && !poly->isEmpty(); k++) {
+                const LinearRing* ring = k == 0 ? poly->getExteriorRing() : poly->getInteriorRingN(k - 1);
+                ring->getCoordinatesRO()->forEach<CoordinateXY>([this](const CoordinateXY& c) {
+                    crossings.erase(c);
+                });
+            }
+        }
+    }
+    clipped[0].reset();
+    clipped[1].reset();
+
+    std::vector<Tile> tiles;
+    partition(std::move(root), tiles);
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    std::vector<std::unique_ptr<Geometry>> tileResults(tiles.size());
+    geos::util::parallelFor(tiles.size(), numThreads, 1, [this, &tiles, &tileResults](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            tileResults[i] = overlayTile(tiles[i]);
+            // only the result of the tile is needed now
+            tiles[i].geom[0].reset();
+            tiles[i].geom[1].reset();
+        }
+    });
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    return stitch(tileResults);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::overlayUntiled() const
+{
+    OverlayNG ov(geom0, geom1, pm, opCode);
+    ov.setStrictMode(true);
+    return ov.getResult();
+}
+
+/*private*/
+bool
+OverlayNGTiled::computeGrid(const Envelope& env, std::size_t numPts)
+{
+    if (env.getWidth() <= 0 || env.getHeight() <= 0) {
+        return false;
+    }
+
+    // Use more cells than tiles, so tiles can adapt to the density of vertices
+    double numCells = 4.0 * std::ceil(static_cast<double>(numPts) / static_cast<double>(std::max<std::size_t>(maxTileVertices, 1)));
+    double numCellsX = std::round(std::sqrt(numCells * env.getWidth() / env.getHeight()));
+    numCellsX = std::min(std::max(numCellsX, 1.0), static_cast<double>(MAX_GRID_CELLS));
+    double numCellsY = std::round(numCells / numCellsX);
+    numCellsY = std::min(std::max(numCellsY, 1.0), static_cast<double>(MAX_GRID_CELLS));
+
+    // With a FIXED precision model the lines are on the precision grid,
+    // so rounding keeps vertices in their tile
+    auto lines = [this](double lo, double hi, double n) {
+        std::vector<double> ords { lo };
+        for (double i = 1; i < n; i++) {
+            double c = lo + (hi - lo) * i / n;
+            if (!OverlayUtil::isFloating(pm)) {
+                c = pm->makePrecise(c);
+            }
+            if (c > ords.back() && c < hi) {
+                ords.push_back(c);
+            }
+        }
+        ords.push_back(hi);
+        return ords;
+    };
+    gridX = lines(env.getMinX(), env.getMaxX(), numCellsX);
+    gridY = lines(env.getMinY(), env.getMaxY(), numCellsY);
+    return gridX.size() > 2 || gridY.size() > 2;
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::nodeToGrid(const Geometry& geom)
+{
+    const GeometryFactory* factory = geom.getFactory();
+    std::vector<std::unique_ptr<Polygon>> polys;
+    for (std::size_t i = 0; i < geom.getNumGeometries(); i++) {
+        const Polygon* poly = static_cast<const Polygon*>(geom.getGeometryN(i));
+        if (poly->isEmpty()) {
+            continue;
+        }
+        auto shell = factory->createLinearRing(nodeToGrid(*poly->getExteriorRing()->getCoordinatesRO()));
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            holes.push_back(factory->createLinearRing(nodeToGrid(*poly->getInteriorRingN(j)->getCoordinatesRO())));
+        }
+        polys.push_back(factory->createPolygon(std::move(shell), std::move(holes)));
+    }
+    return factory->createMultiPolygon(std::move(polys));
+}
+
+/*private*/
+std::unique_ptr<CoordinateSequence>
+OverlayNGTiled::nodeToGrid(const CoordinateSequence& ring)
+{
+    auto noded = detail::make_unique<CoordinateSequence>(0u, ring.hasZ(), ring.hasM());
+    noded->reserve(ring.size());
+    std::vector<Crossing> edgeCrossings;
+    CoordinateXYZM a, b;
+    for (std::size_t i = 0; i < ring.size(); i++) {
+        ring.getAt(i, a);
+        noded->add(a);
+        if (i + 1 == ring.size()) {
+            break;
+        }
+        ring.getAt(i + 1, b);
+
+        edgeCrossings.clear();
+        addCrossings(a, b, true, gridX, edgeCrossings);
+        addCrossings(a, b, false, gridY, edgeCrossings);
+        if (edgeCrossings.size() > 1) {
+            std::sort(edgeCrossings.begin(), edgeCrossings.end(), [](const Crossing& c0, const Crossing& c1) {
+                return c0.first < c1.first;
+            });
+        }
+        for (const auto& c : edgeCrossings) {
+            /**
+            * The crossings on both sides of a vertex lying on (or within
+            * rounding error of) a grid line may be the same point, which
+            * would leave a spike of zero area.
+            */
+            std::size_t n = noded->size();
+            if (n >= 2 && noded->getAt<CoordinateXY>(n - 2).equals2D(c.second)) {
+                noded->pop_back();
+                continue;
+            }
+            noded->add(c.second, false);
+            if (OverlayUtil::isFloating(pm)) {
+                crossings.insert(c.second);
+            }
+        }
+    }
+
+    // Same for a spike at the start of the ring
+    std::size_t n = noded->size();
+    if (n >= 5 && noded->getAt<CoordinateXY>(1).equals2D(noded->getAt<CoordinateXY>(n - 2))) {
+        auto trimmed = detail::make_unique<CoordinateSequence>(0u, ring.hasZ(), ring.hasM());
+        trimmed->reserve(n - 2);
+        trimmed->add(*noded, 1, n - 3);
+        trimmed->closeRing();
+        return trimmed;
+    }
+    return noded;
+}
+
+/*private*/
+Envelope
+OverlayNGTiled::envelope(const Tile& tile) const
+{
+    return Envelope(gridX[tile.ix0], gridX[tile.ix1], gridY[tile.iy0], gridY[tile.iy1]);
+}
+
+/*private*/
+void
+OverlayNGTiled::partition(Tile root, std::vector<Tile>& leaves) const
+{
+    std::vector<Tile> stack;
+    stack.push_back(std::move(root));
+    while (!stack.empty()) {
+        Tile tile = std::move(stack.back());
+        stack.pop_back();
+
+        if (isEmptyResult(tile)) {
+            continue;
+        }
+
+        std::size_t numPts = tile.geom[0]->getNumPoints() + tile.geom[1]->getNumPoints();
+        if (numPts <= maxTileVertices || tile.numCells() == 1) {
+            leaves.push_back(std::move(tile));
+            continue;
+        }
+
+        // Split along a grid line, across the side with more cells
+        Tile below, above;
+        below.ix0 = above.ix0 = tile.ix0;
+        below.ix1 = above.ix1 = tile.ix1;
+        below.iy0 = above.iy0 = tile.iy0;
+        below.iy1 = above.iy1 = tile.iy1;
+        if (tile.ix1 - tile.ix0 >= tile.iy1 - tile.iy0) {
+            below.ix1 = above.ix0 = (tile.ix0 + tile.ix1) / 2;
+        }
+        else {
+            below.iy1 = above.iy0 = (tile.iy0 + tile.iy1) / 2;
+        }
+        Envelope belowEnv = envelope(below);
+        Envelope aboveEnv = envelope(above);
+        for (int i = 0; i < 2; i++) {
+            below.geom[i] = clipToEnvelope(*tile.geom[i], belowEnv);
+            above.geom[i] = clipToEnvelope(*tile.geom[i], aboveEnv);
+            tile.geom[i].reset();
+        }
+
+        // tiles below are processed first
+        stack.push_back(std::move(above));
+        stack.push_back(std::move(below));
+    }
+}
+
+/*private*/
+bool
+OverlayNGTiled::isEmptyResult(const Tile& tile) const
+{
+    return OverlayUtil::isEmptyResult(opCode, tile.geom[0].get(), tile.geom[1].get(), pm);
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::overlayTile(const Tile& tile) const
+{
+    OverlayNG ov(tile.geom[0].get(), tile.geom[1].get(), pm, opCode);
+    ov.setStrictMode(true);
+    auto result = ov.getResult();
+    if (isPolygonOrMultiPolygon(*result)) {
+        return result;
+    }
+    /**
+    * With a FIXED precision model the clipped inputs of a tile can collapse
+    * to lines when snap-rounded, giving a linear result. Only the polygons
+    * are kept, as they are in an overlay of the whole inputs.
+    */
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(*result, polys);
+    return result->getFactory()->createMultiPolygon(std::vector<const Geometry*>(polys.begin(), polys.end()));
+}
+
+/*private*/
+std::unique_ptr<LinearRing>
+OverlayNGTiled::createRing(std::unique_ptr<CoordinateSequence> pts) const
+{
+    const GeometryFactory* factory = geom0->getFactory();
+    if (crossings.empty()) {
+        return factory->createLinearRing(std::move(pts));
+    }
+
+    /**
+    * With a FLOATING precision model, the points added where input edges
+    * cross grid lines are removed, leaving the input edges as they were.
+    */
+    auto kept = detail::make_unique<CoordinateSequence>(0u, pts->hasZ(), pts->hasM());
+    kept->reserve(pts->size());
+    for (std::size_t i = 0; i + 1 < pts->size(); i++) {
+        if (crossings.count(pts->getAt<CoordinateXY>(i)) == 0) {
+            kept->add(*pts, i, i);
+        }
+    }
+    if (kept->size() < 3) {
+        return factory->createLinearRing(std::move(pts));
+    }
+    kept->closeRing(true);
+    return factory->createLinearRing(std::move(kept));
+}
+
+/*private*/
+std::unique_ptr<Geometry>
+OverlayNGTiled::stitch(std::vector<std::unique_ptr<Geometry>>& tileResults) const
+{
+    const GeometryFactory* factory = geom0->getFactory();
+
+    /**
+    * A vertex on a tile boundary in the result of one tile may be missing
+    * from the collinear edge of the adjacent tile, so add the vertices
+    * on tile boundaries to all edges along them. The edges shared by
+    * adjacent tiles are then identical, in opposite directions.
+    */
+    SeamVertices seamX, seamY;
+    for (const auto& result : tileResults) {
+        for (std::size_t i = 0; i < result->getNumGeometries(); i++) {
+            const Polygon* poly = static_cast<const Polygon*>(result->getGeometryN(i));
+            if (poly->isEmpty()) {
+                continue;
+            }
+            collectSeamVertices(*poly->getExteriorRing()->getCoordinatesRO(), gridX, gridY, seamX, seamY);
+            for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+                collectSeamVertices(*poly->getInteriorRingN(j)->getCoordinatesRO(), gridX, gridY, seamX, seamY);
+            }
+        }
+    }
+    for (SeamVertices* seam : { &seamX, &seamY }) {
+        for (auto& entry : *seam) {
+            auto& ords = entry.second;
+            std::sort(ords.begin(), ords.end());
+            ords.erase(std::unique(ords.begin(), ords.end()), ords.end());
+        }
+    }
+
+    // The rings of each polygon of the tile results, shell first,
+    // with shells clockwise and holes counter-clockwise as OverlayNG
+    // creates them
+    using Rings = std::vector<std::unique_ptr<CoordinateSequence>>;
+    std::vector<std::vector<Rings>> tilePolys(tileResults.size());
+    std::vector<std::vector<std::pair<CoordinateXY, CoordinateXY>>> tileSeamSegments(tileResults.size());
+    geos::util::parallelFor(tileResults.size(), numThreads, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; t++) {
+            const Geometry& result = *tileResults[t];
+            for (std::size_t i = 0; i < result.getNumGeometries(); i++) {
+                const Polygon* poly = static_cast<const Polygon*>(result.getGeometryN(i));
+                if (poly->isEmpty()) {
+                    continue;
+                }
+                Rings rings;
+                for (std::size_t j = 0; j <= poly->getNumInteriorRing(); j++) {
+                    const LinearRing* ring = j == 0 ? poly->getExteriorRing() : poly->getInteriorRingN(j - 1);
+                    auto pts = nodeSeams(*ring->getCoordinatesRO(), seamX, seamY);
+                    if (algorithm::Orientation::isCCW(pts.get()) == (j == 0)) {
+                        pts->reverse();
+                    }
+                    collectSeamSegments(*pts, gridX, gridY, tileSeamSegments[t]);
+                    rings.push_back(std::move(pts));
+                }
+                tilePolys[t].push_back(std::move(rings));
+            }
+            tileResults[t].reset();
+        }
+    });
+
+    SeamSegments seamSegments;
+    for (auto& segs : tileSeamSegments) {
+        seamSegments.insert(segs.begin(), segs.end());
+        segs.clear();
+        segs.shrink_to_fit();
+    }
+
+    /**
+    * The tile results form a coverage, so they are joined by merging
+    * the polygons which share edges along the seams: their rings are
+    * cut at the shared edges and the chains left are linked into new
+    * rings. Polygons with no shared edge are kept as they are.
+    */
+    std::vector<std::unique_ptr<Polygon>> polys;
+    Rings chains;
+    Rings rings;
+    for (auto& tile : tilePolys) {
+        for (auto& poly : tile) {
+            bool isMerged = false;
+            for (const auto& ring : poly) {
+                isMerged = isMerged || hasSharedEdge(*ring, seamSegments);
+            }
+            if (!isMerged) {
+                auto shell = createRing(std::move(poly[0]));
+                std::vector<std::unique_ptr<LinearRing>> holes;
+                for (std::size_t j = 1; j < poly.size(); j++) {
+                    holes.push_back(createRing(std::move(poly[j])));
+                }
+                polys.push_back(factory->createPolygon(std::move(shell), std::move(holes)));
+                continue;
+            }
+            for (auto& ring : poly) {
+                if (hasSharedEdge(*ring, seamSegments)) {
+                    extractChains(*ring, seamSegments, chains);
+                }
+                else {
+                    rings.push_back(std::move(ring));
+                }
+            }
+        }
+        tile.clear();
+    }
+
+    Rings linked;
+    linkChains(chains, linked);
+    chains.clear();
+    for (const auto& ring : linked) {
+        splitAtRepeatedVertices(*ring, rings);
+    }
+    linked.clear();
+
+    // Holes are assigned to the smallest shell containing them
+    Rings shells;
+    Rings holes;
+    for (auto& ring : rings) {
+        if (ring->size() < 4) {
+            continue;
+        }
+        if (algorithm::Orientation::isCCW(ring.get())) {
+            holes.push_back(std::move(ring));
+        }
+        else {
+            shells.push_back(std::move(ring));
+        }
+    }
+    std::vector<Envelope> shellEnvs;
+    index::strtree::TemplateSTRtree<std::size_t> shellIndex;
+    for (std::size_t i = 0; i < shells.size(); i++) {
+        shellEnvs.push_back(shells[i]->getEnvelope());
+        shellIndex.insert(shellEnvs.back(), i);
+    }
+    std::vector<std::vector<std::unique_ptr<LinearRing>>> shellHoles(shells.size());
+    for (auto& hole : holes) {
+        const Envelope holeEnv = hole->getEnvelope();
+        std::size_t shell = shells.size();
+        shellIndex.query(holeEnv, [&](std::size_t i) {
+            if (!shellEnvs[i].covers(&holeEnv)) {
+                return;
+            }
+            if (shell < shells.size() && shellEnvs[shell].getArea() <= shellEnvs[i].getArea()) {
+                return;
+            }
+            if (isInRing(*hole, *shells[i])) {
+                shell = i;
+            }
+        });
+        if (shell == shells.size()) {
+            throw geos::util::TopologyException("OverlayNGTiled: hole outside the stitched polygons");
+        }
+        shellHoles[shell].push_back(createRing(std::move(hole)));
+    }
+    for (std::size_t i = 0; i < shells.size(); i++) {
+        polys.push_back(factory->createPolygon(createRing(std::move(shells[i])), std::move(shellHoles[i])));
+    }
+
+    if (polys.empty()) {
+        return OverlayUtil::createEmptyResult(2, factory);
+    }
+    if (polys.size() == 1) {
+        return std::move(polys[0]);
+    }
+    return factory->createMultiPolygon(std::move(polys));
+}
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -28,13 +28,16 @@
 #include <geos/operation/union/CascadedPolygonUnion.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/IsSimpleOp.h>
+#include <geos/util/Parallel.h>
 #include <geos/util/TopologyException.h>
 
 // std
 #include <cassert>
 #include <cstddef>
+#include <future>
 #include <sstream>
 #include <string>
+#include <system_error>
 
 
 namespace geos {
@@ -57,6 +60,15 @@ CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys, UnionStrategy* u
     return op.Union();
 }
 
+std::unique_ptr<geom::Geometry>
+CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun,
+                            std::size_t p_numThreads)
+{
+    CascadedPolygonUnion op(polys, unionFun);
+    op.setNumThreads(p_numThreads);
+    return op.Union();
+}
+
 std::unique_ptr<geom::Geometry>
 CascadedPolygonUnion::Union(const geom::MultiPolygon* multipoly)
 {
@@ -94,6 +106,10 @@ CascadedPolygonUnion::Union()
     // TODO avoid creating this vector and run binaryUnion off the iterators directly
     std::vector<const geom::Geometry*> geoms(index.items().begin(), index.items().end());
 
+    std::size_t threads = util::resolveThreadCount(numThreads);
+    if (threads > 1) {
+        return binaryUnionParallel(geoms, 0, geoms.size(), threads);
+    }
     return binaryUnion(geoms, 0, geoms.size());
 }
 
@@ -120,6 +136,35 @@ CascadedPolygonUnion::binaryUnion(const std::vector<const geom::Geometry*> & geo
     }
 }
 
+std::unique_ptr<geom::Geometry>
+CascadedPolygonUnion::binaryUnionParallel(const std::vector<const geom::Geometry*> & geoms,
+                                          std::size_t start, std::size_t end, std::size_t threads)
+{
+    if(threads <= 1 || end - start <= 2) {
+        return binaryUnion(geoms, start, end);
+    }
+
+    // Split exactly as binaryUnion does, so the result does not
+    // depend on the number of threads.
+    std::size_t mid = (end + start) / 2;
+    std::size_t leftThreads = threads / 2;
+
+    std::future<std::unique_ptr<geom::Geometry>> left;
+    try {
+        left = std::async(std::launch::async, [&]() {
+            return binaryUnionParallel(geoms, start, mid, leftThreads);
+        });
+    }
+    catch (const std::system_error&) {
+        // No thread available, keep going on this one.
+        return binaryUnion(geoms, start, end);
+    }
+
+    std::unique_ptr<geom::Geometry> g1(binaryUnionParallel(geoms, mid, end, threads - leftThreads));
+    std::unique_ptr<geom::Geometry> g0(left.get());
+    return unionSafe(std::move(g0), std::move(g1));
+}
+
 std::unique_ptr<geom::Geometry>
 CascadedPolygonUnion::unionSafe(const geom::Geometry* g0, const geom::Geometry* g1) const
 {
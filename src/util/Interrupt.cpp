@@ -15,11 +15,14 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util/GEOSException.h> // for inheritance
 
+#include <atomic>
+
 namespace {
 /* Could these be portably stored in thread-specific space ? */
-bool requested = false;
+/* They are atomic, as multi-threaded operations check them from each of their threads. */
+std::atomic<bool> requested(false);
 
-geos::util::Interrupt::Callback* callback = nullptr;
+std::atomic<geos::util::Interrupt::Callback*> callback(nullptr);
 }
 
 namespace geos {
@@ -52,19 +55,17 @@ Interrupt::check()
 Interrupt::Callback*
 Interrupt::registerCallback(Interrupt::Callback* cb)
 {
-    Callback* prev = callback;
-    callback = cb;
-    return prev;
+    return callback.exchange(cb);
 }
 
 void
 Interrupt::process()
 {
-    if(callback) {
-        (*callback)();
+    Callback* cb = callback.load();
+    if(cb) {
+        (*cb)();
     }
-    if(requested) {
-        requested = false;
+    if(requested.exchange(false)) {
         interrupt();
     }
 }
@@ -0,0 +1,227 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+// SSE2 and NEON are part of the baseline instruction sets of x86-64 and
+// AArch64, so they can be selected at compile time without a runtime check.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GEOS_SIMD_SSE2
+#include <emmintrin.h>
+#elif (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+#define GEOS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * A pair of doubles, operated on with single SIMD instructions where
+ * the target supports it (SSE2, NEON) and with scalar code otherwise.
+ *
+ * All operations are lane-wise and IEEE-exact, so kernels written with
+ * Double2 give the same results on every target, and the same results
+ * as scalar code performing the same operations in the same order.
+ */
+class Double2 {
+
+public:
+
+    /// Creates the pair `(a, b)`.
+    Double2(double a, double b)
+#if defined(GEOS_SIMD_SSE2)
+        : v(_mm_set_pd(b, a))
+#elif defined(GEOS_SIMD_NEON)
+        : v(vcombine_f64(vdup_n_f64(a), vdup_n_f64(b)))
+#else
+        : v{a, b}
+#endif
+    {}
+
+    /// Loads two consecutive doubles, with no alignment requirement.
+    static Double2 load(const double* p)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_loadu_pd(p));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vld1q_f64(p));
+#else
+        return Double2(p[0], p[1]);
+#endif
+    }
+
+    /// Stores the pair to two consecutive doubles, with no alignment requirement.
+    void store(double* p) const
+    {
+#if defined(GEOS_SIMD_SSE2)
+        _mm_storeu_pd(p, v);
+#elif defined(GEOS_SIMD_NEON)
+        vst1q_f64(p, v);
+#else
+        p[0] = v[0];
+        p[1] = v[1];
+#endif
+    }
+
+    /// Returns a pair holding `v` in both lanes.
+    static Double2 broadcast(double v)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_set1_pd(v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vdupq_n_f64(v));
+#else
+        return Double2(v, v);
+#endif
+    }
+
+    double first() const
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return _mm_cvtsd_f64(v);
+#elif defined(GEOS_SIMD_NEON)
+        return vgetq_lane_f64(v, 0);
+#else
+        return v[0];
+#endif
+    }
+
+    double second() const
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v));
+#elif defined(GEOS_SIMD_NEON)
+        return vgetq_lane_f64(v, 1);
+#else
+        return v[1];
+#endif
+    }
+
+    friend Double2 operator+(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_add_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vaddq_f64(a.v, b.v));
+#else
+        return Double2(a.v[0] + b.v[0], a.v[1] + b.v[1]);
+#endif
+    }
+
+    friend Double2 operator-(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_sub_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vsubq_f64(a.v, b.v));
+#else
+        return Double2(a.v[0] - b.v[0], a.v[1] - b.v[1]);
+#endif
+    }
+
+    friend Double2 operator*(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_mul_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vmulq_f64(a.v, b.v));
+#else
+        return Double2(a.v[0] * b.v[0], a.v[1] * b.v[1]);
+#endif
+    }
+
+    static Double2 sqrt(const Double2& a)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_sqrt_pd(a.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vsqrtq_f64(a.v));
+#else
+        return Double2(std::sqrt(a.v[0]), std::sqrt(a.v[1]));
+#endif
+    }
+
+    /**
+     * Returns `a < b ? a : b` in each lane, which is `std::min(b, a)`:
+     * a NaN in `a` is ignored, so a running minimum started from a
+     * non-NaN value never becomes NaN.
+     */
+    static Double2 min(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_min_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vbslq_f64(vcltq_f64(a.v, b.v), a.v, b.v));
+#else
+        return Double2(a.v[0] < b.v[0] ? a.v[0] : b.v[0],
+                       a.v[1] < b.v[1] ? a.v[1] : b.v[1]);
+#endif
+    }
+
+    /// Returns `a > b ? a : b` in each lane, which is `std::max(b, a)`.
+    static Double2 max(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_max_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vbslq_f64(vcgtq_f64(a.v, b.v), a.v, b.v));
+#else
+        return Double2(a.v[0] > b.v[0] ? a.v[0] : b.v[0],
+                       a.v[1] > b.v[1] ? a.v[1] : b.v[1]);
+#endif
+    }
+
+    /// Returns the pair `(a.first(), b.first())`.
+    static Double2 firsts(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_unpacklo_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vzip1q_f64(a.v, b.v));
+#else
+        return Double2(a.v[0], b.v[0]);
+#endif
+    }
+
+    /// Returns the pair `(a.second(), b.second())`.
+    static Double2 seconds(const Double2& a, const Double2& b)
+    {
+#if defined(GEOS_SIMD_SSE2)
+        return Double2(_mm_unpackhi_pd(a.v, b.v));
+#elif defined(GEOS_SIMD_NEON)
+        return Double2(vzip2q_f64(a.v, b.v));
+#else
+        return Double2(a.v[1], b.v[1]);
+#endif
+    }
+
+private:
+
+#if defined(GEOS_SIMD_SSE2)
+    explicit Double2(__m128d p_v) : v(p_v) {}
+    __m128d v;
+#elif defined(GEOS_SIMD_NEON)
+    explicit Double2(float64x2_t p_v) : v(p_v) {}
+    float64x2_t v;
+#else
+    double v[2];
+#endif
+
+};
+
+} // namespace geos::util
+} // namespace geos
@@ -13,6 +13,8 @@
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKTReader.h>
 // std
+#include <cmath>
+#include <limits>
 #include <string>
 #include <memory>
 
@@ -84,6 +86,28 @@ struct test_area_data {
         ensure_equals(actual1, expectedArea);
         ensure_equals(actual2, expectedArea);
     }
+
+    // Checks that a ring has the same signed area in a std::vector and in
+    // sequences of every stride, with NaN Z and M values being ignored
+    void
+    checkAreaOfRingStrides(const std::vector<Coordinate>& ring, double expectedArea)
+    {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        CoordinateSequence seqXY(0, false, false);
+        CoordinateSequence seqXYZ(0, true, false);
+        CoordinateSequence seqXYZM(0, true, true);
+        for (const Coordinate& c : ring) {
+            seqXY.add(CoordinateXY(c.x, c.y));
+            seqXYZ.add(Coordinate(c.x, c.y, 1.0));
+            seqXYZM.add(CoordinateXYZM(c.x, c.y, nan, nan));
+        }
+
+        double actual = Area::ofRingSigned(ring);
+        ensure_equals("vector", actual, expectedArea, 1e-9);
+        ensure_equals("XY", Area::ofRingSigned(&seqXY), actual);
+        ensure_equals("XYZ", Area::ofRingSigned(&seqXYZ), actual);
+        ensure_equals("XYZM", Area::ofRingSigned(&seqXYZM), actual);
+    }
 };
 
 typedef test_group<test_area_data> group;
@@ -154,6 +178,66 @@ void object::test<7>
     checkAreaOfRing("COMPOUNDCURVE (CIRCULARSTRING (0 0, 2 0, 2 1, 2 3, 4 3), (4 3, 4 5, 1 4, 0 0))", 9.321903);
 }
 
+// Rings with odd and even numbers of points, in sequences of every stride
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::vector<Coordinate> ring;
+    ring.emplace_back(0, 0);
+    ring.emplace_back(0, 100);
+    ring.emplace_back(100, 100);
+    ring.emplace_back(0, 0);
+    checkAreaOfRingStrides(ring, 5000.0);
+
+    // extra vertices along the edges of a square
+    ring = { Coordinate(0, 0), Coordinate(0, 100), Coordinate(100, 100), Coordinate(100, 0) };
+    for (double x = 90; x > 0; x -= 10) {
+        ring.emplace_back(x, 0);
+        ring.emplace_back(0, 0);
+        checkAreaOfRingStrides(ring, 10000.0);
+        ring.pop_back();
+    }
+
+    // coordinates which are not exact in binary
+    ring.clear();
+    for (std::size_t i = 0; i < 11; i++) {
+        double a = static_cast<double>(i) * 0.6;
+        ring.emplace_back(0.1 + 3.3 * std::cos(a), 0.7 + 3.3 * std::sin(a));
+        std::vector<Coordinate> closed(ring);
+        closed.push_back(ring.front());
+        checkAreaOfRingStrides(closed, Area::ofRingSigned(closed));
+    }
+}
+
+// NaN ordinates give a NaN area
+template<>
+template<>
+void object::test<9>
+()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t n = 4; n < 8; n++) {
+        for (std::size_t i = 1; i + 1 < n; i++) {
+            CoordinateSequence seq(0, true, true);
+            for (std::size_t j = 0; j + 1 < n; j++) {
+                double x = static_cast<double>(j);
+                seq.add(CoordinateXYZM(x, x * x, 0, 0));
+            }
+            CoordinateXYZM first = seq.front<CoordinateXYZM>();
+            seq.add(first);
+            seq.setOrdinate(i, CoordinateSequence::Y, nan);
+
+            ensure(std::isnan(Area::ofRingSigned(&seq)));
+
+            std::vector<Coordinate> coords;
+            seq.toVector(coords);
+            ensure(std::isnan(Area::ofRingSigned(coords)));
+        }
+    }
+}
+
 
 } // namespace tut
 
@@ -13,6 +13,8 @@
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKTReader.h>
 // std
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <memory>
@@ -86,6 +88,55 @@ void object::test<1>
     checkLengthOfLine("LINESTRING (100 200, 200 200, 200 100, 100 100, 100 200)", 400.0);
 }
 
+// Lines with odd and even numbers of points, in sequences of every stride,
+// have the length of the segments added up one by one
+template<>
+template<>
+void object::test<2>
+()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    CoordinateSequence seqXY(0, false, false);
+    CoordinateSequence seqXYZ(0, true, false);
+    CoordinateSequence seqXYZM(0, true, true);
+    double expected = 0.0;
+    for (std::size_t i = 0; i < 12; i++) {
+        double x = 0.1 * static_cast<double>(i * i);
+        double y = std::sin(static_cast<double>(i));
+        if (i > 0) {
+            const CoordinateXY& prev = seqXY.back<CoordinateXY>();
+            expected += std::sqrt((x - prev.x) * (x - prev.x) + (y - prev.y) * (y - prev.y));
+        }
+        seqXY.add(CoordinateXY(x, y));
+        seqXYZ.add(Coordinate(x, y, 1.0));
+        seqXYZM.add(CoordinateXYZM(x, y, nan, nan));
+
+        ensure_equals("XY", algorithm::Length::ofLine(&seqXY), expected);
+        ensure_equals("XYZ", algorithm::Length::ofLine(&seqXYZ), expected);
+        ensure_equals("XYZM", algorithm::Length::ofLine(&seqXYZM), expected);
+    }
+}
+
+// NaN ordinates give a NaN length
+template<>
+template<>
+void object::test<3>
+()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t n = 2; n < 7; n++) {
+        for (std::size_t i = 0; i < n; i++) {
+            CoordinateSequence seq(0, true, true);
+            for (std::size_t j = 0; j < n; j++) {
+                double x = static_cast<double>(j);
+                seq.add(CoordinateXYZM(x, x * x, 0, 0));
+            }
+            seq.setOrdinate(i, i % 2 ? CoordinateSequence::X : CoordinateSequence::Y, nan);
+            ensure(std::isnan(algorithm::Length::ofLine(&seq)));
+        }
+    }
+}
+
 
 
 } // namespace tut
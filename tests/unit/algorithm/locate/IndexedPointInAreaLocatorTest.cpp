@@ -2,18 +2,23 @@
 // geos
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/io/WKTReader.h>
+#include <geos/constants.h>
 
 // std
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 using geos::geom::CoordinateXY;
 using geos::geom::CoordinateSequence;
 using geos::geom::GeometryFactory;
 using geos::geom::Location;
 using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::io::WKTReader;
 
 namespace tut {
 //
@@ -23,6 +28,7 @@ namespace tut {
 // dummy data, not used
 struct test_indexedpointinarealocator_data {
     const GeometryFactory& factory_ = *GeometryFactory::getDefaultInstance();
+    WKTReader reader_;
 };
 
 typedef test_group<test_indexedpointinarealocator_data> group;
@@ -85,5 +91,65 @@ void object::test<1>
     ensure_equals(ipa_xyzm.locate(&pt_exterior), Location::EXTERIOR);
 }
 
+// locateMany gives the same results as locate
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto geom = reader_.read("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2)), "
+                             "((20 0, 30 5, 20 10, 25 5, 20 0)))");
+    // enough segments for the points to be located in batches
+    geom = geom->buffer(0.25, 2000);
+    ensure(geom->getNumPoints() > 5000);
+    IndexedPointInAreaLocator locator(*geom);
+
+    // grid points, and the vertices of the geometry
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = -4; i <= 64; i++) {
+        for (int j = -4; j <= 24; j++) {
+            x.push_back(0.5 * j);
+            y.push_back(0.5 * i);
+        }
+    }
+    auto vertices = geom->getCoordinates();
+    for (std::size_t i = 0; i < vertices->size(); i += 7) {
+        x.push_back(vertices->getX(i));
+        y.push_back(vertices->getY(i));
+    }
+    // points in no particular order, some of them repeated: in the hole,
+    // in the interior (including vertices of the rings before buffering),
+    // near the buffered boundary, in the notch of the second polygon,
+    // and far outside
+    auto points = reader_.read("MULTIPOINT ((5 5), (25 5), (1 1), (5 5), (50 50), (9 1), (22 5), "
+                               "(0 0), (8 8), (1 1), (-3 12), (25 5), (10.25 5), (2 5), (30 5), (5 5), "
+                               "(21 2), (-0.25 5), (15 5), (0 0))");
+    auto pointCoords = points->getCoordinates();
+    for (std::size_t i = 0; i < pointCoords->size(); i++) {
+        x.push_back(pointCoords->getX(i));
+        y.push_back(pointCoords->getY(i));
+    }
+    x.push_back(5);
+    y.push_back(geos::DoubleNotANumber);
+
+    std::vector<Location> locations(x.size());
+    locator.locateMany(x.data(), y.data(), x.size(), locations.data());
+
+    for (std::size_t i = 0; i < x.size(); i++) {
+        CoordinateXY pt(x[i], y[i]);
+        ensure_equals(locations[i], locator.locate(&pt));
+    }
+
+    CoordinateSequence seq(0u, false, false);
+    for (std::size_t i = 0; i + 1 < x.size(); i++) {
+        seq.add(CoordinateXY(x[i], y[i]));
+    }
+    std::vector<Location> seqLocations(seq.size());
+    locator.locateMany(seq, seqLocations.data());
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        ensure_equals(seqLocations[i], locations[i]);
+    }
 }
 
+}
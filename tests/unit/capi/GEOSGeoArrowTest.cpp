@@ -0,0 +1,132 @@
+//
+// Test Suite for C-API GEOSGeoArrow_read and GEOSGeoArrow_write
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capigeosgeoarrow_data : public capitest::utility {};
+
+typedef test_group<test_capigeosgeoarrow_data> group;
+typedef group::object object;
+
+group test_capigeosgeoarrow_group("capi::GEOSGeoArrow");
+
+//
+// Test Cases
+//
+
+// Read polygons from GeoArrow buffers
+template<>
+template<>
+void object::test<1>
+()
+{
+    double coords[] = { 0, 0, 10, 0, 10, 10, 0, 0,
+                        1, 1, 2, 1, 2, 2, 1, 1,
+                        5, 5, 6, 5, 6, 6, 5, 5 };
+    int32_t geomOffsets[] = { 0, 2, 2, 3 };
+    int32_t ringOffsets[] = { 0, 4, 8, 12 };
+
+    GEOSGeometry* geoms[3];
+    int ret = GEOSGeoArrow_read(GEOS_POLYGON, 0, 0, coords, 12, geomOffsets, nullptr, ringOffsets, 3, geoms);
+    ensure_equals(ret, 1);
+
+    expected_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+    ensure_geometry_equals_identical(geoms[0], expected_);
+    ensure(GEOSisEmpty(geoms[1]));
+    ensure_equals(GEOSGeomTypeId(geoms[1]), GEOS_POLYGON);
+    ensure_equals(GEOSGetNumCoordinates(geoms[2]), 4);
+
+    for (GEOSGeometry* g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
+
+// Write multilinestrings to GeoArrow buffers and read them back
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = fromWKT("LINESTRING Z (0 0 1, 1 1 2)");
+    geom2_ = fromWKT("MULTILINESTRING Z ((5 5 5, 6 6 6), (7 7 7, 8 8 8, 9 9 9))");
+    const GEOSGeometry* input[] = { geom1_, geom2_ };
+
+    int geomType, hasZ, hasM;
+    double* coords;
+    size_t ncoords;
+    int32_t* geomOffsets;
+    int32_t* partOffsets;
+    int32_t* ringOffsets;
+
+    int ret = GEOSGeoArrow_write(input, 2, &geomType, &hasZ, &hasM, &coords, &ncoords,
+                                 &geomOffsets, &partOffsets, &ringOffsets);
+    ensure_equals(ret, 1);
+    ensure_equals(geomType, GEOS_MULTILINESTRING);
+    ensure_equals(hasZ, 1);
+    ensure_equals(hasM, 0);
+    ensure_equals(ncoords, 7u);
+    ensure(ringOffsets == nullptr);
+    ensure_equals(geomOffsets[2], 3);
+    ensure_equals(partOffsets[3], 7);
+    ensure_equals(coords[20], 9);
+
+    GEOSGeometry* geoms[2];
+    ret = GEOSGeoArrow_read(geomType, hasZ, hasM, coords, ncoords, geomOffsets, partOffsets, ringOffsets, 2, geoms);
+    ensure_equals(ret, 1);
+
+    expected_ = fromWKT("MULTILINESTRING Z ((0 0 1, 1 1 2))");
+    ensure_geometry_equals_identical(geoms[0], expected_);
+    ensure_geometry_equals_identical(geoms[1], geom2_);
+
+    GEOSGeom_destroy(geoms[0]);
+    GEOSGeom_destroy(geoms[1]);
+    GEOSFree(coords);
+    GEOSFree(geomOffsets);
+    GEOSFree(partOffsets);
+}
+
+// Errors are reported by the return value
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = fromWKT("POINT (1 1)");
+    geom2_ = fromWKT("LINESTRING (0 0, 1 1)");
+    const GEOSGeometry* input[] = { geom1_, geom2_ };
+
+    int geomType, hasZ, hasM;
+    double* coords;
+    size_t ncoords;
+    int32_t* geomOffsets;
+    int32_t* partOffsets;
+    int32_t* ringOffsets;
+
+    int ret = GEOSGeoArrow_write(input, 2, &geomType, &hasZ, &hasM, &coords, &ncoords,
+                                 &geomOffsets, &partOffsets, &ringOffsets);
+    ensure_equals(ret, 0);
+
+    double xy[] = { 0, 0, 1, 1 };
+    int32_t offsets[] = { 0, 3, 2 };
+    GEOSGeometry* geoms[2];
+    ret = GEOSGeoArrow_read(GEOS_LINESTRING, 0, 0, xy, 2, offsets, nullptr, nullptr, 2, geoms);
+    ensure_equals(ret, 0);
+
+    // offsets beyond the coordinates
+    int32_t beyond[] = { 0, 3 };
+    ret = GEOSGeoArrow_read(GEOS_LINESTRING, 0, 0, xy, 2, beyond, nullptr, nullptr, 1, geoms);
+    ensure_equals(ret, 0);
+    ret = GEOSGeoArrow_read(GEOS_POINT, 0, 0, xy, 1, nullptr, nullptr, nullptr, 2, geoms);
+    ensure_equals(ret, 0);
+}
+
+} // namespace tut
@@ -9,6 +9,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <string>
 
 #include "capi_test_utils.h"
 
@@ -201,6 +202,38 @@ void object::test<5>
     finishGEOS();
 }
 
+/// Test interrupting an operation running on several threads
+template<>
+template<>
+void object::test<6>
+()
+{
+    initGEOS(notice, notice);
 
-} // namespace tut
+    std::string wkt = "MULTIPOLYGON (";
+    for (int i = 0; i < 64; i++) {
+        std::string x0 = std::to_string(i);
+        std::string x1 = std::to_string(i + 2);
+        wkt += (i ? ", " : "") + std::string("((") + x0 + " 0, " + x1 + " 0, " + x1 + " 2, " + x0 + " 2, " + x0 + " 0))";
+    }
+    wkt += ")";
+    GEOSGeometry* geom1 = GEOSGeomFromWKT(wkt.c_str());
+
+    ensure("GEOSGeomFromWKT failed", nullptr != geom1);
+
+    GEOS_interruptRegisterCallback(interruptNow);
+    GEOSGeometry* geom2 = GEOSUnaryUnionParallel(geom1, 4);
+    ensure("GEOSUnaryUnionParallel wasn't interrupted", nullptr == geom2);
+    GEOS_interruptRegisterCallback(nullptr);  /* unregister */
+
+    // the request was consumed by the thread which saw it
+    geom2 = GEOSUnaryUnionParallel(geom1, 4);
+    ensure(nullptr != geom2);
+
+    GEOSGeom_destroy(geom1);
+    GEOSGeom_destroy(geom2);
 
+    finishGEOS();
+}
+
+} // namespace tut
@@ -12,6 +12,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -485,5 +486,62 @@ void object::test<17>()
     GEOSFree(r2);
 }
 
+template<>
+template<>
+void object::test<18>()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    // Several blocks of 1024 points, so that the batches are split
+    // between the threads
+    std::vector<GEOSGeometry*> pts;
+    std::vector<double> xs, ys;
+    for (int i = -4; i <= 44; i++) {
+        for (int j = -8; j <= 88; j++) {
+            xs.push_back(i * 0.25);
+            ys.push_back(j * 0.125);
+            pts.push_back(GEOSGeom_createPointFromXY(xs.back(), ys.back()));
+        }
+    }
+
+    std::vector<char> expected, results(xs.size());
+
+    for (GEOSGeometry* pt : pts) {
+        expected.push_back(GEOSPreparedIntersects(prepGeom1_, pt));
+    }
+    ensure_equals(GEOSPreparedIntersectsMany(prepGeom1_, pts.data(), static_cast<unsigned int>(pts.size()), results.data(), 2), 1);
+    ensure(results == expected);
+    ensure_equals(GEOSPreparedIntersectsXYMany(prepGeom1_, xs.data(), ys.data(), static_cast<unsigned int>(xs.size()), results.data(), 2), 1);
+    ensure(results == expected);
+
+    expected.clear();
+    for (GEOSGeometry* pt : pts) {
+        expected.push_back(GEOSPreparedContains(prepGeom1_, pt));
+    }
+    ensure_equals(GEOSPreparedContainsMany(prepGeom1_, pts.data(), static_cast<unsigned int>(pts.size()), results.data(), 3), 1);
+    ensure(results == expected);
+    ensure_equals(GEOSPreparedContainsXYMany(prepGeom1_, xs.data(), ys.data(), static_cast<unsigned int>(xs.size()), results.data(), 3), 1);
+    ensure(results == expected);
+
+    expected.clear();
+    for (GEOSGeometry* pt : pts) {
+        expected.push_back(GEOSPreparedContainsProperly(prepGeom1_, pt));
+    }
+    ensure_equals(GEOSPreparedContainsProperlyMany(prepGeom1_, pts.data(), static_cast<unsigned int>(pts.size()), results.data(), 0), 1);
+    ensure(results == expected);
+
+    expected.clear();
+    for (GEOSGeometry* pt : pts) {
+        expected.push_back(GEOSPreparedCovers(prepGeom1_, pt));
+    }
+    ensure_equals(GEOSPreparedCoversMany(prepGeom1_, pts.data(), static_cast<unsigned int>(pts.size()), results.data(), 4), 1);
+    ensure(results == expected);
+
+    for (GEOSGeometry* pt : pts) {
+        GEOSGeom_destroy(pt);
+    }
+}
+
 } // namespace tut
 
@@ -6,6 +6,7 @@
 #include <geos_c.h>
 #include <geos/constants.h>
 // std
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
@@ -507,6 +508,107 @@ void object::test<14>()
 }
 
 
+// GEOSSTRtree_buildParallel and GEOSSTRtree_queryBatch give the same
+// results as GEOSSTRtree_query
+template<>
+template<>
+void object::test<15>()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(10);
+    std::vector<GEOSGeometry*> geoms;
+
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 100; j++) {
+            geoms.push_back(GEOSGeom_createPointFromXY(i, j));
+            GEOSSTRtree_insert(tree, geoms.back(), geoms.back());
+        }
+    }
+
+    ensure_equals(GEOSSTRtree_buildParallel(tree, 4), 1);
+
+    std::vector<GEOSGeometry*> queries;
+    for (int i = 0; i < 20; i++) {
+        queries.push_back(GEOSGeom_createRectangle(i * 5, i * 3, i * 5 + 2.5, i * 3 + 4.5));
+    }
+
+    std::vector<std::vector<const void*>> batchHits(queries.size());
+    ensure_equals(GEOSSTRtree_queryBatch(tree, queries.data(), static_cast<unsigned int>(queries.size()),
+                                         [](void* item, unsigned int index, void* userdata) {
+        auto& hits = *static_cast<std::vector<std::vector<const void*>>*>(userdata);
+        hits[index].push_back(item);
+    }, &batchHits, 3), 1);
+
+    for (std::size_t q = 0; q < queries.size(); q++) {
+        std::vector<const void*> expected;
+        GEOSSTRtree_query(tree, queries[q], [](void* item, void* userdata) {
+            static_cast<std::vector<const void*>*>(userdata)->push_back(item);
+        }, &expected);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(batchHits[q].begin(), batchHits[q].end());
+
+        ensure_equals(expected.size(), 15u);
+        ensure(expected == batchHits[q]);
+    }
+
+    for (auto& g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    for (auto& g : queries) {
+        GEOSGeom_destroy(g);
+    }
+
+    GEOSSTRtree_destroy(tree);
+}
+
+// A tree restored with GEOSSTRtree_load gives the same results as
+// the tree saved with GEOSSTRtree_save
+template<>
+template<>
+void object::test<16>()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(10);
+    std::vector<GEOSGeometry*> geoms;
+
+    for (std::intptr_t i = 0; i < 1000; i++) {
+        geoms.push_back(GEOSGeom_createPointFromXY(static_cast<double>(i % 40), static_cast<double>(i / 40)));
+        GEOSSTRtree_insert(tree, geoms.back(), reinterpret_cast<void*>(i + 1));
+    }
+
+    std::size_t size;
+    unsigned char* buf = GEOSSTRtree_save(tree, &size);
+    ensure(buf != nullptr);
+
+    GEOSSTRtree* loaded = GEOSSTRtree_load(buf, size);
+    ensure(loaded != nullptr);
+
+    ensure(GEOSSTRtree_load(buf, size / 2) == nullptr);
+
+    GEOSGeometry* query = GEOSGeom_createRectangle(3.5, 4.5, 10.5, 7.5);
+
+    auto collect = [](void* item, void* userdata) {
+        static_cast<std::vector<std::intptr_t>*>(userdata)->push_back(reinterpret_cast<std::intptr_t>(item));
+    };
+    std::vector<std::intptr_t> expected;
+    std::vector<std::intptr_t> actual;
+    GEOSSTRtree_query(tree, query, collect, &expected);
+    GEOSSTRtree_query(loaded, query, collect, &actual);
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+
+    ensure_equals(expected.size(), 21u);
+    ensure(expected == actual);
+
+    GEOSFree(buf);
+    GEOSGeom_destroy(query);
+    for (auto& g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    GEOSSTRtree_destroy(tree);
+    GEOSSTRtree_destroy(loaded);
+}
+
 } // namespace tut
 
 
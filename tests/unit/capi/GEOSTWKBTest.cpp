@@ -0,0 +1,119 @@
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geostwkb_data : public capitest::utility {
+
+    test_geostwkb_data() :
+        reader_(GEOSTWKBReader_create()),
+        writer_(GEOSTWKBWriter_create()),
+        buf_(nullptr)
+    {}
+
+    ~test_geostwkb_data() {
+        GEOSTWKBReader_destroy(reader_);
+        GEOSTWKBWriter_destroy(writer_);
+        GEOSFree(buf_);
+    }
+
+    GEOSTWKBReader* reader_;
+    GEOSTWKBWriter* writer_;
+    unsigned char* buf_;
+};
+
+typedef test_group<test_geostwkb_data> group;
+typedef group::object object;
+
+group test_geostwkb("capi::GEOSTWKB");
+
+// Writing with default settings
+template<>
+template<>
+void object::test<1>()
+{
+    input_ = fromWKT("LINESTRING (1 1, 5 5)");
+    std::size_t size = 0;
+    buf_ = GEOSTWKBWriter_write(writer_, input_, &size);
+    ensure(buf_ != nullptr);
+    ensure_equals(std::string(reinterpret_cast<char*>(buf_), size),
+                  std::string("\x02\x00\x02\x02\x02\x08\x08", 7));
+}
+
+// Round trip with precision, bounding box and size
+template<>
+template<>
+void object::test<2>()
+{
+    input_ = fromWKT("POLYGON Z ((0 0 1, 10.25 0 2, 10 10.5 3, 0 0 1))");
+    GEOSTWKBWriter_setPrecision(writer_, 2, 1, 0);
+    GEOSTWKBWriter_setIncludeBBox(writer_, 1);
+    GEOSTWKBWriter_setIncludeSize(writer_, 1);
+
+    std::size_t size = 0;
+    buf_ = GEOSTWKBWriter_write(writer_, input_, &size);
+    ensure(buf_ != nullptr);
+
+    result_ = GEOSTWKBReader_read(reader_, buf_, size);
+    ensure(result_ != nullptr);
+    ensure_equals(GEOSHasZ(result_), 1);
+    ensure_geometry_equals_identical(result_, input_);
+}
+
+// Output dimension
+template<>
+template<>
+void object::test<3>()
+{
+    input_ = fromWKT("POINT ZM (1 2 3 4)");
+    GEOSTWKBWriter_setOutputDimension(writer_, 2);
+
+    std::size_t size = 0;
+    buf_ = GEOSTWKBWriter_write(writer_, input_, &size);
+    ensure(buf_ != nullptr);
+
+    result_ = GEOSTWKBReader_read(reader_, buf_, size);
+    expected_ = fromWKT("POINT (1 2)");
+    ensure_geometry_equals_identical(result_, expected_);
+}
+
+// Errors
+template<>
+template<>
+void object::test<4>()
+{
+    const unsigned char truncated[] = { 0x02, 0x00, 0x02, 0x02 };
+    ensure(GEOSTWKBReader_read(reader_, truncated, sizeof(truncated)) == nullptr);
+
+    input_ = fromWKT("POINT (1e30 0)");
+    std::size_t size = 0;
+    ensure(GEOSTWKBWriter_write(writer_, input_, &size) == nullptr);
+}
+
+// An invalid precision leaves all precisions unchanged
+template<>
+template<>
+void object::test<5>()
+{
+    GEOSTWKBWriter_setPrecision(writer_, 2, 8, 0);
+
+    input_ = fromWKT("POINT (1.25 2.5)");
+    std::size_t size = 0;
+    buf_ = GEOSTWKBWriter_write(writer_, input_, &size);
+    ensure(buf_ != nullptr);
+
+    // written with the default of no decimal places
+    result_ = GEOSTWKBReader_read(reader_, buf_, size);
+    expected_ = fromWKT("POINT (1 3)");
+    ensure_geometry_equals_identical(result_, expected_);
+}
+
+} // namespace tut
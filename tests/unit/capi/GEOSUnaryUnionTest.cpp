@@ -9,6 +9,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -231,6 +232,29 @@ void object::test<12>()
 }
 
 
+template<>
+template<>
+void object::test<13>()
+{
+    std::vector<GEOSGeometry*> discs;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            GEOSGeometry* pt = GEOSGeom_createPointFromXY(i, j);
+            discs.push_back(GEOSBuffer(pt, 0.7, 8));
+            GEOSGeom_destroy(pt);
+        }
+    }
+    input_ = GEOSGeom_createCollection(GEOS_MULTIPOLYGON, discs.data(), static_cast<unsigned int>(discs.size()));
+    GEOSSetSRID(input_, 4326);
+
+    expected_ = GEOSUnaryUnion(input_);
+    result_ = GEOSUnaryUnionParallel(input_, 4);
+
+    ensure(result_);
+    ensure_equals(GEOSEqualsIdentical(result_, expected_), 1);
+    ensure_equals(GEOSGetSRID(result_), 4326);
+}
+
 } // namespace tut
 
 
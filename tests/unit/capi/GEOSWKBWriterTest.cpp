@@ -5,6 +5,9 @@
 
 #include "capi_test_utils.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace tut {
 //
 // Test Group
@@ -186,5 +189,57 @@ void object::test<9>()
     ensure_equals(hexstr, "010100008000000000000008400000000000002040000000000000F03F");
 }
 
+// Write into a reused buffer
+template<>
+template<>
+void object::test<10>()
+{
+    geom1_ = fromWKT("LINESTRING (1 2, 3 4)");
+
+    std::size_t expected_size = 0;
+    buf_ = GEOSWKBWriter_write(wkbwriter_, geom1_, &expected_size);
+
+    unsigned char small[8];
+    ensure_equals(GEOSWKBWriter_writeToBuffer(wkbwriter_, geom1_, small, sizeof(small)), expected_size);
+    ensure_equals(GEOSWKBWriter_writeToBuffer(wkbwriter_, geom1_, nullptr, 0), expected_size);
+
+    std::vector<unsigned char> buf(64);
+    ensure_equals(GEOSWKBWriter_writeToBuffer(wkbwriter_, geom1_, buf.data(), buf.size()), expected_size);
+    ensure(std::equal(buf_, buf_ + expected_size, buf.begin()));
+}
+
+// Write several geometries into one buffer
+template<>
+template<>
+void object::test<11>()
+{
+    geom1_ = fromWKT("POINT (3 8)");
+    geom2_ = fromWKT("POLYGON Z ((0 0 1, 1 0 1, 0 1 1, 0 0 1))");
+    geom3_ = fromWKT("GEOMETRYCOLLECTION EMPTY");
+    const GEOSGeometry* geoms[] = { geom1_, geom2_, geom3_ };
+
+    std::size_t offsets[4];
+    std::size_t size = 0;
+    buf_ = GEOSWKBWriter_writeMany(wkbwriter_, geoms, 3, offsets, &size);
+    ensure(buf_ != nullptr);
+    ensure_equals(offsets[0], 0u);
+    ensure_equals(offsets[3], size);
+
+    for (std::size_t i = 0; i < 3; i++) {
+        std::size_t geom_size = 0;
+        unsigned char* wkb = GEOSWKBWriter_write(wkbwriter_, geoms[i], &geom_size);
+        ensure_equals(offsets[i + 1] - offsets[i], geom_size);
+        ensure(std::equal(wkb, wkb + geom_size, buf_ + offsets[i]));
+        GEOSFree(wkb);
+    }
+
+    GEOSFree(buf_);
+    buf_ = GEOSWKBWriter_writeMany(wkbwriter_, geoms, 0, offsets, &size);
+    ensure(buf_ != nullptr);
+    ensure_equals(size, 0u);
+    ensure_equals(offsets[0], 0u);
+}
+
+
 } // namespace tut
 
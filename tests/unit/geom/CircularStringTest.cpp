@@ -175,4 +175,22 @@ void object::test<4>()
     ensure("isCoordinate", cs_->isCoordinate(pt));
 }
 
+// The envelope covers the arcs, which share their endpoints
+template<>
+template<>
+void object::test<5>()
+{
+    // (1 1, 2 0, 4 2) is not an arc of the string, and would
+    // extend the envelope below y = 0
+    auto cs = wktreader_.read("CIRCULARSTRING (0 0, 1 1, 2 0, 4 2, 6 0)");
+    geos::geom::Envelope expected(0, 6, 0, 2);
+    ensure_equals(*cs->getEnvelopeInternal(), expected);
+
+    auto env = cs->getEnvelope();
+    auto expectedEnv = wktreader_.read("POLYGON ((0 0, 6 0, 6 2, 0 2, 0 0))");
+    ensure(env->toText(), env->equalsExact(expectedEnv.get()));
+
+    ensure_equals(*cs_->getEnvelope()->getEnvelopeInternal(), geos::geom::Envelope(0, 4, -1, 1));
+}
+
 }
@@ -0,0 +1,119 @@
+//
+// Test Suite for geos::geom::CoordinateColumns class.
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateColumns.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/constants.h>
+// std
+#include <cmath>
+
+using geos::algorithm::Area;
+using geos::algorithm::Length;
+using geos::geom::CoordinateColumns;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::CoordinateXYZM;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_coordinatecolumns_data {
+    // A closed ring of n points with irregular coordinates
+    static CoordinateSequence ring(std::size_t n, bool hasZ, bool hasM) {
+        CoordinateSequence seq(0u, hasZ, hasM);
+        for (std::size_t i = 0; i + 1 < n; i++) {
+            double a = 2 * 3.14159265358979 * static_cast<double>(i) / static_cast<double>(n - 1);
+            double r = 10 + static_cast<double>(i % 7) / 3;
+            seq.add(CoordinateXYZM(r * std::cos(a) + 1000.125, r * std::sin(a) - 250.5,
+                                   static_cast<double>(i), -static_cast<double>(i)));
+        }
+        seq.add(seq.front<CoordinateXYZM>());
+        return seq;
+    }
+
+    static bool sameOrdinate(double a, double b) {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    }
+};
+
+typedef test_group<test_coordinatecolumns_data> group;
+typedef group::object object;
+
+group test_coordinatecolumns_group("geos::geom::CoordinateColumns");
+
+//
+// Test Cases
+//
+
+// Columns hold the ordinates of the sequence, for all dimensions
+template<>
+template<>
+void object::test<1>
+()
+{
+    for (bool hasZ : { false, true }) {
+        for (bool hasM : { false, true }) {
+            auto seq = ring(20, hasZ, hasM);
+            CoordinateColumns cols(seq);
+
+            ensure_equals(cols.size(), seq.size());
+            ensure_equals(cols.hasZ(), hasZ);
+            ensure_equals(cols.hasM(), hasM);
+            ensure_equals(cols.z() != nullptr, hasZ);
+            ensure_equals(cols.m() != nullptr, hasM);
+
+            for (std::size_t i = 0; i < seq.size(); i++) {
+                CoordinateXYZM c;
+                seq.getAt(i, c);
+                ensure_equals(cols.x()[i], c.x);
+                ensure_equals(cols.y()[i], c.y);
+                if (hasZ) {
+                    ensure_equals(cols.z()[i], c.z);
+                }
+                if (hasM) {
+                    ensure_equals(cols.m()[i], c.m);
+                }
+            }
+
+            // copyToArrays fills missing ordinates with NaN
+            std::vector<double> x(seq.size()), y(seq.size()), z(seq.size()), m(seq.size());
+            CoordinateColumns::copyToArrays(seq, x.data(), y.data(), z.data(), m.data());
+            for (std::size_t i = 0; i < seq.size(); i++) {
+                CoordinateXYZM c;
+                seq.getAt(i, c);
+                ensure(sameOrdinate(x[i], c.x));
+                ensure(sameOrdinate(y[i], c.y));
+                ensure(sameOrdinate(z[i], c.z));
+                ensure(sameOrdinate(m[i], c.m));
+            }
+        }
+    }
+}
+
+// Kernels on columns give the same results as on the sequence
+template<>
+template<>
+void object::test<2>
+()
+{
+    for (std::size_t n : { 0u, 1u, 2u, 4u, 5u, 100u, 1001u }) {
+        CoordinateSequence seq = n < 4 ? CoordinateSequence(0u, false, false) : ring(n, false, false);
+        for (std::size_t i = seq.size(); i < n; i++) {
+            seq.add(CoordinateXY(static_cast<double>(i), static_cast<double>(i * i)));
+        }
+        CoordinateColumns cols(seq);
+
+        ensure(cols.getEnvelope() == seq.getEnvelope());
+        ensure_equals(Area::ofRingSigned(cols), Area::ofRingSigned(&seq));
+        ensure_equals(Length::ofLine(cols), Length::ofLine(&seq));
+    }
+}
+
+} // namespace tut
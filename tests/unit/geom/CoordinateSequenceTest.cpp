@@ -6,6 +6,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
 #include <geos/util.h>
 #include <geos/constants.h>
 #include <utility.h>
@@ -21,6 +22,7 @@ using geos::geom::CoordinateXY;
 using geos::geom::CoordinateXYM;
 using geos::geom::CoordinateXYZM;
 using geos::geom::CoordinateSequence;
+using geos::geom::Envelope;
 
 constexpr const int MAX_TESTS = 100;
 
@@ -1536,4 +1538,81 @@ void object::test<56>
     ensure_equals_xyz(seq1.getAt(3), Coordinate{10, 11, DoubleNotANumber});
 }
 
+// getEnvelope and expandEnvelope of sequences of every stride,
+// with odd and even numbers of coordinates
+template<>
+template<>
+void object::test<57>
+()
+{
+    CoordinateSequence xy = CoordinateSequence::XY(0);
+    CoordinateSequence xyz = CoordinateSequence::XYZ(0);
+    CoordinateSequence xyzm = CoordinateSequence::XYZM(0);
+    Envelope expected;
+    for (std::size_t i = 0; i < 9; i++) {
+        double x = std::sin(static_cast<double>(i)) * 10;
+        double y = std::cos(static_cast<double>(i) * 3) * 5;
+        expected.expandToInclude(x, y);
+        xy.add(CoordinateXY(x, y));
+        xyz.add(Coordinate(x, y, -100));
+        xyzm.add(CoordinateXYZM(x, y, 100, DoubleNotANumber));
+
+        for (const CoordinateSequence* seq : { &xy, &xyz, &xyzm }) {
+            ensure_equals(seq->getEnvelope(), expected);
+
+            Envelope env;
+            seq->expandEnvelope(env);
+            ensure_equals(env, expected);
+
+            Envelope env2(20, 30, 20, 30);
+            seq->expandEnvelope(env2);
+            ensure_equals(env2, Envelope(expected.getMinX(), 30, expected.getMinY(), 30));
+        }
+    }
+}
+
+// expandEnvelope skips NaN ordinates as Envelope::expandToInclude does
+template<>
+template<>
+void object::test<58>
+()
+{
+    CoordinateSequence allNaN{CoordinateXY(DoubleNotANumber, DoubleNotANumber),
+                              CoordinateXY(DoubleNotANumber, DoubleNotANumber),
+                              CoordinateXY(DoubleNotANumber, DoubleNotANumber)};
+    Envelope env;
+    allNaN.expandEnvelope(env);
+    ensure(env.isNull());
+
+    Envelope env2(1, 2, 3, 4);
+    allNaN.expandEnvelope(env2);
+    ensure_equals(env2, Envelope(1, 2, 3, 4));
+
+    for (std::size_t n = 1; n < 6; n++) {
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t ord = 0; ord < 2; ord++) {
+                CoordinateSequence seq = CoordinateSequence::XYZ(0);
+                for (std::size_t j = 0; j < n; j++) {
+                    double v = static_cast<double>(j);
+                    seq.add(Coordinate(v, v * 2, DoubleNotANumber));
+                }
+                seq.setOrdinate(i, ord, DoubleNotANumber);
+
+                for (const Envelope& start : { Envelope(), Envelope(-1, -1, -1, -1) }) {
+                    Envelope expected(start);
+                    for (std::size_t j = 0; j < n; j++) {
+                        expected.expandToInclude(seq.getAt<CoordinateXY>(j));
+                    }
+                    Envelope actual(start);
+                    seq.expandEnvelope(actual);
+                    ensure_same(actual.getMinX(), expected.getMinX());
+                    ensure_same(actual.getMaxX(), expected.getMaxX());
+                    ensure_same(actual.getMinY(), expected.getMinY());
+                    ensure_same(actual.getMaxY(), expected.getMaxY());
+                }
+            }
+        }
+    }
+}
+
 } // namespace tut
@@ -8,10 +8,14 @@
 #include <geos/geom/prep/PreparedGeometryFactory.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/IntersectionMatrix.h>
 #include <geos/geom/Geometry.h>
 #include <geos/io/WKTReader.h>
 // std
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace geos::geom;
 using geos::geom::prep::PreparedGeometry;
@@ -100,4 +104,137 @@ void object::test<3>
 }
 
 
+// Batch predicates give the same results as individual calls
+template<>
+template<>
+void object::test<4>
+()
+{
+    g1 = reader.read( "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))" );
+    const char* lineWkt = "LINESTRING (-1 5, 11 5)";
+    g2 = reader.read( lineWkt );
+
+    // Several blocks of 1024 items, so that the batches are split
+    // between the threads
+    std::vector<std::unique_ptr<Geometry>> owned;
+    std::vector<double> xs, ys;
+    for (int i = -8; i <= 48; i++) {
+        for (int j = -16; j <= 96; j++) {
+            xs.push_back(i * 0.25);
+            ys.push_back(j * 0.125 + 0.25);
+            owned.push_back(factory->createPoint(CoordinateXY(xs.back(), ys.back())));
+        }
+    }
+    owned.push_back(g2->clone());
+
+    std::vector<const Geometry*> geoms;
+    for (const auto& g : owned) {
+        geoms.push_back(g.get());
+    }
+    const std::size_t n = geoms.size();
+
+    for (const auto& wkt : { "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))",
+                             "LINESTRING (0 0.25, 10 0.25)",
+                             "MULTIPOINT ((3 0.25), (5 5.25))" }) {
+        g1 = reader.read(wkt);
+        pg1 = prep::PreparedGeometryFactory::prepare(g1.get());
+
+        for (std::size_t numThreads : { 1u, 3u }) {
+            std::unique_ptr<bool[]> res(new bool[n]);
+
+            pg1->intersectsMany(geoms.data(), n, res.get(), numThreads);
+            for (std::size_t i = 0; i < n; i++) {
+                ensure_equals(res[i], pg1->intersects(geoms[i]));
+            }
+
+            pg1->containsMany(geoms.data(), n, res.get(), numThreads);
+            for (std::size_t i = 0; i < n; i++) {
+                ensure_equals(res[i], pg1->contains(geoms[i]));
+            }
+
+            pg1->containsProperlyMany(geoms.data(), n, res.get(), numThreads);
+            for (std::size_t i = 0; i < n; i++) {
+                ensure_equals(res[i], pg1->containsProperly(geoms[i]));
+            }
+
+            pg1->coversMany(geoms.data(), n, res.get(), numThreads);
+            for (std::size_t i = 0; i < n; i++) {
+                ensure_equals(res[i], pg1->covers(geoms[i]));
+            }
+
+            pg1->intersectsXYMany(xs.data(), ys.data(), xs.size(), res.get(), numThreads);
+            for (std::size_t i = 0; i < xs.size(); i++) {
+                ensure_equals(res[i], pg1->intersects(geoms[i]));
+            }
+
+            pg1->containsXYMany(xs.data(), ys.data(), xs.size(), res.get(), numThreads);
+            for (std::size_t i = 0; i < xs.size(); i++) {
+                ensure_equals(res[i], pg1->contains(geoms[i]));
+            }
+        }
+    }
+}
+
+// A single PreparedGeometry can be used concurrently from several threads,
+// including its first use, and for the predicates evaluated with RelateNG.
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> owned;
+    for (int i = -2; i <= 12; i++) {
+        owned.push_back(reader.read("LINESTRING (" + std::to_string(i) + " -1, " + std::to_string(i + 1) + " 11)"));
+        owned.push_back(factory->createPoint(CoordinateXY(i, i * 0.5 + 0.25)));
+    }
+
+    for (const auto& wkt : { "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))",
+                             "LINESTRING (0 0.25, 10 0.25, 10 10)" }) {
+        g1 = reader.read(wkt);
+
+        // expected results, from a preparation used by this thread only
+        auto serial = prep::PreparedGeometryFactory::prepare(g1.get());
+        std::vector<bool> expectedIntersects, expectedContains, expectedCovers;
+        std::vector<double> expectedDistance;
+        std::vector<std::string> expectedRelate;
+        for (const auto& g : owned) {
+            expectedIntersects.push_back(serial->intersects(g.get()));
+            expectedContains.push_back(serial->contains(g.get()));
+            expectedCovers.push_back(serial->covers(g.get()));
+            expectedDistance.push_back(serial->distance(g.get()));
+            expectedRelate.push_back(serial->relate(g.get())->toString());
+        }
+
+        pg1 = prep::PreparedGeometryFactory::prepare(g1.get());
+
+        constexpr std::size_t numThreads = 4;
+        std::vector<int> failures(numThreads, 0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < numThreads; t++) {
+            threads.emplace_back([this, t, &owned, &failures, &expectedIntersects,
+                                  &expectedContains, &expectedCovers, &expectedDistance,
+                                  &expectedRelate]() {
+                for (int repeat = 0; repeat < 10; repeat++) {
+                    for (std::size_t i = 0; i < owned.size(); i++) {
+                        std::size_t j = (i + t) % owned.size();
+                        const Geometry* g = owned[j].get();
+                        if (pg1->intersects(g) != expectedIntersects[j]) failures[t]++;
+                        if (pg1->contains(g) != expectedContains[j]) failures[t]++;
+                        if (pg1->covers(g) != expectedCovers[j]) failures[t]++;
+                        if (pg1->distance(g) != expectedDistance[j]) failures[t]++;
+                        if (pg1->relate(g)->toString() != expectedRelate[j]) failures[t]++;
+                    }
+                }
+            });
+        }
+        for (auto& th : threads) {
+            th.join();
+        }
+
+        for (std::size_t t = 0; t < numThreads; t++) {
+            ensure_equals(failures[t], 0);
+        }
+    }
+}
+
 } // namespace tut
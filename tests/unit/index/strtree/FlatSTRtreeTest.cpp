@@ -0,0 +1,183 @@
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/FlatSTRtree.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using geos::geom::Envelope;
+using geos::index::strtree::FlatSTRtree;
+using geos::index::strtree::TemplateSTRtree;
+
+namespace tut {
+
+struct test_flatstrtree_data {
+    using Tree = TemplateSTRtree<std::int64_t>;
+
+    static void fill(Tree& tree, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) {
+            double x = static_cast<double>((i * 7919) % 1000);
+            double y = static_cast<double>((i * 104729) % 1000);
+            tree.insert(Envelope(x, x + 3, y, y + 3), static_cast<std::int64_t>(i));
+        }
+    }
+
+    template<typename T>
+    static std::vector<std::int64_t> hits(T& tree, const Envelope& env) {
+        std::vector<std::int64_t> ret;
+        tree.query(env, [&ret](const std::int64_t& item) {
+            ret.push_back(item);
+        });
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+    // copy serialized bytes into 8-byte aligned storage
+    static std::vector<std::uint64_t> aligned(const std::vector<unsigned char>& buf) {
+        std::vector<std::uint64_t> ret((buf.size() + 7) / 8);
+        std::memcpy(ret.data(), buf.data(), buf.size());
+        return ret;
+    }
+};
+
+using group = test_group<test_flatstrtree_data>;
+using object = group::object;
+group test_flatstrtree_group("geos::index::strtree::FlatSTRtree");
+
+//
+// Test Cases
+//
+
+// Queries on the serialized tree, and on a tree loaded from it,
+// match queries on the original tree
+template<>
+template<>
+void object::test<1>()
+{
+    for (std::size_t n : { 0u, 1u, 2u, 10u, 11u, 1000u, 20000u }) {
+        Tree tree(7);
+        fill(tree, n);
+        if (n > 5) {
+            tree.remove(Envelope(0, 1000, 0, 1000), 3);
+        }
+
+        auto buf = FlatSTRtree<std::int64_t>::serialize(tree);
+        auto storage = aligned(buf);
+        FlatSTRtree<std::int64_t> flat(storage.data(), buf.size());
+
+        ensure_equals(flat.getNodeCapacity(), 7u);
+
+        Tree loaded;
+        flat.copyTo(loaded);
+
+        for (int q = 0; q < 200; q++) {
+            double x = static_cast<double>((q * 31) % 1000);
+            double y = static_cast<double>((q * 17) % 1000);
+            Envelope env(x, x + 20, y, y + 20);
+
+            auto expected = hits(tree, env);
+            ensure("serialized tree", expected == hits(flat, env));
+            ensure("loaded tree", expected == hits(loaded, env));
+        }
+    }
+}
+
+// Invalid data is refused
+template<>
+template<>
+void object::test<2>()
+{
+    Tree tree;
+    fill(tree, 100);
+    auto buf = FlatSTRtree<std::int64_t>::serialize(tree);
+    auto storage = aligned(buf);
+
+    // truncated
+    try {
+        FlatSTRtree<std::int64_t> flat(storage.data(), buf.size() - 8);
+        fail("truncated data accepted");
+    } catch (const geos::util::IllegalArgumentException&) {}
+
+    // wrong item type
+    try {
+        FlatSTRtree<std::int32_t> flat(storage.data(), buf.size());
+        fail("wrong item size accepted");
+    } catch (const geos::util::IllegalArgumentException&) {}
+
+    // not a tree
+    std::vector<std::uint64_t> zeros(storage.size());
+    try {
+        FlatSTRtree<std::int64_t> flat(zeros.data(), buf.size());
+        fail("garbage accepted");
+    } catch (const geos::util::IllegalArgumentException&) {}
+
+    // loading into a tree that is not empty
+    FlatSTRtree<std::int64_t> flat(storage.data(), buf.size());
+    try {
+        flat.copyTo(tree);
+        fail("non-empty tree accepted");
+    } catch (const geos::util::IllegalArgumentException&) {}
+}
+
+// Nodes with child or item indices out of range, or children shared
+// between branches, are refused
+template<>
+template<>
+void object::test<3>()
+{
+    Tree tree(4);
+    fill(tree, 100);
+    auto buf = FlatSTRtree<std::int64_t>::serialize(tree);
+    auto storage = aligned(buf);
+
+    // offsets in the serialized tree
+    const std::size_t headerSize = 40;
+    const std::size_t nodeSize = 48;
+    const std::size_t firstOffset = 32;
+    const std::size_t countOffset = 40;
+
+    std::uint64_t numNodes;
+    std::uint64_t numItems;
+    std::memcpy(&numNodes, buf.data() + 24, 8);
+    std::memcpy(&numItems, buf.data() + 32, 8);
+    ensure_equals(numItems, 100u);
+
+    auto checkRefused = [&](std::uint64_t node, std::size_t offset, auto value) {
+        auto corrupt = storage;
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(corrupt.data());
+        std::memcpy(bytes + headerSize + node * nodeSize + offset, &value, sizeof(value));
+        try {
+            FlatSTRtree<std::int64_t> flat(corrupt.data(), buf.size());
+            fail("invalid node accepted");
+        } catch (const geos::util::IllegalArgumentException&) {}
+    };
+
+    const std::uint64_t root = numNodes - 1;
+
+    // item of a leaf out of range
+    checkRefused(0, firstOffset, numItems);
+    // root with no children
+    checkRefused(root, countOffset, std::uint32_t(0));
+    // root as its own child
+    checkRefused(root, firstOffset, root);
+    // children past the root
+    checkRefused(root, countOffset, std::uint32_t(0xffffffff));
+    // first child index overflowing when adding the count
+    checkRefused(root, firstOffset, std::numeric_limits<std::uint64_t>::max());
+    // two branches sharing their children
+    std::uint64_t firstChild;
+    std::memcpy(&firstChild, buf.data() + headerSize + numItems * nodeSize + firstOffset, 8);
+    checkRefused(numItems + 1, firstOffset, firstChild);
+    // a branch with no parent
+    std::uint32_t rootCount;
+    std::memcpy(&rootCount, buf.data() + headerSize + root * nodeSize + countOffset, 4);
+    checkRefused(root, countOffset, rootCount - 1);
+}
+
+} // namespace tut
@@ -8,7 +8,9 @@
 #include <geos/index/ItemVisitor.h>
 #include <geos/io/WKTReader.h>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 using namespace geos;
 using geos::index::strtree::TemplateSTRtree;
@@ -31,6 +33,20 @@ struct test_templatestrtree_data {
         }
     };
 
+    // Repeatable pseudo-random ordinates in [0, 1000)
+    class RandomOrdinates {
+    public:
+        explicit RandomOrdinates(unsigned int p_seed) : seed(p_seed) {}
+
+        double operator()() {
+            seed = seed * 1103515245u + 12345u;
+            return static_cast<double>((seed >> 8) % 10000) / 10.0;
+        }
+
+    private:
+        unsigned int seed;
+    };
+
     static std::vector<std::unique_ptr<geom::Point>> pointGrid(const Grid & grid) {
         std::vector<std::unique_ptr<geom::Point>> ret;
 
@@ -475,5 +491,159 @@ void object::test<11>()
 }
 
 
+// Trees built with several threads, and batches of queries run on
+// several threads, give the same results as the serial versions
+template<>
+template<>
+void object::test<12>()
+{
+    std::vector<geom::Envelope> envs;
+    RandomOrdinates next(12345);
+    for (std::size_t i = 0; i < 20000; i++) {
+        double x = next();
+        double y = next();
+        envs.emplace_back(x, x + next() / 100, y, y + next() / 100);
+    }
+
+    TemplateSTRtree<std::size_t> serialTree;
+    TemplateSTRtree<std::size_t> parallelTree;
+    for (std::size_t i = 0; i < envs.size(); i++) {
+        serialTree.insert(envs[i], i);
+        parallelTree.insert(envs[i], i);
+    }
+    serialTree.build();
+    parallelTree.build(4);
+
+    std::vector<geom::Envelope> queryEnvs;
+    for (std::size_t i = 0; i < 500; i++) {
+        double x = next();
+        double y = next();
+        queryEnvs.emplace_back(x, x + 20, y, y + 20);
+    }
+
+    std::vector<std::vector<std::size_t>> batchHits(queryEnvs.size());
+    parallelTree.queryBatch(queryEnvs, [&batchHits](std::size_t q, const std::size_t& item) {
+        batchHits[q].push_back(item);
+    }, 3);
+
+    for (std::size_t q = 0; q < queryEnvs.size(); q++) {
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        serialTree.query(queryEnvs[q], [&expected](const std::size_t& item) {
+            expected.push_back(item);
+        });
+        parallelTree.query(queryEnvs[q], [&actual](const std::size_t& item) {
+            actual.push_back(item);
+        });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        std::sort(batchHits[q].begin(), batchHits[q].end());
+
+        ensure("parallel build", expected == actual);
+        ensure("batch query", expected == batchHits[q]);
+    }
+}
+
+// Trees packed in Hilbert order give the same query results as
+// trees packed with STR
+template<>
+template<>
+void object::test<13>()
+{
+    using geos::index::strtree::TreePacking;
+
+    for (std::size_t n : { 1u, 2u, 9u, 10u, 11u, 101u, 5000u }) {
+        std::vector<geom::Envelope> envs;
+        RandomOrdinates next(54321);
+        for (std::size_t i = 0; i < n; i++) {
+            // clustered around a few centres
+            double cx = 100 * static_cast<double>(i % 5);
+            double x = cx + next() / 20;
+            double y = cx + next() / 20;
+            envs.emplace_back(x, x + next() / 100, y, y + next() / 100);
+        }
+
+        TemplateSTRtree<std::size_t> strTree;
+        TemplateSTRtree<std::size_t> hilbertTree;
+        hilbertTree.setPacking(TreePacking::HILBERT);
+        for (std::size_t i = 0; i < envs.size(); i++) {
+            strTree.insert(envs[i], i);
+            hilbertTree.insert(envs[i], i);
+        }
+
+        std::size_t count = 0;
+        hilbertTree.query(geom::Envelope(-1, 1000, -1, 1000), [&count](const std::size_t&) {
+            count++;
+        });
+        ensure_equals(count, n);
+
+        for (std::size_t q = 0; q < 200; q++) {
+            double x = 100 * static_cast<double>(q % 6) + next() / 20;
+            double y = 100 * static_cast<double>(q % 6) + next() / 20;
+            geom::Envelope queryEnv(x, x + 5, y, y + 5);
+
+            std::vector<std::size_t> expected;
+            std::vector<std::size_t> actual;
+            strTree.query(queryEnv, [&expected](const std::size_t& item) {
+                expected.push_back(item);
+            });
+            hilbertTree.query(queryEnv, [&actual](const std::size_t& item) {
+                actual.push_back(item);
+            });
+
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            ensure(expected == actual);
+        }
+    }
+}
+
+// Items with infinite envelopes, whose centres are infinite or NaN,
+// can be packed in Hilbert order
+template<>
+template<>
+void object::test<14>()
+{
+    using geos::index::strtree::TreePacking;
+    const double inf = std::numeric_limits<double>::infinity();
+
+    std::vector<geom::Envelope> envs;
+    for (std::size_t i = 0; i < 20; i++) {
+        double x = static_cast<double>(i);
+        envs.emplace_back(x, x + 1, x, x + 1);
+    }
+    envs.emplace_back(-inf, inf, 3, 4);
+    envs.emplace_back(5, inf, -inf, 6);
+    envs.emplace_back(-inf, -inf, 10, 11);
+    envs.emplace_back(-inf, inf, -inf, inf);
+
+    TemplateSTRtree<std::size_t> strTree;
+    TemplateSTRtree<std::size_t> hilbertTree;
+    hilbertTree.setPacking(TreePacking::HILBERT);
+    for (std::size_t i = 0; i < envs.size(); i++) {
+        strTree.insert(envs[i], i);
+        hilbertTree.insert(envs[i], i);
+    }
+
+    for (double q = -2; q < 24; q += 1.5) {
+        geom::Envelope queryEnv(q, q + 0.5, q, q + 0.5);
+
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        strTree.query(queryEnv, [&expected](const std::size_t& item) {
+            expected.push_back(item);
+        });
+        hilbertTree.query(queryEnv, [&actual](const std::size_t& item) {
+            actual.push_back(item);
+        });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        ensure(expected == actual);
+        ensure(std::find(actual.begin(), actual.end(), envs.size() - 1) != actual.end());
+    }
+}
+
 } // namespace tut
 
@@ -0,0 +1,255 @@
+//
+// Test Suite for geos::io::GeoArrowReader and geos::io::GeoArrowWriter
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::Geometry;
+using geos::io::GeoArrowArray;
+using geos::io::GeoArrowBuffers;
+using geos::io::GeoArrowReader;
+using geos::io::GeoArrowWriter;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geoarrow_data {
+    geos::io::WKTReader wktreader;
+    GeoArrowReader reader;
+    GeoArrowWriter writer;
+
+    std::vector<std::unique_ptr<Geometry>> read(const std::vector<std::string>& wkts)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (const auto& wkt : wkts) {
+            geoms.push_back(wktreader.read(wkt));
+        }
+        return geoms;
+    }
+
+    static std::vector<const Geometry*> ptrs(const std::vector<std::unique_ptr<Geometry>>& geoms)
+    {
+        std::vector<const Geometry*> result;
+        for (const auto& g : geoms) {
+            result.push_back(g.get());
+        }
+        return result;
+    }
+
+    // Write the geometries and read them back, returning the array
+    GeoArrowArray checkRoundTrip(const std::vector<std::string>& wkts,
+                                 const std::vector<std::string>& expected)
+    {
+        auto geoms = read(wkts);
+        auto gp = ptrs(geoms);
+        GeoArrowArray arr = writer.write(gp.data(), gp.size());
+        ensure_equals(arr.size, wkts.size());
+
+        auto result = reader.read(arr.getBuffers());
+        ensure_equals(result.size(), wkts.size());
+        for (std::size_t i = 0; i < result.size(); i++) {
+            auto exp = wktreader.read(expected[i]);
+            ensure(expected[i] + " != " + result[i]->toString(), result[i]->equalsIdentical(exp.get()));
+        }
+        return arr;
+    }
+
+    GeoArrowArray checkRoundTrip(const std::vector<std::string>& wkts)
+    {
+        return checkRoundTrip(wkts, wkts);
+    }
+};
+
+typedef test_group<test_geoarrow_data> group;
+typedef group::object object;
+
+group test_geoarrow_group("geos::io::GeoArrow");
+
+//
+// Test Cases
+//
+
+// Points, including empty points
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto arr = checkRoundTrip({ "POINT (1 2)", "POINT EMPTY", "POINT (-3 4.5)" });
+    ensure_equals(arr.type, geos::geom::GEOS_POINT);
+    ensure_equals(arr.getNumCoordinates(), 3u);
+    ensure(arr.geomOffsets.empty());
+    ensure_equals(arr.coords[0], 1.0);
+    ensure_equals(arr.coords[5], 4.5);
+}
+
+// LineStrings with Z
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto arr = checkRoundTrip({ "LINESTRING Z (0 0 1, 1 1 2)", "LINESTRING Z EMPTY", "LINESTRING Z (5 5 5, 6 6 6, 7 8 9)" });
+    ensure_equals(arr.type, geos::geom::GEOS_LINESTRING);
+    ensure(arr.hasZ);
+    ensure(!arr.hasM);
+    ensure(arr.geomOffsets == std::vector<std::int32_t>{ 0, 2, 2, 5 });
+    ensure_equals(arr.coords.size(), 15u);
+}
+
+// Polygons with holes
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto arr = checkRoundTrip({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        "POLYGON EMPTY",
+        "POLYGON ((0 0, 1 0, 1 1, 0 0))" });
+    ensure_equals(arr.type, geos::geom::GEOS_POLYGON);
+    ensure(arr.geomOffsets == std::vector<std::int32_t>{ 0, 2, 2, 3 });
+    ensure(arr.ringOffsets == std::vector<std::int32_t>{ 0, 5, 9, 13 });
+    ensure(arr.partOffsets.empty());
+}
+
+// Multi types, with single geometries written as multi geometries
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto arr = checkRoundTrip(
+        { "MULTIPOINT ((0 0), (1 1))", "POINT (2 2)", "MULTIPOINT EMPTY" },
+        { "MULTIPOINT ((0 0), (1 1))", "MULTIPOINT ((2 2))", "MULTIPOINT EMPTY" });
+    ensure_equals(arr.type, geos::geom::GEOS_MULTIPOINT);
+
+    arr = checkRoundTrip(
+        { "LINESTRING (0 0, 1 1)", "MULTILINESTRING ((0 0, 1 0), (2 2, 3 3, 4 4))", "GEOMETRYCOLLECTION EMPTY" },
+        { "MULTILINESTRING ((0 0, 1 1))", "MULTILINESTRING ((0 0, 1 0), (2 2, 3 3, 4 4))", "MULTILINESTRING EMPTY" });
+    ensure_equals(arr.type, geos::geom::GEOS_MULTILINESTRING);
+    ensure(arr.geomOffsets == std::vector<std::int32_t>{ 0, 1, 3, 3 });
+    ensure(arr.partOffsets == std::vector<std::int32_t>{ 0, 2, 4, 7 });
+
+    arr = checkRoundTrip(
+        { "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 9 5, 9 9, 5 9, 5 5), (6 6, 7 6, 7 7, 6 6)))",
+          "POLYGON ((0 0, 1 0, 1 1, 0 0))",
+          "POLYGON EMPTY" },
+        { "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 9 5, 9 9, 5 9, 5 5), (6 6, 7 6, 7 7, 6 6)))",
+          "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)))",
+          "MULTIPOLYGON EMPTY" });
+    ensure_equals(arr.type, geos::geom::GEOS_MULTIPOLYGON);
+    ensure(arr.geomOffsets == std::vector<std::int32_t>{ 0, 2, 3, 3 });
+    ensure(arr.partOffsets == std::vector<std::int32_t>{ 0, 1, 3, 4 });
+    ensure(arr.ringOffsets == std::vector<std::int32_t>{ 0, 4, 9, 13, 17 });
+}
+
+// Mixed dimensions are written with the union of the dimensions
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto arr = checkRoundTrip(
+        { "POINT M (1 2 3)", "POINT Z (4 5 6)", "POINT (7 8)" },
+        { "POINT ZM (1 2 NaN 3)", "POINT ZM (4 5 6 NaN)", "POINT ZM (7 8 NaN NaN)" });
+    ensure(arr.hasZ);
+    ensure(arr.hasM);
+    ensure_equals(arr.getNumCoordinates(), 3u);
+
+    arr = checkRoundTrip({ "LINESTRING M (1 2 3, 4 5 6)" });
+    ensure(!arr.hasZ);
+    ensure(arr.hasM);
+    ensure(arr.coords == std::vector<double>{ 1, 2, 3, 4, 5, 6 });
+}
+
+// Geometries without a common GeoArrow type are rejected
+template<>
+template<>
+void object::test<6>
+()
+{
+    for (const auto& wkts : std::vector<std::vector<std::string>> {
+                { "POINT (1 1)", "LINESTRING (0 0, 1 1)" },
+                { "GEOMETRYCOLLECTION (POINT (1 1))" },
+                { "CIRCULARSTRING (0 0, 1 1, 2 0)" } }) {
+        auto geoms = read(wkts);
+        auto gp = ptrs(geoms);
+        try {
+            writer.write(gp.data(), gp.size());
+            fail("expected IllegalArgumentException");
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+        }
+    }
+}
+
+// Invalid offsets are rejected
+template<>
+template<>
+void object::test<7>
+()
+{
+    double coords[] = { 0, 0, 1, 1, 2, 2 };
+    std::int32_t decreasing[] = { 0, 3, 2 };
+    std::int32_t negative[] = { -1, 2 };
+
+    GeoArrowBuffers b { geos::geom::GEOS_LINESTRING, false, false, 2, coords, 3, decreasing, nullptr, nullptr };
+    try {
+        reader.read(b);
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    b = GeoArrowBuffers { geos::geom::GEOS_LINESTRING, false, false, 1, coords, 3, negative, nullptr, nullptr };
+    try {
+        reader.read(b);
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    b = GeoArrowBuffers { geos::geom::GEOS_LINESTRING, false, false, 1, coords, 3, nullptr, nullptr, nullptr };
+    try {
+        reader.read(b);
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    // offsets beyond the coordinates
+    std::int32_t beyond[] = { 0, 3 };
+    b = GeoArrowBuffers { geos::geom::GEOS_LINESTRING, false, false, 1, coords, 2, beyond, nullptr, nullptr };
+    try {
+        reader.read(b);
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    b = GeoArrowBuffers { geos::geom::GEOS_POINT, false, false, 3, coords, 2, nullptr, nullptr, nullptr };
+    try {
+        reader.read(b);
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+}
+
+} // namespace tut
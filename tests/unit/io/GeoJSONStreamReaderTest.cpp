@@ -0,0 +1,172 @@
+//
+// Test Suite for geos::io::GeoJSONStreamReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <memory>
+#include <vector>
+
+using geos::io::GeoJSONFeature;
+using geos::io::GeoJSONStreamReader;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geojsonstreamreader_data {
+    geos::io::GeoJSONReader reader;
+
+    std::vector<GeoJSONFeature> readAll(const std::string& geojson)
+    {
+        std::istringstream is(geojson);
+        GeoJSONStreamReader streamReader(is);
+        std::vector<GeoJSONFeature> features;
+        while (auto f = streamReader.next()) {
+            features.push_back(std::move(*f));
+        }
+        return features;
+    }
+
+    // Check that a geometry is read as GeoJSONReader reads it
+    void checkGeometry(const std::string& geojson)
+    {
+        auto features = readAll(geojson);
+        ensure_equals(geojson, features.size(), 1u);
+        auto expected = reader.read(geojson);
+        ensure(geojson, features[0].getGeometry()->equalsIdentical(expected.get()));
+        ensure_equals(geojson, features[0].getGeometry()->getCoordinateDimension(),
+                      expected->getCoordinateDimension());
+    }
+
+    void checkError(const std::string& geojson)
+    {
+        try {
+            readAll(geojson);
+            fail("Did not get expected exception for " + geojson);
+        }
+        catch (const geos::io::ParseException&) {
+        }
+    }
+};
+
+typedef test_group<test_geojsonstreamreader_data> group;
+typedef group::object object;
+
+group test_geojsonstreamreader_group("geos::io::GeoJSONStreamReader");
+
+//
+// Test Cases
+//
+
+// Geometries of all types are read as GeoJSONReader reads them
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkGeometry(R"({"type":"Point","coordinates":[-117.0,33.0]})");
+    checkGeometry(R"({"type":"Point","coordinates":[-117.0,33.0,5]})");
+    checkGeometry(R"({"type":"Point","coordinates":[]})");
+    checkGeometry(R"({"coordinates":[[102.0,0.0],[103.0,1.0,2.0]],"type":"LineString"})");
+    checkGeometry(R"({"type":"LineString","coordinates":[]})");
+    checkGeometry(R"({"type":"Polygon","coordinates":[[[30,10],[40,40],[20,40],[10,20],[30,10]],[[20,30],[35,35],[30,20],[20,30]]]})");
+    checkGeometry(R"({"type":"Polygon","coordinates":[]})");
+    checkGeometry(R"({"type":"MultiPoint","coordinates":[[10,40],[40,30,1]]})");
+    checkGeometry(R"({"type":"MultiLineString","coordinates":[[[10,10],[20,20]],[[40,40],[30,30],[40,20,3]]]})");
+    checkGeometry(R"({"type":"MultiPolygon","coordinates":[[[[40,40],[20,45],[45,30],[40,40]]],[[[20,35],[10,30],[10,10],[30,5],[45,20],[20,35]],[[30,20],[20,15],[20,25],[30,20]]]]})");
+    checkGeometry(R"({"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[40,10]},{"type":"GeometryCollection","geometries":[]}]})");
+    checkGeometry(R"({"type":"Feature","properties":{},"geometry":{"type":"Point","coordinates":[1,2]}})");
+}
+
+// Features of a FeatureCollection are read one at a time
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::string geojson = R"({"type": "FeatureCollection", "bbox": [0, 0, 10, 10], "features": [
+        {"type": "Feature", "id": 7, "geometry": {"type": "Point", "coordinates": [1, 2]},
+         "properties": {"name": "a \"quoted\" ]}", "n": 3, "ok": true, "nil": null,
+                        "list": [1, "two", [3]], "obj": {"features": [1]}}},
+        {"type": "Feature", "id": "b", "properties": null,
+         "geometry": {"type": "LineString", "coordinates": [[0, 0], [1, 1]]}}
+    ], "extra": {"features": 5}})";
+
+    auto features = readAll(geojson);
+    ensure_equals(features.size(), 2u);
+
+    ensure_equals(features[0].getId(), "7");
+    ensure_equals(features[0].getGeometry()->toText(), "POINT (1 2)");
+    const auto& props = features[0].getProperties();
+    ensure_equals(props.size(), 6u);
+    ensure_equals(props.at("name").getString(), "a \"quoted\" ]}");
+    ensure_equals(props.at("n").getNumber(), 3.0);
+    ensure(props.at("ok").getBoolean());
+    ensure(props.at("nil").isNull());
+    ensure_equals(props.at("list").getArray().size(), 3u);
+    ensure_equals(props.at("list").getArray()[2].getArray()[0].getNumber(), 3.0);
+    ensure_equals(props.at("obj").getObject().at("features").getArray().size(), 1u);
+
+    ensure_equals(features[1].getId(), "b");
+    ensure(features[1].getProperties().empty());
+    ensure_equals(features[1].getGeometry()->toText(), "LINESTRING (0 0, 1 1)");
+}
+
+// A sequence of objects is read, as in newline-delimited GeoJSON
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::string geojson =
+        "{\"type\":\"Point\",\"coordinates\":[1,2]}\n"
+        "\x1e{\"type\":\"FeatureCollection\",\"features\":[]}\n"
+        "{\"type\":\"Feature\",\"properties\":{\"a\":1},\"geometry\":{\"type\":\"Point\",\"coordinates\":[3,4]}}\n"
+        "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"properties\":{},\"geometry\":{\"type\":\"Point\",\"coordinates\":[5,6]}}]}\n";
+
+    auto features = readAll(geojson);
+    ensure_equals(features.size(), 3u);
+    ensure_equals(features[0].getGeometry()->toText(), "POINT (1 2)");
+    ensure_equals(features[1].getGeometry()->toText(), "POINT (3 4)");
+    ensure_equals(features[1].getProperties().at("a").getNumber(), 1.0);
+    ensure_equals(features[2].getGeometry()->toText(), "POINT (5 6)");
+
+    ensure(readAll("").empty());
+    ensure(readAll(" \n").empty());
+}
+
+// Invalid input is rejected
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkError(R"({"type":"Point","coordinates":[1]})");
+    checkError(R"({"type":"Point","coordinates":[1,2,3,4]})");
+    checkError(R"({"type":"Point","coordinates":[[1,2]]})");
+    checkError(R"({"type":"LineString","coordinates":[1,2]})");
+    checkError(R"({"type":"LineString","coordinates":[[1,2],[]]})");
+    checkError(R"({"type":"LineString","coordinates":[[1,2],3]})");
+    checkError(R"({"type":"Polygon","coordinates":[[1,2]]})");
+    checkError(R"({"type":"Circle","coordinates":[1,2]})");
+    checkError(R"({"coordinates":[1,2]})");
+    checkError(R"({"type":"Point"})");
+    checkError(R"({"type":"Feature","properties":{}})");
+    checkError(R"({"type":"FeatureCollection","features":[{"type":"Point","coordinates":[1,2]}]})");
+    checkError(R"({"type":"FeatureCollection","features":[1]})");
+    checkError(R"({"type":"Point","coordinates":[1,2],})");
+    checkError(R"({"type":"FeatureCollection","features":[)");
+    checkError(R"([])");
+}
+
+} // namespace tut
@@ -0,0 +1,284 @@
+//
+// Test Suite for geos::io::GeoJSONStreamWriter
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/GeoJSONWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/UnsupportedOperationException.h>
+// std
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <memory>
+
+using geos::io::GeoJSONFeature;
+using geos::io::GeoJSONFeatureCollection;
+using geos::io::GeoJSONStreamWriter;
+using geos::io::GeoJSONType;
+using geos::io::GeoJSONValue;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geojsonstreamwriter_data {
+    geos::io::WKTReader wktreader;
+    geos::io::GeoJSONReader geojsonreader;
+
+    std::string write(const std::string& wkt, GeoJSONType type = GeoJSONType::GEOMETRY)
+    {
+        auto geom = wktreader.read(wkt);
+        std::string result;
+        GeoJSONStreamWriter writer(result);
+        writer.write(geom.get(), type);
+        return result;
+    }
+
+    // Check that the written GeoJSON reads back as the input geometry
+    void checkRoundTrip(const std::string& wkt)
+    {
+        auto geom = wktreader.read(wkt);
+        std::string result;
+        GeoJSONStreamWriter writer(result);
+        writer.write(geom.get());
+        auto readBack = geojsonreader.read(result);
+        ensure(wkt + " -> " + result, readBack->equalsIdentical(geom.get()));
+    }
+};
+
+typedef test_group<test_geojsonstreamwriter_data> group;
+typedef group::object object;
+
+group test_geojsonstreamwriter_group("geos::io::GeoJSONStreamWriter");
+
+//
+// Test Cases
+//
+
+// Geometries are written as GeoJSONWriter writes them
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure_equals(write("POINT (-117 33)"), R"({"type":"Point","coordinates":[-117.0,33.0]})");
+    ensure_equals(write("POINT Z (1.5 2.25 -3)"), R"({"type":"Point","coordinates":[1.5,2.25,-3.0]})");
+    ensure_equals(write("POINT EMPTY"), R"({"type":"Point","coordinates":[]})");
+    ensure_equals(write("LINESTRING (102 0, 103 1)"), R"({"type":"LineString","coordinates":[[102.0,0.0],[103.0,1.0]]})");
+    ensure_equals(write("LINESTRING EMPTY"), R"({"type":"LineString","coordinates":[]})");
+    ensure_equals(write("LINEARRING (0 0, 1 0, 1 1, 0 0)"), R"({"type":"LineString","coordinates":[[0.0,0.0],[1.0,0.0],[1.0,1.0],[0.0,0.0]]})");
+    ensure_equals(write("POLYGON ((0 0, 10 0, 0 10, 0 0), (1 1, 2 1, 1 2, 1 1))"),
+                  R"({"type":"Polygon","coordinates":[[[0.0,0.0],[10.0,0.0],[0.0,10.0],[0.0,0.0]],[[1.0,1.0],[2.0,1.0],[1.0,2.0],[1.0,1.0]]]})");
+    ensure_equals(write("POLYGON EMPTY"), R"({"type":"Polygon","coordinates":[[]]})");
+    ensure_equals(write("MULTIPOINT ((1 2), EMPTY, (3 4))"), R"({"type":"MultiPoint","coordinates":[[1.0,2.0],[3.0,4.0]]})");
+    ensure_equals(write("MULTILINESTRING ((0 0, 1 1), (2 2, 3 3))"),
+                  R"({"type":"MultiLineString","coordinates":[[[0.0,0.0],[1.0,1.0]],[[2.0,2.0],[3.0,3.0]]]})");
+    ensure_equals(write("MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))"),
+                  R"({"type":"MultiPolygon","coordinates":[[[[0.0,0.0],[1.0,0.0],[0.0,1.0],[0.0,0.0]]]]})");
+    ensure_equals(write("GEOMETRYCOLLECTION (POINT (1 2), GEOMETRYCOLLECTION EMPTY)"),
+                  R"({"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[1.0,2.0]},{"type":"GeometryCollection","geometries":[]}]})");
+
+    // unlike GeoJSONWriter, a feature always has a properties member
+    ensure_equals(write("POINT (1 2)", GeoJSONType::FEATURE),
+                  R"({"type":"Feature","geometry":{"type":"Point","coordinates":[1.0,2.0]},"properties":{}})");
+    ensure_equals(write("POINT (1 2)", GeoJSONType::FEATURE_COLLECTION),
+                  R"({"type":"FeatureCollection","features":[{"type":"Feature","geometry":{"type":"Point","coordinates":[1.0,2.0]},"properties":{}}]})");
+
+    try {
+        write("CIRCULARSTRING (0 0, 1 1, 2 0)");
+        fail("Expected exception for curved geometry");
+    }
+    catch (const geos::util::UnsupportedOperationException&) {
+    }
+}
+
+// Coordinates round-trip at full precision, as with GeoJSONWriter,
+// and are rounded to the requested precision
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkRoundTrip("POINT (0.1 0.2)");
+    checkRoundTrip("POINT (-1.2345678901234567e-5 98765.43210987654)");
+    checkRoundTrip("LINESTRING Z (1e15 -1e-4 3, 123456.789 0.000123 4.5)");
+    checkRoundTrip("MULTIPOLYGON (((40 40, 20 45, 45 30, 40 40)), ((20 35, 10 30, 10 10, 30 5, 45 20, 20 35), (30 20, 20 15, 20 25, 30 20)))");
+
+    auto geom = wktreader.read("POINT Z (1.23456 2.5 3)");
+    std::string result;
+    GeoJSONStreamWriter writer(result);
+    writer.setRoundingPrecision(2);
+    writer.setOutputDimension(2);
+    writer.write(geom.get());
+    ensure_equals(result, R"({"type":"Point","coordinates":[1.23,2.5]})");
+
+    // Full precision is used by default, whatever the PrecisionModel
+    geos::io::GeoJSONWriter domWriter;
+    geos::geom::PrecisionModel pm(1000.0);
+    auto gf = geos::geom::GeometryFactory::create(&pm);
+    geos::io::WKTReader fixedReader(gf.get());
+    for (const char* wkt : { "POINT (0.30000000000000004 -1.2345678901234567e-5)",
+                             "LINESTRING Z (1e300 5e-324 2, 123456.789 -0 4.5)" }) {
+        for (const auto* reader : { &wktreader, &fixedReader }) {
+            auto fullGeom = reader->read(wkt);
+            result.clear();
+            GeoJSONStreamWriter fullWriter(result);
+            fullWriter.write(fullGeom.get());
+            ensure_equals(result, domWriter.write(fullGeom.get()));
+        }
+    }
+
+    try {
+        writer.setOutputDimension(4);
+        fail("Expected exception for output dimension 4");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// Feature ids and properties are written as JSON
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto geom = wktreader.read("POINT (1 2)");
+    std::map<std::string, GeoJSONValue> props;
+    props["name"] = GeoJSONValue(std::string("a \"quoted\"\\ line\n\x01"));
+    props["n"] = GeoJSONValue(0.1);
+    props["inf"] = GeoJSONValue(std::numeric_limits<double>::infinity());
+    props["ok"] = GeoJSONValue(true);
+    props["nil"] = GeoJSONValue();
+    props["list"] = GeoJSONValue(std::vector<GeoJSONValue>{ GeoJSONValue(1.0), GeoJSONValue(std::string("two")) });
+    GeoJSONFeature feature(geom->clone(), props, "f\t1");
+
+    std::string result;
+    GeoJSONStreamWriter writer(result);
+    writer.write(feature);
+    ensure_equals(result,
+                  "{\"type\":\"Feature\",\"id\":\"f\\t1\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[1.0,2.0]},"
+                  "\"properties\":{\"inf\":null,\"list\":[1.0,\"two\"],\"n\":0.1,\"name\":\"a \\\"quoted\\\"\\\\ line\\n\\u0001\","
+                  "\"nil\":null,\"ok\":true}}");
+
+    auto readBack = geojsonreader.readFeatures(result);
+    ensure_equals(readBack.getFeatures().size(), 1u);
+    const auto& readFeature = readBack.getFeatures()[0];
+    ensure_equals(readFeature.getId(), "f\t1");
+    ensure_equals(readFeature.getProperties().at("name").getString(), props["name"].getString());
+    ensure_equals(readFeature.getProperties().at("n").getNumber(), 0.1);
+}
+
+// A FeatureCollection is written incrementally to a stream
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::ostringstream os;
+    {
+        GeoJSONStreamWriter writer(os);
+        writer.beginFeatureCollection();
+        for (int i = 0; i < 5000; i++) {
+            auto geom = wktreader.read("POINT (" + std::to_string(i) + " 1)");
+            std::map<std::string, GeoJSONValue> props;
+            props["i"] = GeoJSONValue(static_cast<double>(i));
+            writer.write(GeoJSONFeature(std::move(geom), props));
+        }
+        auto geom = wktreader.read("LINESTRING (0 0, 1 1)");
+        writer.write(geom.get(), GeoJSONType::FEATURE);
+
+        try {
+            writer.write(geom.get());
+            fail("Expected exception for geometry in FeatureCollection");
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+        }
+        try {
+            writer.beginFeatureCollection();
+            fail("Expected exception for nested FeatureCollection");
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+        }
+
+        writer.endFeatureCollection();
+
+        try {
+            writer.endFeatureCollection();
+            fail("Expected exception for unmatched endFeatureCollection");
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+        }
+    }
+
+    auto features = geojsonreader.readFeatures(os.str());
+    ensure_equals(features.getFeatures().size(), 5001u);
+    ensure_equals(features.getFeatures()[4999].getGeometry()->toText(), "POINT (4999 1)");
+    ensure_equals(features.getFeatures()[4999].getProperties().at("i").getNumber(), 4999.0);
+    ensure_equals(features.getFeatures()[5000].getGeometry()->toText(), "LINESTRING (0 0, 1 1)");
+
+    // A whole FeatureCollection gives the same text as GeoJSONWriter
+    std::map<std::string, GeoJSONValue> props;
+    props["i"] = GeoJSONValue(1.0);
+    std::vector<GeoJSONFeature> smallFeatures;
+    smallFeatures.emplace_back(wktreader.read("POINT (0.5 1.25)"), props, "a");
+    smallFeatures.emplace_back(wktreader.read("LINESTRING (0.5 1.25, 2 3.75)"), props);
+    GeoJSONFeatureCollection small(std::move(smallFeatures));
+    std::string result;
+    GeoJSONStreamWriter writer(result);
+    writer.write(small);
+    geos::io::GeoJSONWriter domWriter;
+    ensure_equals(result, domWriter.write(small));
+}
+
+// Output to a stream is written as the buffer fills, even
+// in the middle of a geometry
+template<>
+template<>
+void object::test<5>
+()
+{
+    // Records the size of the largest write
+    struct RecordingBuf : public std::stringbuf {
+        std::streamsize largestWrite = 0;
+
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            largestWrite = std::max(largestWrite, n);
+            return std::stringbuf::xsputn(s, n);
+        }
+    };
+
+    std::string wkt = "LINESTRING (";
+    for (int i = 0; i < 20000; i++) {
+        wkt += (i ? ", " : "") + std::to_string(i) + ".125 " + std::to_string(i % 7) + ".5";
+    }
+    wkt += ")";
+    auto geom = wktreader.read(wkt);
+
+    RecordingBuf buf;
+    std::ostream os(&buf);
+    {
+        GeoJSONStreamWriter writer(os);
+        writer.write(geom.get());
+    }
+
+    geos::io::GeoJSONWriter domWriter;
+    std::string expected = domWriter.write(geom.get());
+    ensure(expected.size() > 4 * (1 << 16));
+    ensure_equals(buf.str(), expected);
+    ensure(buf.largestWrite < (1 << 16) + 1024);
+}
+
+} // namespace tut
@@ -0,0 +1,236 @@
+//
+// Test Suite for geos::io::MVTEncoder
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/MVTEncoder.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/UnsupportedOperationException.h>
+// std
+#include <string>
+#include <vector>
+
+using geos::io::MVTEncoder;
+using geos::geom::Envelope;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_mvtencoder_data {
+    geos::io::WKTReader wktreader;
+    std::vector<uint32_t> commands;
+
+    // Tile coordinates are the world coordinates with Y negated,
+    // so that examples of the specification can be used directly
+    test_mvtencoder_data()
+        : encoder(Envelope(0, 4096, -4096, 0), 4096, 0)
+    {}
+
+    MVTEncoder encoder;
+
+    void checkEncode(const std::string& wkt, MVTEncoder::GeomType type, const std::vector<uint32_t>& expected)
+    {
+        auto geom = wktreader.read(wkt);
+        ensure_equals(wkt, encoder.encode(*geom, commands), type);
+        ensure_equals(wkt + " command count", commands.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            ensure_equals(wkt + " command " + std::to_string(i), commands[i], expected[i]);
+        }
+    }
+
+    // Decodes polygon commands into a geometry in tile coordinates
+    std::unique_ptr<geos::geom::Geometry> decodePolygons()
+    {
+        using namespace geos::geom;
+        auto gf = GeometryFactory::create();
+        std::vector<std::unique_ptr<Polygon>> polys;
+        std::unique_ptr<LinearRing> shell;
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        int32_t x = 0;
+        int32_t y = 0;
+        std::size_t i = 0;
+        while (i < commands.size()) {
+            ensure_equals("MoveTo", commands[i++], 9u);
+            auto seq = std::make_unique<CoordinateSequence>();
+            x += unzigzag(commands[i++]);
+            y += unzigzag(commands[i++]);
+            seq->add(CoordinateXY(x, y));
+
+            ensure_equals("LineTo", commands[i] & 7, 2u);
+            std::size_t count = commands[i++] >> 3;
+            for (std::size_t j = 0; j < count; j++) {
+                x += unzigzag(commands[i++]);
+                y += unzigzag(commands[i++]);
+                seq->add(CoordinateXY(x, y));
+            }
+            ensure_equals("ClosePath", commands[i++], 15u);
+            seq->closeRing();
+
+            double area = 0;
+            for (std::size_t j = 0; j + 1 < seq->size(); j++) {
+                area += seq->getX(j) * seq->getY(j + 1) - seq->getX(j + 1) * seq->getY(j);
+            }
+            auto ring = gf->createLinearRing(std::move(seq));
+            if (area > 0) {
+                if (shell) {
+                    polys.push_back(gf->createPolygon(std::move(shell), std::move(holes)));
+                    holes.clear();
+                }
+                shell = std::move(ring);
+            }
+            else {
+                ensure("hole after shell", shell != nullptr);
+                holes.push_back(std::move(ring));
+            }
+        }
+        polys.push_back(gf->createPolygon(std::move(shell), std::move(holes)));
+        return gf->createMultiPolygon(std::move(polys));
+    }
+
+    static int32_t unzigzag(uint32_t n)
+    {
+        return static_cast<int32_t>(n >> 1) ^ -static_cast<int32_t>(n & 1);
+    }
+};
+
+typedef test_group<test_mvtencoder_data> group;
+typedef group::object object;
+
+group test_mvtencoder_group("geos::io::MVTEncoder");
+
+
+// Examples from the specification
+template<>
+template<>
+void object::test<1>()
+{
+    checkEncode("POINT (25 -17)", MVTEncoder::POINT, { 9, 50, 34 });
+    checkEncode("MULTIPOINT ((5 -7), (3 -2))", MVTEncoder::POINT, { 17, 10, 14, 3, 9 });
+    checkEncode("LINESTRING (2 -2, 2 -10, 10 -10)", MVTEncoder::LINESTRING,
+                { 9, 4, 4, 18, 0, 16, 16, 0 });
+    checkEncode("MULTILINESTRING ((2 -2, 2 -10, 10 -10), (1 -1, 3 -5))", MVTEncoder::LINESTRING,
+                { 9, 4, 4, 18, 0, 16, 16, 0, 9, 17, 17, 10, 4, 8 });
+    checkEncode("POLYGON ((3 -6, 8 -12, 20 -34, 3 -6))", MVTEncoder::POLYGON,
+                { 9, 6, 12, 18, 10, 12, 24, 44, 15 });
+    checkEncode("MULTIPOLYGON (((0 0, 10 0, 10 -10, 0 -10, 0 0)),"
+                "((11 -11, 20 -11, 20 -20, 11 -20, 11 -11), (13 -13, 13 -17, 17 -17, 17 -13, 13 -13)))",
+                MVTEncoder::POLYGON,
+                { 9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15,
+                  9, 22, 2, 26, 18, 0, 0, 18, 17, 0, 15,
+                  9, 4, 13, 26, 0, 8, 8, 0, 0, 7, 15 });
+}
+
+// Rings are oriented as required
+template<>
+template<>
+void object::test<2>()
+{
+    checkEncode("POLYGON ((3 -6, 20 -34, 8 -12, 3 -6))", MVTEncoder::POLYGON,
+                { 9, 6, 12, 18, 10, 12, 24, 44, 15 });
+    checkEncode("POLYGON ((11 -11, 11 -20, 20 -20, 20 -11, 11 -11), (13 -13, 17 -13, 17 -17, 13 -17, 13 -13))",
+                MVTEncoder::POLYGON,
+                { 9, 22, 22, 26, 18, 0, 0, 18, 17, 0, 15,
+                  9, 4, 13, 26, 0, 8, 8, 0, 0, 7, 15 });
+}
+
+// Transformation to tile coordinates
+template<>
+template<>
+void object::test<3>()
+{
+    MVTEncoder enc(Envelope(100, 101, 50, 51), 4096, 0);
+    auto geom = wktreader.read("POINT (100.5 50.25)");
+    ensure_equals(enc.encode(*geom, commands), MVTEncoder::POINT);
+    ensure_equals(commands.size(), 3u);
+    ensure_equals(commands[1], 4096u);
+    ensure_equals(commands[2], 6144u);
+}
+
+// Clipping
+template<>
+template<>
+void object::test<4>()
+{
+    checkEncode("LINESTRING (-10 -10, 10 -10)", MVTEncoder::LINESTRING, { 9, 0, 20, 10, 20, 0 });
+    checkEncode("MULTIPOINT ((5 -7), (5000 -7))", MVTEncoder::POINT, { 9, 10, 14 });
+    checkEncode("LINESTRING (5000 0, 6000 0)", MVTEncoder::UNKNOWN, {});
+    checkEncode("POLYGON ((5000 0, 6000 0, 6000 -10, 5000 0))", MVTEncoder::UNKNOWN, {});
+
+    auto poly = wktreader.read("POLYGON ((-10 0, 10 0, 10 -10, -10 -10, -10 0))");
+    ensure_equals(encoder.encode(*poly, commands), MVTEncoder::POLYGON);
+    auto expected = wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    ensure(decodePolygons()->equals(expected.get()));
+
+    // Geometries within the buffer are kept
+    MVTEncoder buffered(Envelope(0, 4096, -4096, 0), 4096, 64);
+    auto geom = wktreader.read("LINESTRING (-100 -10, 10 -10)");
+    ensure_equals(buffered.encode(*geom, commands), MVTEncoder::LINESTRING);
+    ensure_equals(commands.size(), 6u);
+    ensure_equals(commands[1], 127u); // -64
+}
+
+// Points repeated after rounding are dropped
+template<>
+template<>
+void object::test<5>()
+{
+    checkEncode("LINESTRING (1 -1, 1.2 -1.2, 3 -3)", MVTEncoder::LINESTRING, { 9, 2, 2, 10, 4, 4 });
+    checkEncode("LINESTRING (1 -1, 1.2 -1.2)", MVTEncoder::UNKNOWN, {});
+    checkEncode("POLYGON ((0 0, 0.2 0, 0.2 -0.2, 0 0))", MVTEncoder::UNKNOWN, {});
+    checkEncode("POINT EMPTY", MVTEncoder::UNKNOWN, {});
+}
+
+// Polygons made invalid by rounding are repaired
+template<>
+template<>
+void object::test<6>()
+{
+    auto geom = wktreader.read("POLYGON ((0 0, 10 0, 10 -10, 5.6 -0.4, 0 -10, 0 0))");
+    ensure(geom->isValid());
+    ensure_equals(encoder.encode(*geom, commands), MVTEncoder::POLYGON);
+
+    auto result = decodePolygons();
+    auto expected = wktreader.read("MULTIPOLYGON (((0 0, 6 0, 0 10, 0 0)), ((6 0, 10 0, 10 10, 6 0)))");
+    ensure(result->isValid());
+    ensure(result->equals(expected.get()));
+}
+
+// Components of a lower dimension are not written
+template<>
+template<>
+void object::test<7>()
+{
+    checkEncode("GEOMETRYCOLLECTION (POINT (1 -1), LINESTRING (1 -1, 3 -3))", MVTEncoder::LINESTRING,
+                { 9, 2, 2, 10, 4, 4 });
+}
+
+// Invalid arguments
+template<>
+template<>
+void object::test<8>()
+{
+    ensure_THROW(MVTEncoder(Envelope(), 4096, 0), geos::util::IllegalArgumentException);
+    ensure_THROW(MVTEncoder(Envelope(0, 0, 0, 1), 4096, 0), geos::util::IllegalArgumentException);
+    ensure_THROW(MVTEncoder(Envelope(0, 1, 0, 1), 0, 0), geos::util::IllegalArgumentException);
+
+    auto geom = wktreader.read("CIRCULARSTRING (0 0, 1 1, 2 0)");
+    ensure_THROW(encoder.encode(*geom, commands), geos::util::UnsupportedOperationException);
+
+    // points with non-finite coordinates are not dropped as outside the tile
+    geom = wktreader.read("POINT (NaN 1)");
+    ensure_THROW(encoder.encode(*geom, commands), geos::util::IllegalArgumentException);
+    geom = wktreader.read("MULTIPOINT ((1 -1), (1 NaN))");
+    ensure_THROW(encoder.encode(*geom, commands), geos::util::IllegalArgumentException);
+}
+
+} // namespace tut
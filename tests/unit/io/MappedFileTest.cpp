@@ -0,0 +1,78 @@
+//
+// Test Suite for geos::io::MappedFile
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/MappedFile.h>
+#include <geos/util/GEOSException.h>
+// std
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using geos::io::MappedFile;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_mappedfile_data {
+    const std::string path = "geos_test_mappedfile.bin";
+
+    ~test_mappedfile_data()
+    {
+        std::remove(path.c_str());
+    }
+
+    void writeFile(const std::string& contents)
+    {
+        std::ofstream f(path, std::ios::binary);
+        f << contents;
+    }
+};
+
+typedef test_group<test_mappedfile_data> group;
+typedef group::object object;
+
+group test_mappedfile_group("geos::io::MappedFile");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    writeFile(std::string("GEOS\0\xff", 6));
+    MappedFile f(path);
+    ensure_equals(f.size(), 6u);
+    ensure_equals(std::string(reinterpret_cast<const char*>(f.data()), f.size()), std::string("GEOS\0\xff", 6));
+}
+
+// Empty file
+template<>
+template<>
+void object::test<2>
+()
+{
+    writeFile("");
+    MappedFile f(path);
+    ensure_equals(f.size(), 0u);
+}
+
+// Missing file
+template<>
+template<>
+void object::test<3>
+()
+{
+    ensure_THROW(MappedFile("geos_test_missing_file.bin"), geos::util::GEOSException);
+}
+
+} // namespace tut
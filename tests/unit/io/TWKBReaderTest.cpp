@@ -0,0 +1,156 @@
+//
+// Test Suite for geos::io::TWKBReader
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+// geos
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_twkbreader_data {
+    geos::io::WKTReader wktreader;
+    geos::io::TWKBReader reader;
+    geos::io::TWKBWriter writer;
+
+    static std::vector<unsigned char> fromHex(const std::string& hex)
+    {
+        std::vector<unsigned char> bytes;
+        for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+            bytes.push_back(static_cast<unsigned char>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+        }
+        return bytes;
+    }
+
+    void checkRead(const std::string& hex, const std::string& wkt)
+    {
+        auto bytes = fromHex(hex);
+        auto result = reader.read(bytes.data(), bytes.size());
+        auto expected = wktreader.read(wkt);
+        ensure_equals_exact_geometry_xyzm(result.get(), expected.get(), 0.0);
+    }
+
+    void checkRoundTrip(const std::string& wkt)
+    {
+        auto geom = wktreader.read(wkt);
+        std::vector<unsigned char> bytes;
+        writer.write(*geom, bytes);
+        auto result = reader.read(bytes.data(), bytes.size());
+        ensure_equals_exact_geometry_xyzm(result.get(), geom.get(), 0.0);
+    }
+
+    void checkParseError(const std::string& hex)
+    {
+        auto bytes = fromHex(hex);
+        ensure_THROW(reader.read(bytes.data(), bytes.size()), geos::io::ParseException);
+    }
+};
+
+typedef test_group<test_twkbreader_data> group;
+typedef group::object object;
+
+group test_twkbreader_group("geos::io::TWKBReader");
+
+
+// Simple geometries
+template<>
+template<>
+void object::test<1>()
+{
+    checkRead("01000204", "POINT (1 2)");
+    checkRead("02000202020808", "LINESTRING (1 1, 5 5)");
+    checkRead("030001040000020000020101", "POLYGON ((0 0, 1 0, 1 1, 0 0))");
+    checkRead("04000202020202", "MULTIPOINT ((1 1), (2 2))");
+    checkRead("07000201000204" "02000202020808",
+              "GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (1 1, 5 5))");
+    checkRead("21001a27", "POINT (1.3 -2)");
+    checkRead("1100f6010b", "POINT (1230 -60)");
+    checkRead("010805" "02043c", "POINT Z (1 2 3)");
+}
+
+// Empty geometries
+template<>
+template<>
+void object::test<2>()
+{
+    checkRead("0110", "POINT EMPTY");
+    checkRead("021801", "LINESTRING Z EMPTY");
+    checkRead("0610", "MULTIPOLYGON EMPTY");
+    checkRead("030000", "POLYGON EMPTY");
+}
+
+// Sizes, bounding boxes and id lists are skipped
+template<>
+template<>
+void object::test<3>()
+{
+    checkRead("0203" "09" "02080208" "0202020808", "LINESTRING (1 1, 5 5)");
+    checkRead("0404" "02" "0204" "02020202", "MULTIPOINT ((1 1), (2 2))");
+}
+
+// Round trips
+template<>
+template<>
+void object::test<4>()
+{
+    writer.setPrecision(3);
+    writer.setPrecisionZ(2);
+    writer.setPrecisionM(1);
+    writer.setIncludeBoundingBox(true);
+    writer.setIncludeSize(true);
+
+    checkRoundTrip("POINT (-1.234 5.678)");
+    checkRoundTrip("LINESTRING Z (0 0 1.25, 10.5 -3.125 2, 7 7 7)");
+    checkRoundTrip("POLYGON M ((0 0 1, 10 0 2, 10 10 3, 0 10 4, 0 0 1), (1 1 0, 1 2 0, 2 2 0, 1 1 0))");
+    checkRoundTrip("MULTILINESTRING ((0 0, 1 1), (2 2, 3 3.5))");
+    checkRoundTrip("MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))");
+    checkRoundTrip("GEOMETRYCOLLECTION ZM (POINT ZM (1 2 3 4), GEOMETRYCOLLECTION ZM (LINESTRING ZM (1 1 1 1, 2 2 2 2)), POINT ZM EMPTY)");
+}
+
+// Reading from a stream
+template<>
+template<>
+void object::test<5>()
+{
+    std::stringstream in(std::string("\x02\x00\x02\x02\x02\x08\x08", 7));
+    auto result = reader.read(in);
+    auto expected = wktreader.read("LINESTRING (1 1, 5 5)");
+    ensure_equals_exact_geometry_xyzm(result.get(), expected.get(), 0.0);
+}
+
+// Invalid input
+template<>
+template<>
+void object::test<6>()
+{
+    // Empty input
+    checkParseError("");
+    // Truncated coordinates
+    checkParseError("010002");
+    checkParseError("02000302020808");
+    // Unterminated varint
+    checkParseError("010082");
+    // Unknown type
+    checkParseError("0f00");
+    // Counts larger than the input
+    checkParseError("0200ffffffff0f");
+    checkParseError("0700ffffffff0f");
+    // Coordinates overflowing when adding the deltas
+    checkParseError("020002feffffffffffffffff01000200");
+    checkParseError("020002ffffffffffffffffff01000100");
+}
+
+} // namespace tut
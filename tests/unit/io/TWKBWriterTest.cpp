@@ -0,0 +1,173 @@
+//
+// Test Suite for geos::io::TWKBWriter
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_twkbwriter_data {
+    geos::io::WKTReader wktreader;
+    geos::io::TWKBWriter writer;
+
+    static std::string toHex(const std::vector<unsigned char>& bytes)
+    {
+        std::string hex;
+        char buf[3];
+        for (unsigned char b : bytes) {
+            std::snprintf(buf, sizeof(buf), "%02x", b);
+            hex += buf;
+        }
+        return hex;
+    }
+
+    void checkOutput(const std::string& wkt, const std::string& hex)
+    {
+        auto geom = wktreader.read(wkt);
+        std::vector<unsigned char> out;
+        writer.write(*geom, out);
+        ensure_equals(wkt, toHex(out), hex);
+    }
+};
+
+typedef test_group<test_twkbwriter_data> group;
+typedef group::object object;
+
+group test_twkbwriter_group("geos::io::TWKBWriter");
+
+
+// Simple geometries, examples from the specification
+template<>
+template<>
+void object::test<1>()
+{
+    checkOutput("POINT (1 2)", "01000204");
+    checkOutput("LINESTRING (1 1, 5 5)", "02000202020808");
+    checkOutput("POLYGON ((0 0, 1 0, 1 1, 0 0))", "030001040000020000020101");
+    checkOutput("MULTIPOINT ((1 1), (2 2))", "04000202020202");
+    checkOutput("GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (1 1, 5 5))",
+                "07000201000204" "02000202020808");
+}
+
+// Precision
+template<>
+template<>
+void object::test<2>()
+{
+    writer.setPrecision(1);
+    checkOutput("POINT (1.25 -2)", "21001a27");
+
+    writer.setPrecision(-1);
+    checkOutput("POINT (1234 -56)", "1100f6010b");
+
+    writer.setPrecision(0);
+    writer.setPrecisionZ(1);
+    checkOutput("POINT Z (1 2 3)", "010805" "02043c");
+    checkOutput("POINT M (1 2 3)", "010802" "020406");
+}
+
+// Points that are the same after rounding are dropped,
+// keeping enough points for a valid geometry
+template<>
+template<>
+void object::test<3>()
+{
+    checkOutput("LINESTRING (0 0, 0.1 0.1, 1 1)", "02000200000202");
+    checkOutput("LINESTRING (0 0, 0.1 0.1)", "02000200000000");
+}
+
+// Empty geometries
+template<>
+template<>
+void object::test<4>()
+{
+    checkOutput("POINT EMPTY", "0110");
+    checkOutput("LINESTRING Z EMPTY", "021801");
+    checkOutput("MULTIPOLYGON EMPTY", "0610");
+
+    // Empty points are not written to a MultiPoint
+    checkOutput("MULTIPOINT ((1 1), EMPTY)", "0400010202");
+}
+
+// Bounding box and size
+template<>
+template<>
+void object::test<5>()
+{
+    writer.setIncludeBoundingBox(true);
+    checkOutput("LINESTRING (1 1, 5 5)", "0201" "02080208" "02020208" "08");
+
+    writer.setIncludeBoundingBox(false);
+    writer.setIncludeSize(true);
+    checkOutput("LINESTRING (1 1, 5 5)", "0202" "05" "0202020808");
+
+    // The size allows skipping the bounding box
+    writer.setIncludeBoundingBox(true);
+    checkOutput("LINESTRING (1 1, 5 5)", "0203" "09" "02080208" "0202020808");
+
+    // The Z range of a collection covers only the elements with Z
+    writer.setIncludeSize(false);
+    checkOutput("GEOMETRYCOLLECTION (POINT (1 1), POINT Z (1 1 5))",
+                "070901" "020002000a00" "02"
+                "0101" "02000200" "0202"
+                "010901" "020002000a00" "02020a");
+}
+
+// Output dimension
+template<>
+template<>
+void object::test<6>()
+{
+    writer.setOutputDimension(3);
+    checkOutput("POINT ZM (1 2 3 4)", "010801" "020406");
+    checkOutput("POINT M (1 2 4)", "010802" "020408");
+
+    writer.setOutputDimension(2);
+    checkOutput("POINT ZM (1 2 3 4)", "01000204");
+}
+
+// Invalid arguments
+template<>
+template<>
+void object::test<7>()
+{
+    ensure_THROW(writer.setPrecision(8), geos::util::IllegalArgumentException);
+    ensure_THROW(writer.setPrecisionZ(-1), geos::util::IllegalArgumentException);
+    ensure_THROW(writer.setOutputDimension(1), geos::util::IllegalArgumentException);
+
+    // Coordinates that do not fit in 64 bits at this precision
+    writer.setPrecision(7);
+    auto geom = wktreader.read("POINT (1e13 0)");
+    std::vector<unsigned char> out;
+    ensure_THROW(writer.write(*geom, out), geos::util::IllegalArgumentException);
+
+    geom = wktreader.read("POINT (NaN 0)");
+    ensure_THROW(writer.write(*geom, out), geos::util::IllegalArgumentException);
+}
+
+// Writing to a stream
+template<>
+template<>
+void object::test<8>()
+{
+    auto geom = wktreader.read("LINESTRING (1 1, 5 5)");
+    std::stringstream out;
+    writer.write(*geom, out);
+    ensure_equals(out.str(), std::string("\x02\x00\x02\x02\x02\x08\x08", 7));
+}
+
+} // namespace tut
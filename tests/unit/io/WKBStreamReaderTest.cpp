@@ -0,0 +1,207 @@
+//
+// Test Suite for geos::io::WKBStreamReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKBStreamReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <memory>
+#include <vector>
+
+using geos::io::WKBStreamReader;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_wkbstreamreader_data {
+    geos::io::WKTReader wktreader;
+    geos::io::WKBWriter wkbwriter;
+
+    std::vector<std::string> readAll(const std::string& text, std::size_t numThreads)
+    {
+        std::istringstream is(text);
+        WKBStreamReader rdr(is);
+        rdr.setNumThreads(numThreads);
+        std::vector<std::string> wkts;
+        for (;;) {
+            try {
+                auto g = rdr.next();
+                if (g == nullptr) {
+                    break;
+                }
+                wkts.push_back(g->toText());
+            }
+            catch (const geos::io::ParseException&) {
+                wkts.push_back("error");
+            }
+        }
+        return wkts;
+    }
+
+    std::vector<std::string> readAll(const std::vector<unsigned char>& buf, std::size_t numThreads)
+    {
+        WKBStreamReader rdr(buf.data(), buf.size());
+        rdr.setNumThreads(numThreads);
+        std::vector<std::string> wkts;
+        for (;;) {
+            try {
+                auto g = rdr.next();
+                if (g == nullptr) {
+                    break;
+                }
+                wkts.push_back(g->toText());
+            }
+            catch (const geos::io::ParseException&) {
+                wkts.push_back("error");
+            }
+        }
+        return wkts;
+    }
+
+    static void appendRecord(std::vector<unsigned char>& buf, const std::vector<unsigned char>& wkb)
+    {
+        const std::size_t size = wkb.size();
+        for (std::size_t i = 0; i < 4; i++) {
+            buf.push_back(static_cast<unsigned char>(size >> (8 * i)));
+        }
+        buf.insert(buf.end(), wkb.begin(), wkb.end());
+    }
+};
+
+typedef test_group<test_wkbstreamreader_data> group;
+typedef group::object object;
+
+group test_wkbstreamreader_group("geos::io::WKBStreamReader");
+
+//
+// Test Cases
+//
+
+// Geometries decoded on several threads are returned in order, and
+// an invalid line does not stop reading
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::ostringstream os;
+    for (int i = 0; i < 10000; i++) {
+        if (i == 1234) {
+            os << "01020000\n";
+            continue;
+        }
+        auto g = wktreader.read("LINESTRING (" + std::to_string(i) + " 0, 0 " + std::to_string(i) + ")");
+        wkbwriter.writeHEX(*g, os);
+        os << "\n";
+    }
+
+    auto sequential = readAll(os.str(), 1);
+    ensure_equals(sequential.size(), 10000u);
+    ensure_equals(sequential[0], "LINESTRING (0 0, 0 0)");
+    ensure_equals(sequential[1234], "error");
+    ensure_equals(sequential[9999], "LINESTRING (9999 0, 0 9999)");
+
+    ensure(readAll(os.str(), 4) == sequential);
+    ensure(readAll("", 4).empty());
+}
+
+// Length-prefixed binary WKB records read from a buffer
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::vector<unsigned char> buf;
+    for (int i = 0; i < 10000; i++) {
+        std::vector<unsigned char> wkb;
+        if (i == 1234) {
+            wkb = { 0x01, 0x02, 0x00, 0x00 };
+        }
+        else {
+            auto g = wktreader.read("LINESTRING (" + std::to_string(i) + " 0, 0 " + std::to_string(i) + ")");
+            wkbwriter.write(*g, wkb);
+        }
+        appendRecord(buf, wkb);
+    }
+
+    auto sequential = readAll(buf, 1);
+    ensure_equals(sequential.size(), 10000u);
+    ensure_equals(sequential[0], "LINESTRING (0 0, 0 0)");
+    ensure_equals(sequential[1234], "error");
+    ensure_equals(sequential[9999], "LINESTRING (9999 0, 0 9999)");
+
+    ensure(readAll(buf, 4) == sequential);
+    ensure(readAll(std::vector<unsigned char>(), 4).empty());
+}
+
+// Truncated length-prefixed records
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::vector<unsigned char> buf;
+    auto g = wktreader.read("POINT (1 2)");
+    std::vector<unsigned char> wkb;
+    wkbwriter.write(*g, wkb);
+    appendRecord(buf, wkb);
+
+    std::vector<unsigned char> truncated(buf.begin(), buf.end() - 1);
+    WKBStreamReader rdr(truncated.data(), truncated.size());
+    try {
+        rdr.next();
+        fail("ParseException expected");
+    }
+    catch (const geos::io::ParseException&) {}
+
+    buf.push_back(0x15);
+    WKBStreamReader rdr2(buf.data(), buf.size());
+    ensure_equals(rdr2.next()->toText(), "POINT (1 2)");
+    try {
+        rdr2.next();
+        fail("ParseException expected");
+    }
+    catch (const geos::io::ParseException&) {}
+}
+
+// The number of threads cannot change once decoding has started
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<unsigned char> buf;
+    auto g = wktreader.read("POINT (1 2)");
+    std::vector<unsigned char> wkb;
+    wkbwriter.write(*g, wkb);
+    for (int i = 0; i < 100; i++) {
+        appendRecord(buf, wkb);
+    }
+
+    WKBStreamReader rdr(buf.data(), buf.size());
+    rdr.setNumThreads(4);
+    ensure(rdr.next() != nullptr);
+    try {
+        rdr.setNumThreads(1);
+        fail("IllegalStateException expected");
+    }
+    catch (const geos::util::IllegalStateException&) {}
+    std::size_t n = 1;
+    while (rdr.next() != nullptr) {
+        n++;
+    }
+    ensure_equals(n, 100u);
+}
+
+} // namespace tut
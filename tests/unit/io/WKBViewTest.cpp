@@ -0,0 +1,233 @@
+//
+// Test Suite for geos::io::WKBView
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKBView.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+// std
+#include <sstream>
+#include <string>
+#include <memory>
+
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedGeometryFactory;
+using geos::io::WKBConstants::wkbNDR;
+using geos::io::WKBConstants::wkbXDR;
+using geos::io::WKBConstants::wkbExtended;
+using geos::io::WKBConstants::wkbIso;
+using geos::io::WKBView;
+using geos::io::WKBWriter;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_wkbview_data {
+    geos::io::WKTReader wktreader;
+
+    std::unique_ptr<Geometry> read(const std::string& wkt)
+    {
+        return wktreader.read(wkt);
+    }
+
+    static std::string toWKB(const Geometry& g, int byteOrder, int flavor)
+    {
+        WKBWriter writer(4, byteOrder, true, flavor);
+        std::stringstream ss;
+        writer.write(g, ss);
+        return ss.str();
+    }
+
+    static const unsigned char* bytes(const std::string& s)
+    {
+        return reinterpret_cast<const unsigned char*>(s.data());
+    }
+};
+
+typedef test_group<test_wkbview_data> group;
+typedef group::object object;
+
+group test_wkbview_group("geos::io::WKBView");
+
+//
+// Test Cases
+//
+
+// The view reports the type, dimensions, SRID, points and envelope of the geometry
+template<>
+template<>
+void object::test<1>
+()
+{
+    const char* wkts[] = {
+        "POINT (1 2)",
+        "POINT EMPTY",
+        "POINT Z (1 2 3)",
+        "LINESTRING M (0 0 1, 10 5 2, 3 -4 3)",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 3, 3 3, 2 2))",
+        "POLYGON EMPTY",
+        "MULTIPOINT ((1 1), EMPTY, (-3 7))",
+        "MULTIPOLYGON Z (((0 0 1, 1 0 1, 1 1 1, 0 0 1)), ((5 5 2, 6 5 2, 6 6 2, 5 5 2)))",
+        "GEOMETRYCOLLECTION (POINT (100 100), LINESTRING (0 0, -5 2), POLYGON EMPTY)",
+        "GEOMETRYCOLLECTION EMPTY",
+        "COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (2 0, 5 -1))",
+        "CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 1, 2 0, 4 2, 6 0), (6 0, 6 5, 0 5, 0 0)))",
+        "CIRCULARSTRING (0 0, 1 1, 2 0, 4 2, 6 0)",
+    };
+
+    for (const char* wkt : wkts) {
+        auto g = read(wkt);
+        g->setSRID(4326);
+
+        for (int byteOrder : { wkbNDR, wkbXDR }) {
+            for (int flavor : { wkbExtended, wkbIso }) {
+                std::string wkb = toWKB(*g, byteOrder, flavor);
+                WKBView view(bytes(wkb), wkb.size());
+
+                ensure_equals(wkt, view.getGeometryTypeId(), g->getGeometryTypeId());
+                ensure_equals(wkt, view.hasZ(), g->hasZ());
+                ensure_equals(wkt, view.hasM(), g->hasM());
+                ensure_equals(wkt, view.getNumPoints(), g->getNumPoints());
+                ensure_equals(wkt, view.isEmpty(), g->isEmpty());
+                ensure(wkt, view.getEnvelope() == *g->getEnvelopeInternal());
+                if (flavor == wkbExtended) {
+                    ensure_equals(wkt, view.getSRID(), 4326);
+                }
+
+                auto g2 = view.toGeometry(*g->getFactory());
+                ensure(wkt, g2->equalsIdentical(g.get()));
+            }
+        }
+    }
+}
+
+// intersects gives the same results as the prepared geometry predicate
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto poly = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))");
+    auto line = read("LINESTRING (0 0, 10 10)");
+
+    const char* wkts[] = {
+        "POINT (1 2)",
+        "POINT (5 5)",
+        "POINT (10 5)",
+        "POINT (4 5)",
+        "POINT (20 20)",
+        "POINT (2 2)",
+        "POINT EMPTY",
+        "LINESTRING (-1 -1, -2 5)",
+        "LINESTRING (4.5 4.5, 5.5 5.5)",
+        "LINESTRING (4.5 4.5, 8 5.5)",
+        "MULTIPOINT ((20 20), (1 1))",
+        "POLYGON ((4.5 4.5, 5.5 4.5, 5.5 5.5, 4.5 4.5))",
+        "GEOMETRYCOLLECTION EMPTY",
+    };
+
+    for (const Geometry* base : { poly.get(), line.get() }) {
+        auto pg = PreparedGeometryFactory::prepare(base);
+
+        for (const char* wkt : wkts) {
+            auto g = read(wkt);
+            std::string wkb = toWKB(*g, wkbNDR, wkbExtended);
+            WKBView view(bytes(wkb), wkb.size());
+
+            ensure_equals(wkt, view.intersects(*pg), pg->intersects(g.get()));
+            if (g->getGeometryTypeId() == geos::geom::GEOS_POINT && !g->isEmpty()) {
+                ensure_equals(wkt, pg->intersectsXY(g->getCoordinate()->x, g->getCoordinate()->y),
+                              pg->intersects(g.get()));
+            }
+        }
+    }
+}
+
+// Malformed WKB is rejected
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto g = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::string wkb = toWKB(*g, wkbNDR, wkbExtended);
+
+    for (std::size_t size : { std::size_t(0), std::size_t(4), wkb.size() - 8, wkb.size() - 1 }) {
+        try {
+            WKBView view(bytes(wkb), size);
+            fail("expected ParseException");
+        }
+        catch (const geos::io::ParseException&) {
+        }
+    }
+
+    // unknown type
+    std::string bad = wkb;
+    bad[1] = 99;
+    try {
+        WKBView view(bytes(bad), bad.size());
+        fail("expected ParseException");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    // invalid byte order, at the root and in a nested geometry
+    auto multi = read("MULTIPOINT ((1 1), (2 2))");
+    std::string multiWkb = toWKB(*multi, wkbNDR, wkbIso);
+    for (std::size_t pos : { std::size_t(0), std::size_t(9) }) {
+        bad = multiWkb;
+        bad[pos] = 7;
+        try {
+            WKBView view(bytes(bad), bad.size());
+            fail("expected ParseException");
+        }
+        catch (const geos::io::ParseException&) {
+        }
+    }
+}
+
+// The envelope of a circular string covers its arcs only
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto g = read("CIRCULARSTRING (0 0, 1 1, 2 0, 4 2, 6 0)");
+    std::string wkb = toWKB(*g, wkbNDR, wkbIso);
+    WKBView view(bytes(wkb), wkb.size());
+
+    // the arc (0 0, 1 1, 2 0) is above y = 0, and (2 0, 4 2, 6 0) too
+    ensure_equals(view.getEnvelope().getMinY(), 0.0);
+    ensure(view.getEnvelope() == *g->getEnvelopeInternal());
+}
+
+// An arc with a NaN point is skipped without shifting the arcs after it
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto g = read("CIRCULARSTRING (0 0, 1 1, 2 0, NaN NaN, 10 0, 11 1, 12 0)");
+    std::string wkb = toWKB(*g, wkbNDR, wkbIso);
+    WKBView view(bytes(wkb), wkb.size());
+
+    // the arcs (0 0, 1 1, 2 0) and (10 0, 11 1, 12 0) are above y = 0,
+    // unlike the arc (1 1, 2 0, 10 0) of a misaligned window
+    ensure_equals(view.getNumPoints(), 6u);
+    ensure_equals(view.getEnvelope().getMinX(), 0.0);
+    ensure_equals(view.getEnvelope().getMinY(), 0.0);
+    ensure_equals(view.getEnvelope().getMaxX(), 12.0);
+    ensure_equals(view.getEnvelope().getMaxY(), 1.0);
+}
+
+} // namespace tut
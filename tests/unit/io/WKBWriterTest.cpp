@@ -18,6 +18,8 @@
 #include <string>
 #include <memory>
 #include <cmath>
+#include <algorithm>
+#include <vector>
 
 namespace tut {
 //
@@ -476,6 +478,59 @@ void object::test<19>
                            "010A0000200E1600000200000001090000000200000001080000000500000000000000000000000000000000000000000000000000004000000000000000000000000000000040000000000000F03F00000000000000400000000000000840000000000000104000000000000008400102000000040000000000000000001040000000000000084000000000000010400000000000001440000000000000F03F000000000000104000000000000000000000000000000000010800000005000000333333333333FB3F000000000000F03F666666666666F63F9A9999999999D93F9A9999999999F93F9A9999999999D93F9A9999999999F93F000000000000E03F333333333333FB3F000000000000F03F");
 }
 
+// Writing to a buffer gives the same bytes as writing to a stream
+template<>
+template<>
+void object::test<20>
+()
+{
+    std::vector<std::string> wkts = {
+        "POINT (1 2)",
+        "POINT EMPTY",
+        "POINT Z (1 2 3)",
+        "POINT M (1 2 4)",
+        "LINESTRING ZM (1 2 3 4, 5 6 7 8)",
+        "LINESTRING M (1 2 4, 5 6 8)",
+        "POLYGON ((0 0, 10 0, 0 10, 0 0), (1 1, 2 1, 1 2, 1 1))",
+        "POLYGON EMPTY",
+        "MULTIPOINT ((1 2), EMPTY)",
+        "GEOMETRYCOLLECTION (POINT Z (1 2 3), LINESTRING (0 0, 1 1), MULTIPOLYGON M (((0 0 1, 1 0 1, 0 1 1, 0 0 1))))",
+        "CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0, 2 0, 2 1, 2 3, 4 3), (4 3, 4 5, 1 4, 0 0)))"
+    };
+
+    std::vector<unsigned char> appended;
+    std::string expectedAppended;
+
+    for (const auto& wkt : wkts) {
+        auto geom = wktreader.read(wkt);
+        geom->setSRID(4326);
+        for (int byteOrder : { 0, 1 }) {
+            for (uint8_t dim = 2; dim <= 4; dim++) {
+                for (int flavor : { geos::io::WKBConstants::wkbExtended, geos::io::WKBConstants::wkbIso }) {
+                    geos::io::WKBWriter writer(dim, byteOrder, true, flavor);
+
+                    std::ostringstream os(std::ios_base::binary);
+                    writer.write(*geom, os);
+                    const std::string expected = os.str();
+
+                    std::size_t size = writer.getWkbSize(*geom);
+                    ensure_equals(wkt, size, expected.size());
+
+                    std::vector<unsigned char> buf(size + 1, 0xff);
+                    ensure_equals(wkt, writer.write(*geom, buf.data()), size);
+                    ensure(wkt, std::string(buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(size)) == expected);
+                    ensure_equals(wkt, buf[size], 0xff);
+
+                    writer.write(*geom, appended);
+                    expectedAppended += expected;
+                }
+            }
+        }
+    }
+
+    ensure(std::string(appended.begin(), appended.end()) == expectedAppended);
+}
+
 
 } // namespace tut
 
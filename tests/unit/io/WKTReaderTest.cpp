@@ -6,6 +6,7 @@
 // geos
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/ParseException.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
@@ -17,6 +18,8 @@
 #include <geos/util/GEOSException.h>
 #include <geos/util/IllegalArgumentException.h>
 // std
+#include <cmath>
+#include <cstdlib>
 #include <memory>
 
 namespace tut {
@@ -473,4 +476,35 @@ void object::test<24>
     ensure_equals(geom->getNumGeometries(), 3u);
 }
 
+// Numbers are read exactly as strtod reads them
+template<>
+template<>
+void object::test<25>
+()
+{
+    geos::io::WKTReader reader;
+
+    for (const char* num : { "0", "-0", "+1", "1.", ".5", "-123.456", "1e22", "1e23", "1.5E-7",
+                             "9007199254740993", "0.1234567890123456789", "12345678.123456789",
+                             "-179.99999999999997", "4.9e-324", "1.7976931348623157e308",
+                             "0x1p3", "inf", "-Infinity" }) {
+        std::string wkt = std::string("POINT (") + num + " " + num + ")";
+        auto geom = reader.read(wkt);
+        const auto* pt = static_cast<const geos::geom::Point*>(geom.get());
+        double expected = std::strtod(num, nullptr);
+
+        ensure_equals(wkt, pt->getX(), expected);
+        ensure_equals(wkt, std::signbit(pt->getY()), std::signbit(expected));
+    }
+
+    for (const char* wkt : { "POINT (1e 2)", "POINT (1.2.3 2)", "LINESTRING (0 0, 1 1 2)" }) {
+        try {
+            reader.read(wkt);
+            fail(std::string("Did not get expected exception for ") + wkt);
+        }
+        catch(const geos::io::ParseException&) {
+        }
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,173 @@
+//
+// Test Suite for geos::io::WKTStreamReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <clocale>
+#include <sstream>
+#include <string>
+#include <memory>
+#include <vector>
+
+using geos::io::WKTStreamReader;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_wktstreamreader_data {
+    std::vector<std::string> readAll(const std::string& text, std::size_t numThreads)
+    {
+        std::istringstream is(text);
+        WKTStreamReader rdr(is);
+        rdr.setNumThreads(numThreads);
+        std::vector<std::string> wkts;
+        for (;;) {
+            try {
+                auto g = rdr.next();
+                if (g == nullptr) {
+                    break;
+                }
+                wkts.push_back(g->toText());
+            }
+            catch (const geos::io::ParseException&) {
+                wkts.push_back("error");
+            }
+        }
+        return wkts;
+    }
+};
+
+typedef test_group<test_wktstreamreader_data> group;
+typedef group::object object;
+
+group test_wktstreamreader_group("geos::io::WKTStreamReader");
+
+//
+// Test Cases
+//
+
+// Geometries spanning several lines are read
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::string text =
+        "POINT (1 2)\n"
+        "LINESTRING (0 0,\n"
+        "  1 1)\n"
+        "POLYGON ((0 0, 1 0, 1 1, 0 0))\n";
+
+    for (std::size_t numThreads : { 1u, 4u }) {
+        auto wkts = readAll(text, numThreads);
+        ensure_equals(wkts.size(), 3u);
+        ensure_equals(wkts[0], "POINT (1 2)");
+        ensure_equals(wkts[1], "LINESTRING (0 0, 1 1)");
+        ensure_equals(wkts[2], "POLYGON ((0 0, 1 0, 1 1, 0 0))");
+    }
+    ensure(readAll("", 4).empty());
+}
+
+// Geometries decoded on several threads are returned in order, and
+// an invalid geometry does not stop reading
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::ostringstream os;
+    for (int i = 0; i < 10000; i++) {
+        if (i == 5000) {
+            os << "POINT (1 x)\n";
+        }
+        else {
+            os << "LINESTRING (" << i << " 0, 0 " << i << ")\n";
+        }
+    }
+
+    auto sequential = readAll(os.str(), 1);
+    ensure_equals(sequential.size(), 10000u);
+    ensure_equals(sequential[5000], "error");
+    ensure_equals(sequential[9999], "LINESTRING (9999 0, 0 9999)");
+
+    ensure(readAll(os.str(), 3) == sequential);
+    ensure(readAll(os.str(), 0) == sequential);
+}
+
+// Numbers which are not parsed on the fast path are read the same
+// on several threads, and the number of threads cannot change once
+// decoding has started
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::string text;
+    for (int i = 0; i < 1000; i++) {
+        text += "POINT (0.12345678901234567 1.5e-300)\n";
+    }
+    auto wkts = readAll(text, 4);
+    ensure(wkts == readAll(text, 1));
+    ensure_equals(wkts[999], "POINT (0.1234567890123457 1.5e-300)");
+
+    std::istringstream is(text);
+    WKTStreamReader rdr(is);
+    rdr.setNumThreads(4);
+    ensure(rdr.next() != nullptr);
+    try {
+        rdr.setNumThreads(1);
+        fail("expected IllegalStateException");
+    }
+    catch (const geos::util::IllegalStateException&) {
+    }
+    std::size_t n = 1;
+    while (rdr.next() != nullptr) {
+        n++;
+    }
+    ensure_equals(n, 1000u);
+}
+
+// The locale is only switched while a batch is decoded, and is
+// restored between calls to next()
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::string saved = std::setlocale(LC_NUMERIC, nullptr);
+    if (std::setlocale(LC_NUMERIC, "C.UTF-8") == nullptr) {
+        return;
+    }
+    std::string locale = std::setlocale(LC_NUMERIC, nullptr);
+
+    std::string text;
+    for (int i = 0; i < 1000; i++) {
+        text += "POINT (0.5 1.5e-300)\n";
+    }
+    std::istringstream is(text);
+    WKTStreamReader rdr(is);
+    rdr.setNumThreads(4);
+
+    std::size_t n = 0;
+    std::size_t nRestored = 0;
+    while (rdr.next() != nullptr) {
+        n++;
+        if (locale == std::setlocale(LC_NUMERIC, nullptr)) {
+            nRestored++;
+        }
+    }
+    std::setlocale(LC_NUMERIC, saved.c_str());
+    ensure_equals(n, 1000u);
+    ensure_equals(nRestored, 1000u);
+}
+
+} // namespace tut
@@ -0,0 +1,180 @@
+//
+// Test Suite for geos::noding::MCIndexNoder class.
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/noding/IntersectionAdder.h>
+#include <geos/noding/MCIndexNoder.h>
+#include <geos/noding/NodedSegmentString.h>
+#include <geos/noding/SegmentIntersectionDetector.h>
+#include <geos/noding/SegmentString.h>
+// std
+#include <memory>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::noding::MCIndexNoder;
+using geos::noding::NodedSegmentString;
+using geos::noding::SegmentString;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_mcindexnoder_data {
+
+    // Records the segment pairs given to it, in order, and whether
+    // it was called from a thread other than the calling one
+    struct RecordingIntersector : public geos::noding::SegmentIntersector {
+        std::vector<std::tuple<const SegmentString*, std::size_t, const SegmentString*, std::size_t>> pairs;
+        std::thread::id callingThread = std::this_thread::get_id();
+        bool calledFromOtherThread = false;
+
+        void processIntersections(SegmentString* e0, std::size_t segIndex0,
+                                  SegmentString* e1, std::size_t segIndex1) override
+        {
+            if (std::this_thread::get_id() != callingThread) {
+                calledFromOtherThread = true;
+            }
+            pairs.emplace_back(e0, segIndex0, e1, segIndex1);
+        }
+    };
+
+    std::vector<std::unique_ptr<NodedSegmentString>> segStrings;
+
+    void makeRandomLines(std::size_t numLines, std::size_t numPoints)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(0, 100);
+        for (std::size_t i = 0; i < numLines; i++) {
+            auto seq = new CoordinateSequence();
+            for (std::size_t j = 0; j < numPoints; j++) {
+                seq->add(CoordinateXY(dist(gen), dist(gen)));
+            }
+            segStrings.emplace_back(new NodedSegmentString(seq, false, false, nullptr));
+        }
+    }
+
+    SegmentString::NonConstVect
+    inputs()
+    {
+        SegmentString::NonConstVect ss;
+        for (auto& s : segStrings) {
+            ss.push_back(s.get());
+        }
+        return ss;
+    }
+
+    std::vector<std::unique_ptr<CoordinateSequence>>
+    nodeWithAdder(std::size_t numThreads, int& numIntersections)
+    {
+        segStrings.clear();
+        makeRandomLines(300, 20);
+
+        geos::algorithm::LineIntersector li;
+        geos::noding::IntersectionAdder adder(li);
+        MCIndexNoder noder(&adder);
+        noder.setNumThreads(numThreads);
+        auto ss = inputs();
+        noder.computeNodes(&ss);
+
+        numIntersections = adder.numIntersections;
+        std::vector<std::unique_ptr<CoordinateSequence>> result;
+        for (auto& s : segStrings) {
+            result.push_back(s->getNodedCoordinates());
+        }
+        return result;
+    }
+};
+
+typedef test_group<test_mcindexnoder_data> group;
+typedef group::object object;
+
+group test_mcindexnoder_group("geos::noding::MCIndexNoder");
+
+//
+// Test Cases
+//
+
+// Nodes found on several threads are the same as with one thread
+template<>
+template<>
+void object::test<1>()
+{
+    int serialCount;
+    int parallelCount;
+    auto serial = nodeWithAdder(1, serialCount);
+    auto parallel = nodeWithAdder(4, parallelCount);
+
+    ensure(serialCount > 1000);
+    ensure_equals(parallelCount, serialCount);
+    ensure_equals(parallel.size(), serial.size());
+    for (std::size_t i = 0; i < serial.size(); i++) {
+        ensure(parallel[i]->equalsIdentical(*serial[i]));
+    }
+}
+
+// Other intersectors are run on the calling thread, in serial order
+template<>
+template<>
+void object::test<2>()
+{
+    makeRandomLines(300, 20);
+    auto ss = inputs();
+
+    RecordingIntersector serial;
+    MCIndexNoder serialNoder(&serial);
+    serialNoder.computeNodes(&ss);
+
+    RecordingIntersector parallel;
+    MCIndexNoder parallelNoder(&parallel);
+    parallelNoder.setNumThreads(4);
+    parallelNoder.computeNodes(&ss);
+
+    ensure(!serial.pairs.empty());
+    ensure(parallel.pairs == serial.pairs);
+    ensure(!parallel.calledFromOtherThread);
+}
+
+// Intersectors that are done stop the noding
+template<>
+template<>
+void object::test<3>()
+{
+    makeRandomLines(300, 20);
+    auto ss = inputs();
+
+    geos::algorithm::LineIntersector li;
+    geos::noding::SegmentIntersectionDetector detector(&li);
+    detector.setFindProper(true);
+    MCIndexNoder noder(&detector);
+    noder.setNumThreads(4);
+    noder.computeNodes(&ss);
+
+    ensure(detector.hasIntersection());
+    ensure(detector.hasProperIntersection());
+}
+
+// Empty input
+template<>
+template<>
+void object::test<4>()
+{
+    SegmentString::NonConstVect ss;
+    RecordingIntersector intersector;
+    MCIndexNoder noder(&intersector);
+    noder.setNumThreads(4);
+    noder.computeNodes(&ss);
+    ensure(intersector.pairs.empty());
+}
+
+} // namespace tut
@@ -20,6 +20,8 @@
 
 // std
 #include <memory>
+#include <random>
+#include <sstream>
 
 using namespace geos::geom;
 using namespace geos::noding;
@@ -41,11 +43,12 @@ struct test_snaproundingnoder_data {
     WKTWriter w;
 
     void
-    checkRounding(std::string& wkt, double scale, std::string& expected_wkt)
+    checkRounding(std::string& wkt, double scale, std::string& expected_wkt, std::size_t numThreads = 1)
     {
         std::unique_ptr<Geometry> geom = r.read(wkt);
         PrecisionModel pm(scale);
         SnapRoundingNoder noder(&pm);
+        noder.setNumThreads(numThreads);
         std::unique_ptr<Geometry> result = geos::NodingTestUtil::nodeValidated(geom.get(), nullptr, &noder);
 
         // only check if expected was provided
@@ -62,6 +65,35 @@ struct test_snaproundingnoder_data {
     }
 
 
+    std::unique_ptr<Geometry>
+    randomLines(std::size_t numLines, std::size_t numPoints)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(0, 100);
+        std::ostringstream wkt;
+        wkt.precision(17);
+        wkt << "MULTILINESTRING Z (";
+        for (std::size_t i = 0; i < numLines; i++) {
+            wkt << (i > 0 ? ", (" : "(");
+            for (std::size_t j = 0; j < numPoints; j++) {
+                wkt << (j > 0 ? ", " : "") << dist(gen) << " " << dist(gen) << " " << dist(gen);
+            }
+            wkt << ")";
+        }
+        wkt << ")";
+        return r.read(wkt.str());
+    }
+
+    std::unique_ptr<Geometry>
+    nodeRandomLines(double scale, std::size_t numThreads)
+    {
+        auto geom = randomLines(200, 10);
+        PrecisionModel pm(scale);
+        SnapRoundingNoder noder(&pm);
+        noder.setNumThreads(numThreads);
+        return geos::NodingTestUtil::nodeValidated(geom.get(), nullptr, &noder);
+    }
+
     // test_snaproundingnoder_data() {}
 };
 
@@ -303,5 +335,31 @@ void object::test<19> ()
     checkRounding(wkt, 1, expected); // intersection point of (3 1.25) is snapped to (3 1) but M interpolation is done at (3 1.25)
 }
 
+// Multi-threaded snapping gives the expected result
+template<>
+template<>
+void object::test<20> ()
+{
+    std::string wkt =      "MULTILINESTRING ((1 3.3, 1.3 1.4, 3.1 1.4, 3.1 0.9, 1.3 0.9, 1 -0.2, 0.8 1.3, 1 3.3), (1 2.9, 2.9 2.9, 2.9 1.3, 1.7 1, 1.3 0.9, 1 0.4, 1 2.9))";
+    std::string expected = "MULTILINESTRING ((1 3, 1 1), (1 1, 2 1), (2 1, 3 1), (3 1, 2 1), (2 1, 1 1), (1 1, 1 0), (1 0, 1 1), (1 1, 1 3), (1 3, 3 3, 3 1), (3 1, 2 1), (2 1, 1 1), (1 1, 1 0), (1 0, 1 1), (1 1, 1 3))";
+    checkRounding(wkt, 1.0, expected, 4);
+
+    wkt = "MULTILINESTRING Z ((1 1 0, 9 2 60), (3 3 0, 3 0 36))";
+    expected = "MULTILINESTRING Z ((1 1 0, 3 1 18), (3 1 18, 9 2 60), (3 3 0, 3 1 18), (3 1 18, 3 0 36))";
+    checkRounding(wkt, 1, expected, 4);
+}
+
+// Multi-threaded snapping of many lines gives the same result as a single thread
+template<>
+template<>
+void object::test<21> ()
+{
+    for (double scale : { 1.0, 10.0 }) {
+        auto serial = nodeRandomLines(scale, 1);
+        auto parallel = nodeRandomLines(scale, 4);
+        ensure(serial->getNumGeometries() > 1000);
+        ensure(serial->equalsIdentical(parallel.get()));
+    }
+}
 
 } // namespace tut
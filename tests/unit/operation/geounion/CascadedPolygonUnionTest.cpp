@@ -126,6 +126,28 @@ create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
     }
 }
 
+// Parallel union gives the same result as serial union
+template<>
+template<>
+void object::test<4>
+()
+{
+    using geos::operation::geounion::CascadedPolygonUnion;
+    using geos::operation::geounion::ClassicUnionStrategy;
+
+    std::vector<geos::geom::Polygon*> g;
+    create_discs(const_cast<geos::geom::GeometryFactory&>(gf), 12, 0.7, &g);
+
+    ClassicUnionStrategy strategy;
+    auto serial = CascadedPolygonUnion::Union(&g);
+    for(std::size_t n : {2u, 3u, 4u, 8u}) {
+        auto parallel = CascadedPolygonUnion::Union(&g, &strategy, n);
+        ensure(parallel->equalsIdentical(serial.get()));
+    }
+
+    std::for_each(g.begin(), g.end(), delete_geometry);
+}
+
 // these tests currently fail because the geometries generated by the different
 // union algorithms are slightly different. In order to make those tests pass
 // we need to port the similarity measure classes from JTS, allowing to
@@ -0,0 +1,139 @@
+//
+// Test Suite for geos::operation::overlayng::OverlayNGPrepared class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/OverlayNGPrepared.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+
+// std
+#include <memory>
+
+using geos::geom::Geometry;
+using geos::geom::PrecisionModel;
+using geos::geom::prep::PreparedGeometry;
+using geos::geom::prep::PreparedGeometryFactory;
+using geos::io::WKTReader;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGPrepared;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_overlayngprepared_data {
+
+    WKTReader r;
+    std::unique_ptr<Geometry> maskGeom;
+    std::unique_ptr<PreparedGeometry> mask;
+
+    test_overlayngprepared_data()
+    {
+        maskGeom = r.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))");
+        mask = PreparedGeometryFactory::prepare(maskGeom.get());
+    }
+
+    void
+    checkOverlay(const std::string& wkt, int opCode, const std::string& wktExpected)
+    {
+        auto geom = r.read(wkt);
+        auto result = OverlayNGPrepared::overlay(geom.get(), *mask, opCode);
+        auto expected = r.read(wktExpected);
+        ensure_equals_geometry(result.get(), expected.get());
+
+        // same polygons as OverlayNG
+        auto overlayNG = OverlayNG::overlay(geom.get(), maskGeom.get(), opCode);
+        ensure(result->equals(overlayNG.get()));
+    }
+};
+
+typedef test_group<test_overlayngprepared_data> group;
+typedef group::object object;
+
+group test_overlayngprepared_group("geos::operation::overlayng::OverlayNGPrepared");
+
+//
+// Test Cases
+//
+
+// Intersection of polygons inside, outside, in the hole and across the mask boundary
+template<>
+template<>
+void object::test<1> ()
+{
+    checkOverlay("MULTIPOLYGON (((10 10, 20 10, 20 20, 10 20, 10 10)), ((200 200, 210 200, 210 210, 200 200)), ((45 45, 55 45, 55 55, 45 45)), ((90 90, 110 90, 110 110, 90 110, 90 90)))",
+                 OverlayNG::INTERSECTION,
+                 "MULTIPOLYGON (((10 10, 20 10, 20 20, 10 20, 10 10)), ((90 90, 100 90, 100 100, 90 100, 90 90)))");
+}
+
+// Difference of polygons inside, outside, in the hole and across the mask boundary
+template<>
+template<>
+void object::test<2> ()
+{
+    checkOverlay("MULTIPOLYGON (((10 10, 20 10, 20 20, 10 20, 10 10)), ((200 200, 210 200, 210 210, 200 200)), ((45 45, 55 45, 55 55, 45 45)), ((90 90, 110 90, 110 110, 90 110, 90 90)))",
+                 OverlayNG::DIFFERENCE,
+                 "MULTIPOLYGON (((200 200, 210 200, 210 210, 200 200)), ((45 45, 55 45, 55 55, 45 45)), ((100 90, 110 90, 110 110, 90 110, 90 100, 100 100, 100 90)))");
+}
+
+// Polygons which do not interact with the mask are copied unchanged
+template<>
+template<>
+void object::test<3> ()
+{
+    auto inside = r.read("POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10))");
+    auto result = OverlayNGPrepared::overlay(inside.get(), *mask, OverlayNG::INTERSECTION);
+    ensure(result->equalsIdentical(inside.get()));
+
+    auto outside = r.read("MULTIPOLYGON (((200 200, 210 200, 210 210, 200 200)), ((45 45, 55 45, 55 55, 45 45)))");
+    result = OverlayNGPrepared::overlay(outside.get(), *mask, OverlayNG::DIFFERENCE);
+    ensure(result->equalsIdentical(outside.get()));
+
+    result = OverlayNGPrepared::overlay(outside.get(), *mask, OverlayNG::INTERSECTION);
+    ensure(result->isEmpty());
+    ensure_equals(result->getDimension(), 2);
+
+    result = OverlayNGPrepared::overlay(inside.get(), *mask, OverlayNG::DIFFERENCE);
+    ensure(result->isEmpty());
+    ensure_equals(result->getDimension(), 2);
+}
+
+// Lower-dimension results of polygons touching the mask are kept
+template<>
+template<>
+void object::test<4> ()
+{
+    checkOverlay("MULTIPOLYGON (((10 10, 20 10, 20 20, 10 20, 10 10)), ((100 10, 110 10, 110 20, 100 20, 100 10)))",
+                 OverlayNG::INTERSECTION,
+                 "GEOMETRYCOLLECTION (POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10)), LINESTRING (100 10, 100 20))");
+}
+
+// Other operations, inputs and precision models use OverlayNG
+template<>
+template<>
+void object::test<5> ()
+{
+    auto geom = r.read("MULTIPOLYGON (((10 10, 20 10, 20 20, 10 20, 10 10)), ((90 90, 110 90, 110 110, 90 110, 90 90)))");
+    auto result = OverlayNGPrepared::overlay(geom.get(), *mask, OverlayNG::UNION);
+    ensure_equals_geometry(result.get(), OverlayNG::overlay(geom.get(), maskGeom.get(), OverlayNG::UNION).get());
+
+    auto line = r.read("LINESTRING (10 50, 150 50)");
+    result = OverlayNGPrepared::overlay(line.get(), *mask, OverlayNG::INTERSECTION);
+    ensure_equals_geometry(result.get(), OverlayNG::overlay(line.get(), maskGeom.get(), OverlayNG::INTERSECTION).get());
+
+    PrecisionModel pm(0.1);
+    auto fine = r.read("POLYGON ((10.4 10.4, 20 10, 20 20, 10 20, 10.4 10.4))");
+    OverlayNGPrepared ov(*mask, &pm);
+    result = ov.overlay(fine.get(), OverlayNG::INTERSECTION);
+    ensure_equals_geometry(result.get(), OverlayNG::overlay(fine.get(), maskGeom.get(), OverlayNG::INTERSECTION, &pm).get());
+    ensure(!result->equalsIdentical(fine.get()));
+}
+
+} // namespace tut
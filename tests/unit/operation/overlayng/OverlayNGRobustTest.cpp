@@ -14,6 +14,7 @@
 // geos
 #include <geos/operation/overlayng/OverlayNGRobust.h>
 #include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/util/IllegalArgumentException.h>
 
 // std
 #include <memory>
@@ -26,6 +27,7 @@ using geos::io::WKTReader;
 using geos::io::WKTWriter;
 using geos::operation::overlayng::OverlayNGRobust;
 using geos::operation::overlayng::OverlayNG;
+using Attempt = OverlayNGRobust::Attempt;
 
 namespace tut {
 //
@@ -155,4 +157,66 @@ void object::test<3> ()
 
 #endif
 
+// Stats count the attempts made
+template<>
+template<>
+void object::test<4> ()
+{
+    auto a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    OverlayNGRobust::Stats stats;
+
+    auto result = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::INTERSECTION, &stats);
+    ensure_equals_geometry(result.get(), r.read("POLYGON ((5 10, 10 10, 10 5, 5 5, 5 10))").get());
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::FLOATING)), 1u);
+    ensure_equals(stats.getNumSuccesses(Attempt(OverlayNGRobust::FLOATING)), 1u);
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::SNAPPING, 0)), 0u);
+    ensure(stats.getTime(Attempt(OverlayNGRobust::FLOATING)) >= 0);
+    ensure(stats.getMostSuccessful() == Attempt(OverlayNGRobust::FLOATING));
+
+    stats.reset();
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::FLOATING)), 0u);
+    ensure_equals(stats.getTime(Attempt(OverlayNGRobust::FLOATING)), 0.0);
+
+    ensure_THROW(stats.getNumAttempts(Attempt(OverlayNGRobust::SNAPPING, 5)), geos::util::IllegalArgumentException);
+}
+
+// Stats record the attempts which failed, and the next overlay
+// can start from the one which succeeded (see test 2)
+template<>
+template<>
+void object::test<5> ()
+{
+    auto a = r.read("POLYGON ((654948.3853299792 1794977.105854025, 655016.3812220972 1794939.918901604, 655016.2022581929 1794940.1099794197, 655014.9264068712 1794941.4254068714, 655014.7408834674 1794941.6101225375, 654948.3853299792 1794977.105854025))");
+    auto b = r.read("POLYGON ((655103.6628454948 1794805.456674405, 655016.20226 1794940.10998, 655014.8317182435 1794941.5196832407, 655014.8295602322 1794941.5218318563, 655014.740883467 1794941.610122538, 655016.6029214273 1794938.7590508445, 655103.6628454948 1794805.456674405))");
+    OverlayNGRobust::Stats stats;
+
+    auto result = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::INTERSECTION, &stats);
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::FLOATING)), 1u);
+    ensure_equals(stats.getNumSuccesses(Attempt(OverlayNGRobust::FLOATING)), 0u);
+    Attempt best = stats.getMostSuccessful();
+    ensure(best.strategy != OverlayNGRobust::FLOATING);
+    ensure_equals(stats.getNumSuccesses(best), 1u);
+
+    auto again = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::INTERSECTION, &stats, best);
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::FLOATING)), 1u);
+    ensure_equals(stats.getNumSuccesses(best), 2u);
+    ensure(result->equalsIdentical(again.get()));
+}
+
+// Overlay can start from a later attempt
+template<>
+template<>
+void object::test<6> ()
+{
+    auto a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    OverlayNGRobust::Stats stats;
+
+    auto result = OverlayNGRobust::Overlay(a.get(), b.get(), OverlayNG::UNION, &stats, Attempt(OverlayNGRobust::SNAP_ROUNDING));
+    ensure_equals(result->getArea(), 175.0);
+    ensure_equals(stats.getNumSuccesses(Attempt(OverlayNGRobust::SNAP_ROUNDING)), 1u);
+    ensure_equals(stats.getNumAttempts(Attempt(OverlayNGRobust::FLOATING)), 0u);
+}
+
 } // namespace tut
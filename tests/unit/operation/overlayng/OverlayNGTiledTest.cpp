@@ -0,0 +1,205 @@
+//
+// Test Suite for geos::operation::overlayng::OverlayNGTiled class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/OverlayNGTiled.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/geom/PrecisionModel.h>
+
+// std
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+
+using geos::geom::Geometry;
+using geos::geom::PrecisionModel;
+using geos::io::WKTReader;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGTiled;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_overlayngtiled_data {
+
+    WKTReader r;
+    std::unique_ptr<Geometry> circle;
+    std::unique_ptr<Geometry> ring;
+
+    test_overlayngtiled_data()
+    {
+        circle = r.read("POINT (0 0)")->buffer(10, 64);
+        auto outer = r.read("POINT (6 3)")->buffer(8, 32);
+        auto inner = r.read("POINT (6 3)")->buffer(3, 32);
+        ring = outer->difference(inner.get());
+    }
+
+    std::unique_ptr<Geometry>
+    tiled(const Geometry* a, const Geometry* b, int opCode, const PrecisionModel* pm, std::size_t numThreads = 1)
+    {
+        OverlayNGTiled ov(a, b, pm, opCode);
+        ov.setMaxTileVertices(40);
+        ov.setNumThreads(numThreads);
+        return ov.getResult();
+    }
+
+    std::unique_ptr<Geometry>
+    untiled(const Geometry* a, const Geometry* b, int opCode, const PrecisionModel* pm)
+    {
+        OverlayNG ov(a, b, pm, opCode);
+        ov.setStrictMode(true);
+        return ov.getResult();
+    }
+
+    // With a FLOATING precision model the result has the vertices of the
+    // untiled overlay, up to rounding of intersections on split edges
+    void
+    checkTiled(const Geometry* a, const Geometry* b, int opCode)
+    {
+        PrecisionModel pm;
+        auto expected = untiled(a, b, opCode, &pm);
+        auto result = tiled(a, b, opCode, &pm);
+
+        ensure("result is valid", result->isValid());
+        ensure_equals_geometry(result.get(), expected.get(), 1e-9);
+    }
+
+    // With a FIXED precision model vertices near tile boundaries may differ
+    void
+    checkTiledFixed(const Geometry* a, const Geometry* b, int opCode, const PrecisionModel* pm, double tolerance)
+    {
+        auto expected = untiled(a, b, opCode, pm);
+        auto result = tiled(a, b, opCode, pm);
+
+        ensure("result is valid", result->isValid());
+        ensure_equals("result dimension", result->getDimension(), 2);
+        double area = expected->getArea();
+        ensure_equals("result area", result->getArea(), area, area * tolerance);
+        auto diff = result->symDifference(expected.get());
+        ensure("result matches untiled overlay", diff->getArea() <= area * tolerance);
+    }
+};
+
+typedef test_group<test_overlayngtiled_data> group;
+typedef group::object object;
+
+group test_overlayngtiled_group("geos::operation::overlayng::OverlayNGTiled");
+
+//
+// Test Cases
+//
+
+// Intersection with floating precision
+template<>
+template<>
+void object::test<1> ()
+{
+    checkTiled(circle.get(), ring.get(), OverlayNG::INTERSECTION);
+}
+
+// Union, difference and symmetric difference with floating precision
+template<>
+template<>
+void object::test<2> ()
+{
+    checkTiled(circle.get(), ring.get(), OverlayNG::UNION);
+    checkTiled(circle.get(), ring.get(), OverlayNG::DIFFERENCE);
+    checkTiled(ring.get(), circle.get(), OverlayNG::DIFFERENCE);
+    checkTiled(circle.get(), ring.get(), OverlayNG::SYMDIFFERENCE);
+}
+
+// Fixed precision
+template<>
+template<>
+void object::test<3> ()
+{
+    PrecisionModel pm(100.0);
+    checkTiledFixed(circle.get(), ring.get(), OverlayNG::INTERSECTION, &pm, 1e-3);
+    checkTiledFixed(circle.get(), ring.get(), OverlayNG::UNION, &pm, 1e-3);
+    checkTiledFixed(circle.get(), ring.get(), OverlayNG::DIFFERENCE, &pm, 1e-3);
+    checkTiledFixed(circle.get(), ring.get(), OverlayNG::SYMDIFFERENCE, &pm, 1e-3);
+
+    auto result = tiled(circle.get(), ring.get(), OverlayNG::UNION, &pm);
+    auto coords = result->getCoordinates();
+    for (std::size_t i = 0; i < coords->size(); i++) {
+        const auto& p = coords->getAt<geos::geom::CoordinateXY>(i);
+        ensure_equals(p.x, std::round(p.x * 100) / 100);
+        ensure_equals(p.y, std::round(p.y * 100) / 100);
+    }
+}
+
+// Tiles overlaid on several threads give the same result
+template<>
+template<>
+void object::test<4> ()
+{
+    PrecisionModel pm;
+    for (int opCode : { OverlayNG::INTERSECTION, OverlayNG::UNION, OverlayNG::DIFFERENCE, OverlayNG::SYMDIFFERENCE }) {
+        auto serial = tiled(circle.get(), ring.get(), opCode, &pm, 1);
+        auto parallel = tiled(circle.get(), ring.get(), opCode, &pm, 4);
+        ensure(serial->equalsIdentical(parallel.get()));
+    }
+}
+
+// Disjoint parts and tiles with an empty result
+template<>
+template<>
+void object::test<5> ()
+{
+    PrecisionModel pm;
+    auto far = r.read("POINT (100 100)")->buffer(5, 32);
+    auto multi = circle->Union(far.get());
+    checkTiled(multi.get(), ring.get(), OverlayNG::INTERSECTION);
+    checkTiled(multi.get(), ring.get(), OverlayNG::UNION);
+    checkTiled(multi.get(), ring.get(), OverlayNG::DIFFERENCE);
+
+    auto disjoint = tiled(far.get(), ring.get(), OverlayNG::INTERSECTION, &pm);
+    ensure(disjoint->isEmpty());
+}
+
+// Inputs which are not polygonal are overlaid without tiling
+template<>
+template<>
+void object::test<6> ()
+{
+    PrecisionModel pm;
+    auto line = r.read("LINESTRING (-20 -1, 20 1)");
+    auto result = tiled(line.get(), circle.get(), OverlayNG::INTERSECTION, &pm);
+    auto expected = OverlayNG::overlay(line.get(), circle.get(), OverlayNG::INTERSECTION, &pm);
+    ensure_equals_geometry(result.get(), expected.get());
+}
+
+// Many tiles, with edges crossing tile boundaries near vertices
+template<>
+template<>
+void object::test<7> ()
+{
+    std::string wkt = "MULTIPOINT (";
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(0, 999);
+    for (int i = 0; i < 300; i++) {
+        double x = dist(gen) / 10.0;
+        double y = dist(gen) / 10.0;
+        wkt += (i ? ", " : "") + std::to_string(x) + " " + std::to_string(y);
+    }
+    wkt += ")";
+    auto pts = r.read(wkt);
+    auto a = pts->buffer(4, 8);
+    auto disc = pts->getCentroid()->buffer(40, 64);
+    auto b = r.read("POLYGON ((0 0, 100 30, 40 100, 0 0))")->buffer(-3)->symDifference(disc.get());
+
+    PrecisionModel pmFixed(10.0);
+    for (int opCode : { OverlayNG::INTERSECTION, OverlayNG::UNION, OverlayNG::DIFFERENCE, OverlayNG::SYMDIFFERENCE }) {
+        checkTiled(a.get(), b.get(), opCode);
+        checkTiledFixed(a.get(), b.get(), opCode, &pmFixed, 1e-2);
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,101 @@
+//
+// Test Suite for geos::util::Double2 class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include "util/Simd.h"
+// std
+#include <cmath>
+#include <limits>
+
+using geos::util::Double2;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_double2_data {
+    void
+    ensure_lanes(const Double2& d, double first, double second)
+    {
+        ensure_equals("first", d.first(), first);
+        ensure_equals("second", d.second(), second);
+    }
+};
+
+typedef test_group<test_double2_data> group;
+typedef group::object object;
+
+group test_double2_group("geos::util::Double2");
+
+//
+// Test Cases
+//
+
+// load, store and broadcast
+template<>
+template<>
+void object::test<1>
+()
+{
+    // unaligned on purpose
+    double in[3] = {1.5, -2.25, 7.0};
+    Double2 d = Double2::load(in + 1);
+    ensure_lanes(d, -2.25, 7.0);
+
+    double out[3] = {0.0, 0.0, 0.0};
+    d.store(out + 1);
+    ensure_equals(out[0], 0.0);
+    ensure_equals(out[1], -2.25);
+    ensure_equals(out[2], 7.0);
+
+    ensure_lanes(Double2::broadcast(3.5), 3.5, 3.5);
+}
+
+// Arithmetic is lane-wise and gives the same results as scalar code
+template<>
+template<>
+void object::test<2>
+()
+{
+    double a[2] = {0.1, 1e300};
+    double b[2] = {0.2, 3.0};
+    Double2 da = Double2::load(a);
+    Double2 db = Double2::load(b);
+
+    ensure_lanes(da + db, a[0] + b[0], a[1] + b[1]);
+    ensure_lanes(da - db, a[0] - b[0], a[1] - b[1]);
+    ensure_lanes(da * db, a[0] * b[0], a[1] * b[1]);
+    ensure_lanes(Double2::sqrt(db), std::sqrt(b[0]), std::sqrt(b[1]));
+
+    ensure_lanes(Double2::firsts(da, db), a[0], b[0]);
+    ensure_lanes(Double2::seconds(da, db), a[1], b[1]);
+}
+
+// min and max ignore a NaN in their first argument
+template<>
+template<>
+void object::test<3>
+()
+{
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    double a[2] = {nan, -1.0};
+    double b[2] = {2.0, 4.0};
+    Double2 da = Double2::load(a);
+    Double2 db = Double2::load(b);
+
+    ensure_lanes(Double2::min(da, db), 2.0, -1.0);
+    ensure_lanes(Double2::max(da, db), 2.0, 4.0);
+
+    Double2 lo = Double2::min(db, da);
+    ensure(std::isnan(lo.first()));
+    ensure_equals(lo.second(), -1.0);
+
+    Double2 diff = da - da;
+    ensure(std::isnan(diff.first()));
+    ensure_equals(diff.second(), 0.0);
+}
+
+} // namespace tut
@@ -18,7 +18,9 @@
 #include <geos/geom/Point.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/operation/valid/MakeValid.h>
+#include <geos/io/GeoJSONStreamReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/MappedFile.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTStreamReader.h>
 #include <geos/io/WKTWriter.h>
@@ -28,6 +30,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 
 #include "GeometryOp.h"
@@ -79,19 +82,20 @@ int main(int argc, char** argv) {
 
     cxxopts::Options options("geosop", "Executes GEOS geometry operations");
     options.add_options()
-        ("a", "source for A geometries (WKT, WKB, file, stdin, stdin.wkb)", cxxopts::value<std::string>( cmdArgs.srcA ))
-        ("b", "source for B geometries (WKT, WKB, file, stdin, stdin.wkb)", cxxopts::value<std::string>( cmdArgs.srcB ))
+        ("a", "source for A geometries (WKT, WKB, file, stdin, stdin.wkb, stdin.wkbl, stdin.geojson)", cxxopts::value<std::string>( cmdArgs.srcA ))
+        ("b", "source for B geometries (WKT, WKB, file, stdin, stdin.wkb, stdin.wkbl, stdin.geojson)", cxxopts::value<std::string>( cmdArgs.srcB ))
         ("l,limita", "Limit number of A geometries read", cxxopts::value<int>( cmdArgs.limitA ))
         ("o,offseta", "Skip reading first N geometries of A", cxxopts::value<int>( cmdArgs.offsetA ) )
         ("c,collect", "Collect input into single geometry (automatic for AGG ops)", cxxopts::value<bool>( cmdArgs.isCollect ))
         ("e,explode", "Explode results into component geometries", cxxopts::value<bool>( cmdArgs.isExplode))
-        ("f,format", "Output format (wkt, wkb, txt or geojson)", cxxopts::value<std::string>( ))
+        ("f,format", "Output format (wkt, wkb, wkbl, txt or geojson)", cxxopts::value<std::string>( ))
         ("p,precision", "Set number of decimal places in output coordinates", cxxopts::value<int>( cmdArgs.precision ) )
         ("q,quiet", "Disable result output", cxxopts::value<bool>( cmdArgs.isQuiet ) )
         ("r,repeat", "Repeat operation N times", cxxopts::value<int>( cmdArgs.repeatNum ) )
         ("select", "Select geometries where op result is true", cxxopts::value<bool>( cmdArgs.isSelect ) )
         ("selectNot", "Select geometries where op result is false", cxxopts::value<bool>( cmdArgs.isSelectNot ) )
         ("t,time", "Print execution time", cxxopts::value<bool>( cmdArgs.isShowTime ) )
+        ("threads", "Number of threads decoding WKT/WKB file input (0 = all cores)", cxxopts::value<int>( cmdArgs.numThreads ) )
         ("v,verbose", "Verbose output", cxxopts::value<bool>( cmdArgs.isVerbose )->default_value("false"))
         ("h,help", "Print help")
 
@@ -139,6 +143,9 @@ int main(int argc, char** argv) {
         else if (fmt == "wkb") {
             cmdArgs.format = GeosOpArgs::fmtWKB;
         }
+        else if (fmt == "wkbl") {
+            cmdArgs.format = GeosOpArgs::fmtWKBL;
+        }
         else if (fmt == "geojson" || fmt == "json") {
             cmdArgs.format = GeosOpArgs::fmtGeoJSON;
         }
@@ -235,9 +242,10 @@ bool isWKBLiteral(std::string s) {
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKTFile(std::istream& in, int limit, int offset) {
+readWKTFile(std::istream& in, int limit, int offset, int numThreads) {
 
     WKTStreamReader rdr( in );
+    rdr.setNumThreads( static_cast<std::size_t>( std::max(numThreads, 0) ) );
     std::vector<std::unique_ptr<Geometry>> geoms;
     int count = 0;
     while (limit < 0 || (int) geoms.size() < limit) {
@@ -253,19 +261,19 @@ readWKTFile(std::istream& in, int limit, int offset) {
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKTFile(std::string src, int limit, int offset) {
+readWKTFile(std::string src, int limit, int offset, int numThreads) {
     if (src == "-" || src == "-.wkt" || src == "stdin" || src == "stdin.wkt") {
-        return readWKTFile( std::cin, limit, offset );
+        return readWKTFile( std::cin, limit, offset, numThreads );
     }
     std::ifstream f( src );
-    auto geoms = readWKTFile( f, limit, offset );
+    auto geoms = readWKTFile( f, limit, offset, numThreads );
     f.close();
     return geoms;
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKBFile(std::istream& in, int limit, int offset) {
-    WKBStreamReader rdr( in );
+readWKB(WKBStreamReader& rdr, int limit, int offset, int numThreads) {
+    rdr.setNumThreads( static_cast<std::size_t>( std::max(numThreads, 0) ) );
     std::vector<std::unique_ptr<Geometry>> geoms;
     int count = 0;
     while (limit < 0 || (int) geoms.size() < limit) {
@@ -281,12 +289,62 @@ readWKBFile(std::istream& in, int limit, int offset) {
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKBFile(std::string src, int limit, int offset) {
+readWKBFile(std::istream& in, int limit, int offset, int numThreads) {
+    WKBStreamReader rdr( in );
+    return readWKB( rdr, limit, offset, numThreads );
+}
+
+std::vector<std::unique_ptr<Geometry>>
+readWKBFile(std::string src, int limit, int offset, int numThreads) {
     if (src == "-.wkb" || src == "stdin.wkb" ) {
-        return readWKBFile( std::cin, limit, offset );
+        return readWKBFile( std::cin, limit, offset, numThreads );
     }
     std::ifstream f( src );
-    auto geoms = readWKBFile( f, limit, offset );
+    auto geoms = readWKBFile( f, limit, offset, numThreads );
+    f.close();
+    return geoms;
+}
+
+/**
+ * Reads length-prefixed binary WKB (a 4-byte little-endian size before each record).
+ * Files are memory-mapped and records decoded in place.
+ */
+std::vector<std::unique_ptr<Geometry>>
+readWKBLFile(std::string src, int limit, int offset, int numThreads) {
+    if (src == "-.wkbl" || src == "stdin.wkbl" ) {
+        std::vector<unsigned char> buf{ std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>() };
+        WKBStreamReader rdr( buf.data(), buf.size() );
+        return readWKB( rdr, limit, offset, numThreads );
+    }
+    MappedFile f( src );
+    WKBStreamReader rdr( f.data(), f.size() );
+    return readWKB( rdr, limit, offset, numThreads );
+}
+
+std::vector<std::unique_ptr<Geometry>>
+readGeoJSONFile(std::istream& in, int limit, int offset) {
+    GeoJSONStreamReader rdr( in );
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    int count = 0;
+    while (limit < 0 || (int) geoms.size() < limit) {
+        auto feature = rdr.next();
+        if (feature == nullptr)
+            break;
+        if (count > offset) {
+            geoms.push_back(feature->getGeometry()->clone());
+        }
+        count++;
+    }
+    return geoms;
+}
+
+std::vector<std::unique_ptr<Geometry>>
+readGeoJSONFile(std::string src, int limit, int offset) {
+    if (src == "-.geojson" || src == "stdin.geojson" ) {
+        return readGeoJSONFile( std::cin, limit, offset );
+    }
+    std::ifstream f( src );
+    auto geoms = readGeoJSONFile( f, limit, offset );
     f.close();
     return geoms;
 }
@@ -319,11 +377,19 @@ GeosOp::readInput(std::string name, std::string src, int limit, int offset) {
     }
     else if (endsWith(src, ".wkb")) {
         log(srcDesc + "WKB file " + src);
-        geoms = readWKBFile( src, limit, offset );
+        geoms = readWKBFile( src, limit, offset, args.numThreads );
+    }
+    else if (endsWith(src, ".wkbl")) {
+        log(srcDesc + "length-prefixed WKB file " + src);
+        geoms = readWKBLFile( src, limit, offset, args.numThreads );
+    }
+    else if (endsWith(src, ".geojson") || endsWith(src, ".json")) {
+        log(srcDesc + "GeoJSON file " + src);
+        geoms = readGeoJSONFile( src, limit, offset );
     }
     else {
         log(srcDesc + "WKT file " + src);
-        geoms = readWKTFile( src, limit, offset );
+        geoms = readWKTFile( src, limit, offset, args.numThreads );
     }
     return geoms;
 }
@@ -556,7 +622,10 @@ void GeosOp::outputExplode(std::unique_ptr<Geometry>& geom) {
 
 void GeosOp::outputGeometry(const Geometry * geom) {
     if (geom == nullptr) {
-        std::cout << "null" << std::endl;
+        // binary output has no representation for a missing geometry
+        if (args.format != GeosOpArgs::fmtWKBL) {
+            std::cout << "null" << std::endl;
+        }
         return;
     }
 
@@ -566,6 +635,17 @@ void GeosOp::outputGeometry(const Geometry * geom) {
         writer.writeHEX(*geom, std::cout);
         std::cout << std::endl;
     }
+    else if (args.format == GeosOpArgs::fmtWKBL ) {
+        // output as binary WKB, preceded by its little-endian size
+        std::vector<unsigned char> buf(4);
+        WKBWriter writer;
+        writer.write(*geom, buf);
+        const std::size_t size = buf.size() - 4;
+        for (std::size_t i = 0; i < 4; i++) {
+            buf[i] = static_cast<unsigned char>(size >> (8 * i));
+        }
+        std::cout.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+    }
     else if (args.format == GeosOpArgs::fmtGeoJSON ) {
         // output as GeoJSON
         // TODO: enable args.precision to output
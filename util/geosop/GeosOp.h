@@ -34,6 +34,7 @@ public:
         fmtNone,
         fmtText,
         fmtWKB,
+        fmtWKBL,
         fmtGeoJSON,
     } format = fmtText;
 
@@ -42,6 +43,7 @@ public:
     bool isQuiet = false;
     int precision = -1;
     int repeatNum = 1;
+    int numThreads = 1;
 
     //std::string format;
 